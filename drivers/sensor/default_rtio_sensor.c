@@ -533,3 +533,99 @@ const struct sensor_decoder_api __sensor_default_decoder = {
 	.get_size_info = sensor_natively_supported_channel_size_info,
 	.decode = decode,
 };
+
+/* Number of samples decoded per decode() call by sensor_decode_block_generic() */
+#define DECODE_BLOCK_CHUNK 8
+
+int sensor_decode_block_generic(const struct sensor_decoder_api *decoder, const uint8_t *buffer,
+				struct sensor_chan_spec channel, uint32_t *fit,
+				struct sensor_q31_block *block)
+{
+	union {
+		struct sensor_three_axis_data three_axis;
+		struct sensor_q31_data q31;
+		uint8_t raw[sizeof(struct sensor_three_axis_data) +
+			    (DECODE_BLOCK_CHUNK - 1) * sizeof(struct sensor_three_axis_sample_data)];
+	} chunk;
+	size_t base_size;
+	size_t frame_size;
+	uint16_t max_count;
+	uint16_t count = 0;
+	bool three_axis;
+	int rc;
+
+	BUILD_ASSERT(sizeof(struct sensor_three_axis_sample_data) >=
+		     sizeof(struct sensor_q31_sample_data));
+
+	rc = decoder->get_size_info(channel, &base_size, &frame_size);
+	if (rc != 0) {
+		return rc;
+	}
+
+	if (base_size == sizeof(struct sensor_three_axis_data) &&
+	    frame_size == sizeof(struct sensor_three_axis_sample_data)) {
+		three_axis = true;
+	} else if (base_size == sizeof(struct sensor_q31_data) &&
+		   frame_size == sizeof(struct sensor_q31_sample_data)) {
+		three_axis = false;
+	} else {
+		return -ENOTSUP;
+	}
+
+	while (count < block->capacity) {
+		uint32_t prev_fit = *fit;
+		int8_t shift;
+		uint64_t base_timestamp_ns;
+
+		max_count = MIN(block->capacity - count, DECODE_BLOCK_CHUNK);
+		rc = decoder->decode(buffer, channel, fit, max_count, &chunk);
+		if (rc <= 0) {
+			/* The samples decoded so far are still valid */
+			if (count > 0) {
+				break;
+			}
+			return rc;
+		}
+
+		base_timestamp_ns = three_axis ? chunk.three_axis.header.base_timestamp_ns
+					       : chunk.q31.header.base_timestamp_ns;
+		shift = three_axis ? chunk.three_axis.shift : chunk.q31.shift;
+		if (count == 0) {
+			block->header.base_timestamp_ns = base_timestamp_ns;
+			block->shift = shift;
+		} else if (shift != block->shift ||
+			   base_timestamp_ns != block->header.base_timestamp_ns) {
+			/* Leave these samples for the next block */
+			*fit = prev_fit;
+			break;
+		}
+
+		for (int i = 0; i < rc; i++, count++) {
+			if (three_axis) {
+				const struct sensor_three_axis_sample_data *sample =
+					&chunk.three_axis.readings[i];
+
+				if (block->timestamp_delta != NULL) {
+					block->timestamp_delta[count] = sample->timestamp_delta;
+				}
+				block->x[count] = sample->x;
+				if (block->y != NULL) {
+					block->y[count] = sample->y;
+				}
+				if (block->z != NULL) {
+					block->z[count] = sample->z;
+				}
+			} else {
+				const struct sensor_q31_sample_data *sample = &chunk.q31.readings[i];
+
+				if (block->timestamp_delta != NULL) {
+					block->timestamp_delta[count] = sample->timestamp_delta;
+				}
+				block->x[count] = sample->value;
+			}
+		}
+	}
+
+	block->header.reading_count = count;
+	return count;
+}
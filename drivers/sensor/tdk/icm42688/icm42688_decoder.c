@@ -411,6 +411,116 @@ static int icm42688_fifo_decode(const uint8_t *buffer, struct sensor_chan_spec c
 	return count;
 }
 
+static int icm42688_fifo_decode_block(const uint8_t *buffer, struct sensor_chan_spec chan_spec,
+				      uint32_t *fit, struct sensor_q31_block *block)
+{
+	const struct icm42688_fifo_data *edata = (const struct icm42688_fifo_data *)buffer;
+	const uint8_t *buffer_end = buffer + sizeof(struct icm42688_fifo_data) + edata->fifo_count;
+	const bool is_temp = chan_spec.chan_type == SENSOR_CHAN_DIE_TEMP;
+	const bool is_accel = IS_ACCEL(chan_spec.chan_type);
+	const bool is_xyz = chan_spec.chan_type == SENSOR_CHAN_ACCEL_XYZ ||
+			    chan_spec.chan_type == SENSOR_CHAN_GYRO_XYZ;
+	const int fs = is_accel ? edata->header.accel_fs : edata->header.gyro_fs;
+	const uint64_t period_ns =
+		is_accel ? accel_period_ns[edata->accel_odr] : gyro_period_ns[edata->gyro_odr];
+	uint8_t axis = 0;
+	int accel_frame_count = 0;
+	int gyro_frame_count = 0;
+	uint16_t count = 0;
+	int rc;
+
+	if (!is_temp && !is_accel && !IS_GYRO(chan_spec.chan_type)) {
+		return -ENOTSUP;
+	}
+
+	if ((uintptr_t)buffer_end <= *fit || chan_spec.chan_idx != 0) {
+		return 0;
+	}
+
+	block->header.base_timestamp_ns = edata->header.timestamp;
+	if (is_temp) {
+		block->shift = 9;
+	} else {
+		icm42688_get_shift(is_accel ? SENSOR_CHAN_ACCEL_XYZ : SENSOR_CHAN_GYRO_XYZ,
+				   edata->header.accel_fs, edata->header.gyro_fs, &block->shift);
+		if (!is_xyz) {
+			axis = chan_spec.chan_type -
+			       (is_accel ? SENSOR_CHAN_ACCEL_X : SENSOR_CHAN_GYRO_X);
+		}
+	}
+
+	buffer += sizeof(struct icm42688_fifo_data);
+	while (count < block->capacity && buffer < buffer_end) {
+		const bool is_20b = FIELD_GET(FIFO_HEADER_20, buffer[0]) == 1;
+		const bool has_accel = FIELD_GET(FIFO_HEADER_ACCEL, buffer[0]) == 1;
+		const bool has_gyro = FIELD_GET(FIFO_HEADER_GYRO, buffer[0]) == 1;
+		const uint8_t *frame_end = buffer;
+		uint32_t timestamp_delta;
+
+		if (is_20b) {
+			frame_end += 20;
+		} else if (has_accel && has_gyro) {
+			frame_end += 16;
+		} else {
+			frame_end += 8;
+		}
+		if (has_accel) {
+			accel_frame_count++;
+		}
+		if (has_gyro) {
+			gyro_frame_count++;
+		}
+
+		if ((uintptr_t)buffer < *fit || (!is_temp && !(is_accel ? has_accel : has_gyro))) {
+			/* Already decoded or without a sample of the channel, skip the frame */
+			buffer = frame_end;
+			continue;
+		}
+
+		if (is_temp) {
+			if (has_accel) {
+				timestamp_delta =
+					accel_period_ns[edata->accel_odr] * (accel_frame_count - 1);
+			} else {
+				timestamp_delta =
+					gyro_period_ns[edata->gyro_odr] * (gyro_frame_count - 1);
+			}
+			block->x[count] = icm42688_read_temperature_from_packet(buffer);
+		} else {
+			timestamp_delta =
+				((is_accel ? accel_frame_count : gyro_frame_count) - 1) * period_ns;
+			rc = icm42688_read_imu_from_packet(buffer, is_accel, fs, axis,
+							   &block->x[count]);
+			if (is_xyz && block->y != NULL) {
+				rc |= icm42688_read_imu_from_packet(buffer, is_accel, fs, 1,
+								    &block->y[count]);
+			}
+			if (is_xyz && block->z != NULL) {
+				rc |= icm42688_read_imu_from_packet(buffer, is_accel, fs, 2,
+								    &block->z[count]);
+			}
+			if (rc != 0) {
+				if (is_accel) {
+					accel_frame_count--;
+				} else {
+					gyro_frame_count--;
+				}
+				buffer = frame_end;
+				continue;
+			}
+		}
+		if (block->timestamp_delta != NULL) {
+			block->timestamp_delta[count] = timestamp_delta;
+		}
+		buffer = frame_end;
+		*fit = (uintptr_t)frame_end;
+		count++;
+	}
+
+	block->header.reading_count = count;
+	return count;
+}
+
 static int icm42688_one_shot_decode(const uint8_t *buffer, struct sensor_chan_spec chan_spec,
 				    uint32_t *fit, uint16_t max_count, void *data_out)
 {
@@ -624,13 +734,30 @@ static bool icm24688_decoder_has_trigger(const uint8_t *buffer, enum sensor_trig
 	}
 }
 
+static int icm42688_decoder_decode_block(const uint8_t *buffer, struct sensor_chan_spec chan_spec,
+					 uint32_t *fit, struct sensor_q31_block *block);
+
 SENSOR_DECODER_API_DT_DEFINE() = {
 	.get_frame_count = icm42688_decoder_get_frame_count,
 	.get_size_info = icm42688_decoder_get_size_info,
 	.decode = icm42688_decoder_decode,
 	.has_trigger = icm24688_decoder_has_trigger,
+	.decode_block = icm42688_decoder_decode_block,
 };
 
+static int icm42688_decoder_decode_block(const uint8_t *buffer, struct sensor_chan_spec chan_spec,
+					 uint32_t *fit, struct sensor_q31_block *block)
+{
+	const struct icm42688_decoder_header *header =
+		(const struct icm42688_decoder_header *)buffer;
+
+	if (header->is_fifo) {
+		return icm42688_fifo_decode_block(buffer, chan_spec, fit, block);
+	}
+	/* A one-shot buffer holds a single frame, nothing to gain over the generic path */
+	return sensor_decode_block_generic(&SENSOR_DECODER_NAME(), buffer, chan_spec, fit, block);
+}
+
 int icm42688_get_decoder(const struct device *dev, const struct sensor_decoder_api **decoder)
 {
 	ARG_UNUSED(dev);
@@ -74,6 +74,72 @@ struct json_obj_token {
 	size_t length;
 };
 
+/**
+ * @brief Value reported by the streaming parser, see json_stream_feed()
+ */
+struct json_stream_event {
+	/** Type of the value, one of JSON_TOK_OBJECT_START, JSON_TOK_OBJECT_END,
+	 * JSON_TOK_ARRAY_START, JSON_TOK_ARRAY_END, JSON_TOK_STRING,
+	 * JSON_TOK_NUMBER, JSON_TOK_TRUE, JSON_TOK_FALSE or JSON_TOK_NULL
+	 */
+	enum json_tokens type;
+	/** Name of the object member holding the value, NULL for array
+	 * elements, the top-level value and the end of objects and arrays
+	 */
+	const char *key;
+	/** Length of @a key */
+	size_t key_len;
+	/** Text of a string, without the quotes and with the escape sequences
+	 * left as is, or of a number. NULL for the other types.
+	 */
+	const char *value;
+	/** Length of @a value */
+	size_t value_len;
+	/** Nesting depth of the value, 0 for the top-level value */
+	uint8_t depth;
+};
+
+/**
+ * @brief Callback reporting the values found by the streaming parser
+ *
+ * The key and value of @a event are only valid during the call.
+ *
+ * @param event The value found
+ * @param user_data User-provided pointer
+ *
+ * @return 0 to continue parsing, a negative error code to stop it
+ * (the error is returned by json_stream_feed()).
+ */
+typedef int (*json_stream_cb_t)(const struct json_stream_event *event,
+				void *user_data);
+
+/** Maximum nesting depth of the documents handled by the streaming parser */
+#define JSON_STREAM_MAX_DEPTH 32
+
+/**
+ * @brief State of the streaming parser, see json_stream_init()
+ */
+struct json_stream {
+	json_stream_cb_t cb;
+	void *user_data;
+	/* Holds the key of the current member followed by the part of the
+	 * current string or number that came in the previous chunks.
+	 */
+	char *buf;
+	size_t buf_size;
+	size_t key_len;
+	size_t tok_len;
+	/* One bit per nesting level, set for objects */
+	uint32_t containers;
+	uint8_t depth;
+	uint8_t state;
+	/* Token being scanned, its type and scanning progress */
+	uint8_t tok_state;
+	uint8_t tok_type;
+	uint8_t tok_pos;
+	bool has_key;
+};
+
 
 struct json_obj_descr {
 	const char *field_name;
@@ -672,6 +738,58 @@ int json_arr_separate_object_parse_init(struct json_obj *json, char *payload, si
 int json_arr_separate_parse_object(struct json_obj *json, const struct json_obj_descr *descr,
 				   size_t descr_len, void *val);
 
+/**
+ * @brief Initialize the streaming parser
+ *
+ * The streaming parser takes a JSON document in chunks of any size, so
+ * that it does not have to be held in a single buffer, and reports every
+ * value it finds to @a cb as soon as the value is complete. It does not
+ * allocate memory, nor copy strings and numbers that are contained in a
+ * single chunk. Strings are not unescaped and numbers are not converted.
+ *
+ * @param stream Parser state
+ * @param buf Buffer holding the key of the current object member and the
+ * strings and numbers that span chunks
+ * @param buf_size Size of @a buf, which limits the length of the keys plus
+ * the length of the split values
+ * @param cb Callback called for every value
+ * @param user_data Pointer passed to @a cb
+ */
+void json_stream_init(struct json_stream *stream, char *buf, size_t buf_size,
+		      json_stream_cb_t cb, void *user_data);
+
+/**
+ * @brief Parse the next chunk of a JSON document
+ *
+ * @param stream Parser state
+ * @param data Chunk of the JSON document
+ * @param len Length of @a data
+ *
+ * @retval 0 The chunk has been parsed.
+ * @retval -EINVAL The document is not valid JSON.
+ * @retval -ENOMEM A key, or a value that spans chunks, does not fit the
+ * buffer of the parser.
+ * @retval -E2BIG The document is nested deeper than JSON_STREAM_MAX_DEPTH.
+ * @retval <0 Error returned by the callback.
+ *
+ * Once an error is returned, the parser must be initialized again.
+ */
+int json_stream_feed(struct json_stream *stream, const char *data, size_t len);
+
+/**
+ * @brief Finish parsing a JSON document
+ *
+ * Reports the top-level value if it is a number, as the end of the number
+ * is only known at the end of the document.
+ *
+ * @param stream Parser state
+ *
+ * @retval 0 A complete document has been parsed.
+ * @retval -EINVAL The document is incomplete or not valid JSON.
+ * @retval <0 Error returned by the callback.
+ */
+int json_stream_finish(struct json_stream *stream);
+
 /**
  * @brief Escapes the string so it can be used to encode JSON objects
  *
@@ -83,6 +83,20 @@ extern "C" {
 
 struct disk_operations;
 
+/**
+ * @brief Block cache statistics of a disk
+ */
+struct disk_cache_stats {
+	/** Sectors read from the cache */
+	uint32_t hits;
+	/** Sectors read from the disk on request */
+	uint32_t misses;
+	/** Sectors read from the disk ahead of a sequential read */
+	uint32_t read_ahead;
+	/** Dirty sectors written back to the disk */
+	uint32_t write_backs;
+};
+
 /**
  * @brief Disk info
  */
@@ -97,6 +111,20 @@ struct disk_info {
 	const struct device *dev;
 	/** Internally used disk reference count */
 	uint16_t refcnt;
+#if defined(CONFIG_DISK_CACHE) || defined(__DOXYGEN__)
+	/** Internally used lock of the block cache operations on the disk */
+	struct k_mutex cache_lock;
+	/** Internally used sector size for the block cache, 0 if not known yet */
+	uint32_t cache_sector_size;
+	/** Internally used sector count for the block cache */
+	uint32_t cache_sector_count;
+	/** Internally used sector following the last read, to detect sequential reads */
+	uint32_t cache_next_sector;
+#endif
+#if defined(CONFIG_DISK_CACHE_STATS) || defined(__DOXYGEN__)
+	/** Block cache statistics */
+	struct disk_cache_stats cache_stats;
+#endif
 };
 
 /**
@@ -536,6 +536,24 @@ struct sensor_decoder_api {
 	 * @return Whether the trigger is present in the buffer
 	 */
 	bool (*has_trigger)(const uint8_t *buffer, enum sensor_trigger_type trigger);
+
+	/**
+	 * @brief Decode samples from the buffer into a structure of arrays block
+	 *
+	 * Optional, decoders which don't implement it are served by
+	 * sensor_decode_block_generic(). Decoding stops when @p block is full, when the buffer
+	 * has no more samples or before a sample which would need a different shift.
+	 *
+	 * @param[in]     buffer The buffer provided on the @ref rtio context
+	 * @param[in]     channel The channel to decode
+	 * @param[in,out] fit The current frame iterator
+	 * @param[in,out] block The block to fill, up to its capacity
+	 * @return 0 no more samples to decode
+	 * @return >0 the number of decoded samples
+	 * @return <0 on error
+	 */
+	int (*decode_block)(const uint8_t *buffer, struct sensor_chan_spec channel, uint32_t *fit,
+			    struct sensor_q31_block *block);
 };
 
 /**
@@ -593,6 +611,49 @@ static inline int sensor_decode(struct sensor_decode_context *ctx, void *out, ui
 	return ctx->decoder->decode(ctx->buffer, ctx->channel, &ctx->fit, max_count, out);
 }
 
+/**
+ * @brief Decode a block of samples through the decoder's decode() function
+ *
+ * Fallback of sensor_decode_block() for decoders without a decode_block() function. The samples
+ * are decoded in chunks into a temporary buffer and scattered into the arrays of @p block.
+ *
+ * @param[in]     decoder The decoder to use
+ * @param[in]     buffer The buffer provided on the @ref rtio context
+ * @param[in]     channel The channel to decode
+ * @param[in,out] fit The current frame iterator
+ * @param[in,out] block The block to fill, up to its capacity
+ * @return 0 no more samples to decode
+ * @return >0 the number of decoded samples
+ * @return -ENOTSUP if the channel isn't decoded as three axis or q31 data
+ * @return <0 on other errors
+ */
+int sensor_decode_block_generic(const struct sensor_decoder_api *decoder, const uint8_t *buffer,
+				struct sensor_chan_spec channel, uint32_t *fit,
+				struct sensor_q31_block *block);
+
+/**
+ * @brief Decode a block of samples using a sensor_decode_context
+ *
+ * Decode as many samples of the context's channel as fit into @p block, converting a whole FIFO
+ * buffer in one call instead of one sensor_decode() call per frame. A block only holds samples
+ * with the same shift, keep calling until 0 is returned to consume the whole buffer.
+ *
+ * @param[in,out] ctx The context to use for decoding
+ * @param[in,out] block The block to fill, up to its capacity
+ * @return 0 no more samples to decode
+ * @return >0 the number of decoded samples
+ * @return <0 on error
+ */
+static inline int sensor_decode_block(struct sensor_decode_context *ctx,
+				      struct sensor_q31_block *block)
+{
+	if (ctx->decoder->decode_block != NULL) {
+		return ctx->decoder->decode_block(ctx->buffer, ctx->channel, &ctx->fit, block);
+	}
+	return sensor_decode_block_generic(ctx->decoder, ctx->buffer, ctx->channel, &ctx->fit,
+					   block);
+}
+
 int sensor_natively_supported_channel_size_info(struct sensor_chan_spec channel, size_t *base_size,
 						size_t *frame_size);
 
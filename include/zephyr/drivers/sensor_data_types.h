@@ -195,6 +195,27 @@ struct sensor_uint64_data {
 	(data_).header.base_timestamp_ns + (data_).readings[(readings_offset_)].timestamp_delta,   \
 		(data_).readings[(readings_offset_)].value
 
+/**
+ * Block of samples of a single channel decoded as structure of arrays, used by
+ * :c:func:`sensor_decode_block`.
+ *
+ * The arrays are provided by the caller and hold up to @p capacity samples each. Three axis
+ * channels (see :c:struct:`sensor_three_axis_data`) fill @p x, @p y and @p z, every other q31
+ * channel (see :c:struct:`sensor_q31_data`) only fills @p x. Any of @p timestamp_delta, @p y and
+ * @p z may be NULL if the caller doesn't need them. All samples of a block share one @p shift.
+ */
+struct sensor_q31_block {
+	/** Base timestamp of the block, reading_count is the number of decoded samples */
+	struct sensor_data_header header;
+	int8_t shift;
+	/** Number of elements in each of the arrays */
+	uint16_t capacity;
+	uint32_t *timestamp_delta;
+	q31_t *x;
+	q31_t *y;
+	q31_t *z;
+};
+
 #ifdef __cplusplus
 }
 #endif
@@ -464,6 +464,99 @@ int fs_truncate(struct fs_file_t *zfp, off_t length);
  */
 int fs_sync(struct fs_file_t *zfp);
 
+#if defined(CONFIG_FILE_SYSTEM_ASYNC) || defined(__DOXYGEN__)
+
+/**
+ * @brief Iodev flag syncing a file
+ *
+ * Set in the iodev_flags of a write or no-op submission to the IO device of a
+ * file, see fs_file_iodev(), to sync the file after writing.
+ */
+#define RTIO_IODEV_FS_SYNC BIT(0)
+
+/**
+ * @brief Get the IO device of an open file
+ *
+ * Submissions of reads, writes and no-ops to the IO device read from and write
+ * to the file at its current position, like the functions below, and may be
+ * chained with submissions to other IO devices, e.g. a file write after a
+ * sensor read into the same buffer. Accesses to files are done in the order
+ * they are submitted.
+ *
+ * @note Enable with @kconfig{CONFIG_FILE_SYSTEM_ASYNC}
+ *
+ * @param zfp Pointer to the file object
+ *
+ * @return the IO device, NULL when invoked on zfp that represents an
+ * unopened/closed file.
+ */
+struct rtio_iodev *fs_file_iodev(struct fs_file_t *zfp);
+
+/**
+ * @brief Queue a read from a file
+ *
+ * Submits a read like fs_read() to the RTIO context and returns without
+ * waiting for it. Its completion has the number of bytes read or a negative
+ * errno code as result, and @p userdata.
+ *
+ * @note Enable with @kconfig{CONFIG_FILE_SYSTEM_ASYNC}
+ *
+ * @param r RTIO context to submit to
+ * @param zfp Pointer to the file object, must be kept open until completion
+ * @param ptr Pointer to the data buffer, must be kept until completion
+ * @param size Number of bytes to be read
+ * @param userdata Passed to the completion
+ *
+ * @retval 0 on success;
+ * @retval -EBADF when invoked on zfp that represents unopened/closed file;
+ * @retval -ENOMEM when the submission queue of @p r is full.
+ */
+int fs_read_async(struct rtio *r, struct fs_file_t *zfp, void *ptr, size_t size,
+		  void *userdata);
+
+/**
+ * @brief Queue a write to a file
+ *
+ * Submits a write like fs_write() to the RTIO context and returns without
+ * waiting for it. Its completion has the number of bytes written or a
+ * negative errno code as result, and @p userdata.
+ *
+ * @note Enable with @kconfig{CONFIG_FILE_SYSTEM_ASYNC}
+ *
+ * @param r RTIO context to submit to
+ * @param zfp Pointer to the file object, must be kept open until completion
+ * @param ptr Pointer to the data buffer, must be kept until completion
+ * @param size Number of bytes to be written
+ * @param userdata Passed to the completion
+ *
+ * @retval 0 on success;
+ * @retval -EBADF when invoked on zfp that represents unopened/closed file;
+ * @retval -ENOMEM when the submission queue of @p r is full.
+ */
+int fs_write_async(struct rtio *r, struct fs_file_t *zfp, const void *ptr, size_t size,
+		   void *userdata);
+
+/**
+ * @brief Queue a sync of a file
+ *
+ * Submits a sync like fs_sync() to the RTIO context and returns without
+ * waiting for it. Its completion has 0 or a negative errno code as result,
+ * and @p userdata.
+ *
+ * @note Enable with @kconfig{CONFIG_FILE_SYSTEM_ASYNC}
+ *
+ * @param r RTIO context to submit to
+ * @param zfp Pointer to the file object, must be kept open until completion
+ * @param userdata Passed to the completion
+ *
+ * @retval 0 on success;
+ * @retval -EBADF when invoked on zfp that represents unopened/closed file;
+ * @retval -ENOMEM when the submission queue of @p r is full.
+ */
+int fs_sync_async(struct rtio *r, struct fs_file_t *zfp, void *userdata);
+
+#endif /* CONFIG_FILE_SYSTEM_ASYNC */
+
 /**
  * @brief Directory create
  *
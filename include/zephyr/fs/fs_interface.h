@@ -9,6 +9,10 @@
 
 #include <stdint.h>
 
+#if defined(CONFIG_FILE_SYSTEM_ASYNC)
+#include <zephyr/rtio/rtio.h>
+#endif
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -80,6 +84,10 @@ struct fs_file_t {
 	const struct fs_mount_t *mp;
 	/** Open/create flags */
 	fs_mode_t flags;
+#if defined(CONFIG_FILE_SYSTEM_ASYNC) || defined(__DOXYGEN__)
+	/** IO device the asynchronous accesses to the file are submitted to */
+	struct rtio_iodev iodev;
+#endif
 };
 
 /**
@@ -199,6 +199,23 @@ struct fs_file_system_t {
 	 * @note This operation destroys existing data on the target device.
 	 */
 	int (*mkfs)(uintptr_t dev_id, void *cfg, int flags);
+#endif
+#if defined(CONFIG_FILE_SYSTEM_ASYNC) || defined(__DOXYGEN__)
+	/**
+	 * Starts an asynchronous access to a file, optional.
+	 * Available only if @kconfig{CONFIG_FILE_SYSTEM_ASYNC} is enabled.
+	 *
+	 * Called on the thread submitting the access, which must be completed
+	 * with rtio_iodev_sqe_ok() or rtio_iodev_sqe_err(), for instance
+	 * once the storage DMA transfer into or from its buffer is done.
+	 * Without it, accesses are done with the synchronous operations on
+	 * the file system worker thread.
+	 *
+	 * @param filp File to access.
+	 * @param iodev_sqe Access to start, see fs_read_async(),
+	 *                  fs_write_async() and fs_sync_async().
+	 */
+	void (*submit)(struct fs_file_t *filp, struct rtio_iodev_sqe *iodev_sqe);
 #endif
 	/** @} */
 };
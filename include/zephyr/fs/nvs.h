@@ -62,6 +62,12 @@ struct nvs_fs {
 #if CONFIG_NVS_LOOKUP_CACHE
 	uint32_t lookup_cache[CONFIG_NVS_LOOKUP_CACHE_SIZE];
 #endif
+#if CONFIG_NVS_BACKGROUND_GC
+	/** Background garbage collection work */
+	struct k_work bg_gc_work;
+	/** Free space in the active sector when it was started */
+	uint32_t bg_gc_start_free;
+#endif
 };
 
 /**
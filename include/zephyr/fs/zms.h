@@ -64,6 +64,10 @@ struct zms_fs {
 #if CONFIG_ZMS_LOOKUP_CACHE
 	/** Lookup table used to cache ATE addresses of written IDs */
 	uint64_t lookup_cache[CONFIG_ZMS_LOOKUP_CACHE_SIZE];
+	/** IDs of the ATE addresses in the lookup table */
+	uint32_t lookup_cache_id[CONFIG_ZMS_LOOKUP_CACHE_SIZE];
+	/** Per lookup table set, ATE address to search the IDs missing from the set from */
+	uint64_t lookup_cache_evicted[CONFIG_ZMS_LOOKUP_CACHE_SIZE / CONFIG_ZMS_LOOKUP_CACHE_WAYS];
 #endif
 };
 
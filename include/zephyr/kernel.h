@@ -1550,8 +1550,8 @@ const char *k_thread_state_str(k_tid_t thread_id, char *buf, size_t buf_size);
 struct k_timer {
 	/*
 	 * _timeout structure must be first here if we want to use
-	 * dynamic timer allocation. timeout.node is used in the double-linked
-	 * list of free timers
+	 * dynamic timer allocation. timeout.node links the timer into the
+	 * timeout queue, a list or a tree depending on the backend.
 	 */
 	struct _timeout timeout;
 
@@ -5569,6 +5569,10 @@ struct k_heap {
 	struct sys_heap heap;
 	_wait_q_t wait_q;
 	struct k_spinlock lock;
+#ifdef CONFIG_SYS_HEAP_CACHE
+	/* Threads in wait_q, or about to pend there */
+	atomic_t waiters;
+#endif
 };
 
 /**
@@ -117,6 +117,11 @@ struct _thread_base {
 	/* Recursive count of irq_lock() calls */
 	uint8_t global_lock_count;
 
+#ifdef CONFIG_SCHED_PER_CPU_RUNQ
+	/* CPU whose run queue holds this thread while it is queued */
+	uint8_t runq_cpu;
+#endif /* CONFIG_SCHED_PER_CPU_RUNQ */
+
 #endif /* CONFIG_SMP */
 
 #ifdef CONFIG_SCHED_CPU_MASK
@@ -140,6 +140,11 @@ struct _ready_q {
 #elif defined(CONFIG_SCHED_MULTIQ)
 	struct _priq_mq runq;
 #endif
+
+#ifdef CONFIG_SCHED_PER_CPU_RUNQ
+	/* best queued thread regardless of CPU masks, or NULL */
+	struct k_thread *head;
+#endif
 };
 
 typedef struct _ready_q _ready_q_t;
@@ -157,7 +162,7 @@ struct _cpu {
 	/* one assigned idle thread per CPU */
 	struct k_thread *idle_thread;
 
-#ifdef CONFIG_SCHED_CPU_MASK_PIN_ONLY
+#if defined(CONFIG_SCHED_CPU_MASK_PIN_ONLY) || defined(CONFIG_SCHED_PER_CPU_RUNQ)
 	struct _ready_q ready_q;
 #endif
 
@@ -213,7 +218,7 @@ struct z_kernel {
 	 * ready queue: can be big, keep after small fields, since some
 	 * assembly (e.g. ARC) are limited in the encoding of the offset
 	 */
-#ifndef CONFIG_SCHED_CPU_MASK_PIN_ONLY
+#if !defined(CONFIG_SCHED_CPU_MASK_PIN_ONLY) && !defined(CONFIG_SCHED_PER_CPU_RUNQ)
 	struct _ready_q ready_q;
 #endif
 
@@ -309,10 +314,19 @@ struct _timeout;
 typedef void (*_timeout_func_t)(struct _timeout *t);
 
 struct _timeout {
+#ifdef CONFIG_TIMEOUT_QUEUE_SCALABLE
+	struct rbnode node;
+	/* Insertion order among equal expiries, zero when not queued */
+	uint32_t order_key;
+#else
 	sys_dnode_t node;
+#endif
 	_timeout_func_t fn;
 #ifdef CONFIG_TIMEOUT_64BIT
-	/* Can't use k_ticks_t for header dependency reasons */
+	/* Can't use k_ticks_t for header dependency reasons.  With
+	 * CONFIG_TIMEOUT_QUEUE_SCALABLE this holds the absolute expiry
+	 * tick, otherwise the delta from the preceding queued timeout.
+	 */
 	int64_t dticks;
 #else
 	int32_t dticks;
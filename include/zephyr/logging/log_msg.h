@@ -232,8 +232,9 @@ enum z_log_msg_mode {
 #define _LOG_MSG_SIMPLE_XXXX0 1
 #define _LOG_MSG_SIMPLE_XXXX1 1
 #define _LOG_MSG_SIMPLE_XXXX2 1
+#define _LOG_MSG_SIMPLE_XXXX3 1
 
-/* Determine if amount of arguments (less than 3) qualifies to  simple message. */
+/* Determine if amount of arguments (less than 4) qualifies to  simple message. */
 #define LOG_MSG_SIMPLE_ARG_CNT_CHECK(...) \
 	COND_CODE_1(UTIL_CAT(_LOG_MSG_SIMPLE_XXXX, NUM_VA_ARGS_LESS_1(__VA_ARGS__)), (1), (0))
 
@@ -242,6 +243,9 @@ enum z_log_msg_mode {
 #define LOG_MSG_SIMPLE_ARG_TYPE_CHECK_1(fmt, arg) Z_CBPRINTF_IS_WORD_NUM(arg)
 #define LOG_MSG_SIMPLE_ARG_TYPE_CHECK_2(fmt, arg0, arg1) \
 	Z_CBPRINTF_IS_WORD_NUM(arg0) && Z_CBPRINTF_IS_WORD_NUM(arg1)
+#define LOG_MSG_SIMPLE_ARG_TYPE_CHECK_3(fmt, arg0, arg1, arg2) \
+	Z_CBPRINTF_IS_WORD_NUM(arg0) && Z_CBPRINTF_IS_WORD_NUM(arg1) && \
+	Z_CBPRINTF_IS_WORD_NUM(arg2)
 
 /** brief Determine if string arguments types allow to use simplified message creation mode.
  *
@@ -254,7 +258,7 @@ enum z_log_msg_mode {
  *
  * Following conditions must be met:
  * - 32 bit platform
- * - Number of arguments from 0 to 2
+ * - Number of arguments from 0 to 3
  * - Type of an argument must be a numeric value that fits in 32 bit word.
  *
  * @param ... String with arguments.
@@ -279,9 +283,17 @@ enum z_log_msg_mode {
 			(uint32_t)(uintptr_t)GET_ARG_N(2, __VA_ARGS__), \
 			(uint32_t)(uintptr_t)GET_ARG_N(3, __VA_ARGS__))
 
+/* Helper macro for handing log with three arguments. Macro casts arguments to uint32_t.
+ */
+#define Z_LOG_MSG_SIMPLE_CREATE_3(_source, _level, ...) \
+	z_log_msg_simple_create_3(_source, _level, GET_ARG_N(1, __VA_ARGS__), \
+			(uint32_t)(uintptr_t)GET_ARG_N(2, __VA_ARGS__), \
+			(uint32_t)(uintptr_t)GET_ARG_N(3, __VA_ARGS__), \
+			(uint32_t)(uintptr_t)GET_ARG_N(4, __VA_ARGS__))
+
 /* Call specific function based on the number of arguments.
- * Since up 2 to arguments are supported COND_CODE_0 and COND_CODE_1 can be used to
- * handle all cases (0, 1 and 2 arguments). When tracing is enable then for each
+ * Since up to 3 arguments are supported COND_CODE_0 and COND_CODE_1 can be used to
+ * handle all cases (0, 1, 2 and 3 arguments). When tracing is enable then for each
  * function a macro is create. The difference between function and macro is that
  * macro is applied to any input arguments so we need to make sure that it is
  * always called with proper number of arguments. For that it is wrapped around
@@ -293,10 +305,13 @@ enum z_log_msg_mode {
 			(z_log_msg_simple_create_0(_source, _level, GET_ARG_N(1, __VA_ARGS__))), \
 			(COND_CODE_1(arg_cnt, ( \
 			    Z_LOG_MSG_SIMPLE_CREATE_1(_source, _level, __VA_ARGS__, dummy) \
-			    ), ( \
+			    ), (COND_CODE_1(UTIL_DEC(arg_cnt), ( \
 			    Z_LOG_MSG_SIMPLE_CREATE_2(_source, _level, __VA_ARGS__, dummy, dummy) \
-			    ) \
-			)))
+			    ), ( \
+			    Z_LOG_MSG_SIMPLE_CREATE_3(_source, _level, __VA_ARGS__, \
+						      dummy, dummy, dummy) \
+			    )) \
+			))))
 
 /** @brief Call specific function to create a log message.
  *
@@ -313,7 +328,7 @@ enum z_log_msg_mode {
 /** @brief Create log message using simplified method.
  *
  * Macro is gated by the argument count check to run @ref LOG_MSG_SIMPLE_FUNC only
- * on entries with 2 or less arguments.
+ * on entries with 3 or less arguments.
  *
  * @param _domain_id	Domain ID.
  * @param _source	Pointer to the source structure.
@@ -640,6 +655,19 @@ __syscall void z_log_msg_simple_create_1(const void *source, uint32_t level,
 __syscall void z_log_msg_simple_create_2(const void *source, uint32_t level,
 					 const char *fmt, uint32_t arg0, uint32_t arg1);
 
+/** @brief Create log message using simplified method for string with three arguments.
+ *
+ * @param source Pointer to the source structure.
+ * @param level  Severity level.
+ * @param fmt    String pointer.
+ * @param arg0   String argument.
+ * @param arg1   String argument.
+ * @param arg2   String argument.
+ */
+__syscall void z_log_msg_simple_create_3(const void *source, uint32_t level,
+					 const char *fmt, uint32_t arg0, uint32_t arg1,
+					 uint32_t arg2);
+
 /** @brief Create a logging message from message details and string package.
  *
  * @param source Source.
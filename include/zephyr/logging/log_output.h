@@ -90,6 +90,12 @@ struct log_output_control_block {
 	atomic_t offset;
 	void *ctx;
 	const char *hostname;
+#ifdef CONFIG_LOG_DICTIONARY_SUPPORT
+	/* Timestamp of the previous compact dictionary message. */
+	log_timestamp_t dict_timestamp;
+	/* Compact dictionary messages sent since the last absolute timestamp. */
+	uint32_t dict_ts_count;
+#endif
 };
 
 /** @brief Log_output instance structure. */
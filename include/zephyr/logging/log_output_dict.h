@@ -23,8 +23,32 @@ extern "C" {
 enum log_dict_output_msg_type {
 	MSG_NORMAL = 0,
 	MSG_DROPPED_MSG = 1,
+	MSG_NORMAL_COMPACT = 2,
 };
 
+/**
+ * Compact dictionary based log message.
+ *
+ * All multi-byte fields are unsigned LEB128 varints:
+ *
+ * - uint8_t type (MSG_NORMAL_COMPACT)
+ * - varint length of the rest of the message in bytes
+ * - uint8_t level (bits 0-2), domain (bits 3-6) and
+ *   LOG_DICT_COMPACT_TS_ABSOLUTE (bit 7)
+ * - varint source ID
+ * - varint timestamp, relative to the timestamp of the previous message
+ *   unless LOG_DICT_COMPACT_TS_ABSOLUTE is set. It is set on the first
+ *   message, when the timestamp wrapped around, and at least every
+ *   CONFIG_LOG_DICTIONARY_COMPACT_TS_SYNC_INTERVAL messages so that a
+ *   decoder can resynchronize after a lost message.
+ * - varint hexdump data length
+ * - one varint per 32 bit word of the package arguments, including the
+ *   package header
+ * - package appended string indexes and strings as is
+ * - hexdump data as is
+ */
+#define LOG_DICT_COMPACT_TS_ABSOLUTE BIT(7)
+
 /**
  * Output header for one dictionary based log message.
  */
@@ -59,6 +83,20 @@ struct log_dict_output_dropped_msg_t {
 void log_dict_output_msg_process(const struct log_output *log_output,
 				 struct log_msg *msg, uint32_t flags);
 
+/** @brief Process log messages for dictionary-based logging in compact format.
+ *
+ * Same as @ref log_dict_output_msg_process but the message is encoded as
+ * described for @ref MSG_NORMAL_COMPACT. Used by
+ * @ref log_dict_output_msg_process when CONFIG_LOG_DICTIONARY_COMPACT is
+ * enabled.
+ *
+ * @param log_output Pointer to the log output instance.
+ * @param msg Log message.
+ * @param flags Optional flags.
+ */
+void log_dict_output_compact_msg_process(const struct log_output *log_output,
+					 struct log_msg *msg, uint32_t flags);
+
 /** @brief Process dropped messages indication for dictionary-based logging.
  *
  * Function prints error message indicating lost log messages.
@@ -214,6 +214,12 @@ enum ethernet_hw_caps {
 
 	/** 5 Gbits link supported */
 	ETHERNET_LINK_5000BASE_T	= BIT(22),
+
+	/** TCP segmentation offload (TSO) supported. The driver splits TCP
+	 * packets larger than the MTU into segments of net_pkt_gso_size()
+	 * bytes and calculates the IP and TCP checksums of every segment.
+	 */
+	ETHERNET_HW_TX_TSO		= BIT(23),
 };
 
 /** @cond INTERNAL_HIDDEN */
@@ -288,6 +288,16 @@ __net_socket struct net_context {
 		/** Mutex used by condition variable */
 		struct k_mutex *lock;
 	} cond;
+
+#if defined(CONFIG_NET_SOCKETS_EPOLL)
+	/** Epoll interest set entries watching this socket */
+	sys_slist_t epoll_watch;
+#endif /* CONFIG_NET_SOCKETS_EPOLL */
+
+#if defined(CONFIG_NET_SOCKETS_ZEROCOPY_RX)
+	/** Number of network buffers lent by zsock_recv_zc() */
+	atomic_t zc_lent;
+#endif /* CONFIG_NET_SOCKETS_ZEROCOPY_RX */
 #endif /* CONFIG_NET_SOCKETS */
 
 #if defined(CONFIG_NET_OFFLOAD)
@@ -227,6 +227,12 @@ struct net_pkt {
 #if defined(CONFIG_NET_IP_FRAGMENT)
 	uint8_t ip_reassembled : 1; /* Packet is a reassembled IP packet. */
 #endif
+#if defined(CONFIG_NET_TCP_GRO)
+	uint8_t tcp_gro : 1; /* TCP packet has passed the GRO stage, which has
+			      * verified the checksum of every coalesced
+			      * segment.
+			      */
+#endif
 #if defined(CONFIG_NET_PKT_TIMESTAMP)
 	uint8_t tx_timestamping : 1; /** Timestamp transmitted packet */
 	uint8_t rx_timestamping : 1; /** Timestamp received packet */
@@ -303,6 +309,14 @@ struct net_pkt {
 	uint16_t vlan_tci;
 #endif /* CONFIG_NET_VLAN */
 
+#if defined(CONFIG_NET_TCP_GSO)
+	/* If non-zero, this TCP packet carries more data than fits into one
+	 * segment, and is split into segments of this size before it is
+	 * sent out.
+	 */
+	uint16_t gso_size;
+#endif /* CONFIG_NET_TCP_GSO */
+
 #if defined(NET_PKT_HAS_CONTROL_BLOCK)
 	/* TODO: Evolve this into a union of orthogonal
 	 *       control block declarations if further L2
@@ -988,6 +1002,31 @@ static inline void net_pkt_set_ip_reassembled(struct net_pkt *pkt,
 }
 #endif /* CONFIG_NET_IP_FRAGMENT */
 
+#if defined(CONFIG_NET_TCP_GRO)
+static inline bool net_pkt_is_tcp_gro(struct net_pkt *pkt)
+{
+	return !!(pkt->tcp_gro);
+}
+
+static inline void net_pkt_set_tcp_gro(struct net_pkt *pkt, bool is_gro)
+{
+	pkt->tcp_gro = is_gro;
+}
+#else /* CONFIG_NET_TCP_GRO */
+static inline bool net_pkt_is_tcp_gro(struct net_pkt *pkt)
+{
+	ARG_UNUSED(pkt);
+
+	return false;
+}
+
+static inline void net_pkt_set_tcp_gro(struct net_pkt *pkt, bool is_gro)
+{
+	ARG_UNUSED(pkt);
+	ARG_UNUSED(is_gro);
+}
+#endif /* CONFIG_NET_TCP_GRO */
+
 static inline uint8_t net_pkt_priority(struct net_pkt *pkt)
 {
 	return pkt->priority;
@@ -1113,6 +1152,31 @@ static inline void net_pkt_set_vlan_tci(struct net_pkt *pkt, uint16_t tci)
 }
 #endif
 
+#if defined(CONFIG_NET_TCP_GSO)
+static inline uint16_t net_pkt_gso_size(struct net_pkt *pkt)
+{
+	return pkt->gso_size;
+}
+
+static inline void net_pkt_set_gso_size(struct net_pkt *pkt, uint16_t size)
+{
+	pkt->gso_size = size;
+}
+#else
+static inline uint16_t net_pkt_gso_size(struct net_pkt *pkt)
+{
+	ARG_UNUSED(pkt);
+
+	return 0U;
+}
+
+static inline void net_pkt_set_gso_size(struct net_pkt *pkt, uint16_t size)
+{
+	ARG_UNUSED(pkt);
+	ARG_UNUSED(size);
+}
+#endif /* CONFIG_NET_TCP_GSO */
+
 #if defined(CONFIG_NET_PKT_TIMESTAMP) || defined(CONFIG_NET_PKT_TXTIME)
 static inline struct net_ptp_time *net_pkt_timestamp(struct net_pkt *pkt)
 {
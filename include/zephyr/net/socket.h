@@ -31,6 +31,7 @@
 #include <zephyr/net/net_ip.h>
 #include <zephyr/net/socket_select.h>
 #include <zephyr/net/socket_poll.h>
+#include <zephyr/net/socket_epoll.h>
 #include <zephyr/sys/iterable_sections.h>
 #include <zephyr/sys/fdtable.h>
 #include <zephyr/net/dns_resolve.h>
@@ -516,6 +517,92 @@ static inline ssize_t zsock_recv(int sock, void *buf, size_t max_len,
 	return zsock_recvfrom(sock, buf, max_len, flags, NULL, NULL);
 }
 
+struct net_buf;
+
+/**
+ * @brief Receive data without copying it out of the network buffers
+ *
+ * @details
+ * Instead of copying the received data into a user buffer, the network
+ * buffer fragments holding the payload of the next received packet are
+ * detached from the packet and lent to the caller. The data starts at the
+ * beginning of the first fragment. For a datagram socket the fragments hold
+ * one whole datagram, for a stream socket the unread data of the next
+ * received segment.
+ *
+ * The fragments must be given back with zsock_recv_zc_release() once the
+ * application is done with them. For stream sockets the receive window is
+ * only reopened when the data is released, so held fragments count against
+ * the window like unread data does. At most
+ * @kconfig{CONFIG_NET_SOCKETS_ZEROCOPY_RX_MAX_BUFS} fragments can be held per
+ * socket, further calls fail with ENOBUFS until some are released.
+ *
+ * Only native network sockets are supported, and this function is not
+ * available from user mode threads. Available if
+ * @kconfig{CONFIG_NET_SOCKETS_ZEROCOPY_RX} is enabled.
+ *
+ * @param sock Socket to receive from.
+ * @param frags Set to the lent fragment chain on success, NULL at the end of
+ *        a stream.
+ * @param flags Only ZSOCK_MSG_DONTWAIT is supported.
+ * @param src_addr Source address of the data, or NULL.
+ * @param addrlen Length of @p src_addr on input, length of the source
+ *        address on output.
+ *
+ * @return Number of bytes in @p frags, 0 at the end of a stream, -1 on error
+ *         with errno set.
+ */
+ssize_t zsock_recv_zc(int sock, struct net_buf **frags, int flags,
+		      struct sockaddr *src_addr, socklen_t *addrlen);
+
+/**
+ * @brief Release fragments obtained with zsock_recv_zc()
+ *
+ * @details
+ * The fragments are freed and, for a stream socket, the receive window is
+ * reopened by their length. The fragments are released against the network
+ * context they were received on, which stays allocated until then, so this
+ * also works after the socket has been closed or its descriptor reused.
+ * Available if @kconfig{CONFIG_NET_SOCKETS_ZEROCOPY_RX} is enabled.
+ *
+ * @param frags Whole fragment chain returned by zsock_recv_zc().
+ *
+ * @return 0 on success, -1 on error with errno set.
+ */
+int zsock_recv_zc_release(struct net_buf *frags);
+
+/** Callback telling that the buffers given to zsock_sendmsg_zc() are released */
+typedef void (*zsock_send_zc_cb_t)(void *user_data);
+
+/**
+ * @brief Send data without copying it into network buffers
+ *
+ * @details
+ * The data pointed to by the iovecs of @p msg is queued for transmission
+ * as is, the TCP segments refer to it instead of holding a copy. The data
+ * must stay valid and unmodified until @p cb is called, which happens once
+ * the peer has acknowledged all of the data queued by this call and no
+ * segment refers to it anymore, or once the connection is released.
+ *
+ * Like zsock_sendmsg(), this may queue less than the whole message. @p cb
+ * is called exactly once if a positive value is returned and never
+ * otherwise, it runs in the network stack and must not block.
+ *
+ * Only native TCP sockets are supported, and this function is not available
+ * from user mode threads. Available if
+ * @kconfig{CONFIG_NET_SOCKETS_ZEROCOPY_TX} is enabled.
+ *
+ * @param sock Socket to send on.
+ * @param msg Data to send, msg_name and msg_control are ignored.
+ * @param flags Only ZSOCK_MSG_DONTWAIT is supported.
+ * @param cb Release callback.
+ * @param user_data User data passed to @p cb.
+ *
+ * @return Number of bytes queued on success, -1 on error with errno set.
+ */
+ssize_t zsock_sendmsg_zc(int sock, const struct msghdr *msg, int flags,
+			 zsock_send_zc_cb_t cb, void *user_data);
+
 /**
  * @brief Control blocking/non-blocking mode of a socket
  *
@@ -0,0 +1,134 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/** @file socket_epoll.h
+ *
+ * @brief Scalable socket readiness notification (epoll-like) API.
+ */
+
+#ifndef ZEPHYR_INCLUDE_NET_SOCKET_EPOLL_H_
+#define ZEPHYR_INCLUDE_NET_SOCKET_EPOLL_H_
+
+/**
+ * @brief BSD Sockets compatible API
+ * @defgroup bsd_sockets BSD Sockets compatible API
+ * @ingroup networking
+ * @{
+ */
+
+#include <stdint.h>
+
+#include <zephyr/net/socket_poll.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ZSOCK_EPOLL* event values are compatible with Linux and ZSOCK_POLL* */
+/** zsock_epoll: Readable */
+#define ZSOCK_EPOLLIN 0x001
+/** zsock_epoll: Exceptional condition */
+#define ZSOCK_EPOLLPRI 0x002
+/** zsock_epoll: Writable */
+#define ZSOCK_EPOLLOUT 0x004
+/** zsock_epoll: Error condition (output value only) */
+#define ZSOCK_EPOLLERR 0x008
+/** zsock_epoll: Closed connection (output value only) */
+#define ZSOCK_EPOLLHUP 0x010
+
+/** zsock_epoll_ctl: Add a file descriptor to the interest set */
+#define ZSOCK_EPOLL_CTL_ADD 1
+/** zsock_epoll_ctl: Remove a file descriptor from the interest set */
+#define ZSOCK_EPOLL_CTL_DEL 2
+/** zsock_epoll_ctl: Change the events of a file descriptor in the interest set */
+#define ZSOCK_EPOLL_CTL_MOD 3
+
+/** User data returned together with the events of a file descriptor. */
+union zsock_epoll_data {
+	void *ptr;    /**< Pointer */
+	int fd;       /**< File descriptor */
+	uint32_t u32; /**< 32-bit value */
+	uint64_t u64; /**< 64-bit value */
+};
+
+/** Event description used by zsock_epoll_ctl() and zsock_epoll_wait(). */
+struct zsock_epoll_event {
+	uint32_t events;             /**< ZSOCK_EPOLL* event mask */
+	union zsock_epoll_data data; /**< User data */
+};
+
+/**
+ * @brief Create an epoll instance
+ *
+ * @details
+ * An epoll instance holds a persistent set of file descriptors of interest.
+ * Unlike zsock_poll(), the set is registered once with zsock_epoll_ctl(),
+ * and native sockets report their readiness to the instance from the
+ * network stack, so zsock_epoll_wait() only has to look at the sockets that
+ * became ready instead of every socket in the set. Other file descriptors,
+ * and native TCP sockets waiting for ZSOCK_EPOLLOUT, are polled on every
+ * call, like with zsock_poll().
+ *
+ * Only level-triggered notification is supported. The instance is closed
+ * with zsock_close(), and can itself be polled for ZSOCK_POLLIN.
+ *
+ * This function is also exposed as `epoll_create1()`
+ * if @kconfig{CONFIG_POSIX_API} and @kconfig{CONFIG_EPOLL} are defined.
+ *
+ * @param flags Must be 0.
+ *
+ * @return File descriptor of the new instance on success, -1 on error
+ *         with errno set.
+ */
+int zsock_epoll_create(int flags);
+
+/**
+ * @brief Add, modify or remove an entry in the interest set of an epoll instance
+ *
+ * @details
+ * A file descriptor can be in the interest set of several instances. Native
+ * sockets are removed from all interest sets when they are closed, other
+ * file descriptors should be removed before they are closed.
+ * This function is also exposed as `epoll_ctl()`
+ * if @kconfig{CONFIG_POSIX_API} and @kconfig{CONFIG_EPOLL} are defined.
+ *
+ * @param epfd Epoll instance.
+ * @param op ZSOCK_EPOLL_CTL_ADD, ZSOCK_EPOLL_CTL_MOD or ZSOCK_EPOLL_CTL_DEL.
+ * @param fd File descriptor to operate on.
+ * @param event Events of interest and user data, ignored for
+ *        ZSOCK_EPOLL_CTL_DEL.
+ *
+ * @return 0 on success, -1 on error with errno set.
+ */
+int zsock_epoll_ctl(int epfd, int op, int fd, struct zsock_epoll_event *event);
+
+/**
+ * @brief Wait for events on an epoll instance
+ *
+ * @details
+ * This function is also exposed as `epoll_wait()`
+ * if @kconfig{CONFIG_POSIX_API} and @kconfig{CONFIG_EPOLL} are defined.
+ *
+ * @param epfd Epoll instance.
+ * @param events Array filled with the events of the ready file descriptors.
+ * @param maxevents Size of @p events, must be greater than 0.
+ * @param timeout Timeout in milliseconds, 0 to return immediately and
+ *        negative to wait forever.
+ *
+ * @return Number of ready file descriptors, 0 on timeout, -1 on error
+ *         with errno set.
+ */
+int zsock_epoll_wait(int epfd, struct zsock_epoll_event *events, int maxevents, int timeout);
+
+#ifdef __cplusplus
+}
+#endif
+
+/**
+ * @}
+ */
+
+#endif /* ZEPHYR_INCLUDE_NET_SOCKET_EPOLL_H_ */
@@ -53,6 +53,7 @@ struct zperf_download_params {
 	uint16_t port;
 	struct sockaddr addr;
 	char if_name[IFNAMSIZ];
+	bool zerocopy;
 };
 
 /** @endcond */
@@ -1070,6 +1070,27 @@ struct net_buf_data_alloc {
 
 /** @endcond */
 
+#if defined(CONFIG_NET_BUF_POOL_CACHE)
+/** @cond INTERNAL_HIDDEN */
+struct net_buf_pool_cpu_cache {
+	uint8_t count;
+	struct net_buf *bufs[CONFIG_NET_BUF_POOL_CACHE_SIZE];
+};
+/** @endcond */
+
+/**
+ * @brief Per-CPU cache of free buffers of a pool.
+ *
+ * Owned by the user, see net_buf_pool_cache_init().
+ */
+struct net_buf_pool_cache {
+	/** @cond INTERNAL_HIDDEN */
+	atomic_t waiters;
+	struct net_buf_pool_cpu_cache cpu[CONFIG_MP_MAX_NUM_CPUS];
+	/** @endcond */
+};
+#endif /* CONFIG_NET_BUF_POOL_CACHE */
+
 /**
  * @brief Network buffer pool representation.
  *
@@ -1113,6 +1134,11 @@ struct net_buf_pool {
 
 	/** Start of buffer storage array */
 	struct net_buf * const __bufs;
+
+#if defined(CONFIG_NET_BUF_POOL_CACHE)
+	/** Optional per-CPU cache of free buffers */
+	struct net_buf_pool_cache *cache;
+#endif
 };
 
 /** @cond INTERNAL_HIDDEN */
@@ -1390,6 +1416,83 @@ struct net_buf * __must_check net_buf_alloc_len(struct net_buf_pool *pool,
 						k_timeout_t timeout);
 #endif
 
+/**
+ * @brief Allocate a chain of variable length buffers from a pool.
+ *
+ * Allocate @p count buffers, each able to fit @p size bytes of data, and
+ * link them through their fragment pointers. The free buffers are taken
+ * from the pool in as few operations as possible, so this is cheaper
+ * than allocating the buffers one by one. The chain is freed with a
+ * single net_buf_unref() call on its head.
+ *
+ * The allocation is all-or-nothing. While waiting for buffers, none of
+ * them is held: a partial set goes back to the pool, where other
+ * allocations can use it, and the whole chain is tried for again.
+ *
+ * @param pool Which pool to allocate the buffers from.
+ * @param size Amount of data each buffer must be able to fit.
+ * @param count Number of buffers to allocate, at least one.
+ * @param timeout Affects the action taken should the pool not have
+ *        enough free buffers. If K_NO_WAIT, then return immediately.
+ *        If K_FOREVER, then wait as long as necessary. Otherwise, wait
+ *        until the specified timeout, which applies to the whole chain.
+ *
+ * @return Head of the chain or NULL if not all buffers could be allocated,
+ *         in which case none is kept.
+ */
+#if defined(CONFIG_NET_BUF_LOG)
+struct net_buf * __must_check net_buf_alloc_len_bulk_debug(struct net_buf_pool *pool,
+							   size_t size, size_t count,
+							   k_timeout_t timeout,
+							   const char *func, int line);
+#define net_buf_alloc_len_bulk(_pool, _size, _count, _timeout) \
+	net_buf_alloc_len_bulk_debug(_pool, _size, _count, _timeout, __func__, __LINE__)
+#else
+struct net_buf * __must_check net_buf_alloc_len_bulk(struct net_buf_pool *pool,
+						     size_t size, size_t count,
+						     k_timeout_t timeout);
+#endif
+
+/**
+ * @brief Allocate a chain of fixed buffers from a pool.
+ *
+ * @copydetails net_buf_alloc_len_bulk
+ */
+#define net_buf_alloc_bulk(_pool, _count, _timeout) \
+	net_buf_alloc_len_bulk(_pool, (_pool)->alloc->max_alloc_size, _count, _timeout)
+
+#if defined(CONFIG_NET_BUF_POOL_CACHE) || defined(__DOXYGEN__)
+/**
+ * @brief Attach a per-CPU cache of free buffers to a pool.
+ *
+ * Buffers freed on a CPU are kept in its cache, up to
+ * CONFIG_NET_BUF_POOL_CACHE_SIZE of them, and allocations on the same
+ * CPU take them from there without touching the pool. This suits pools
+ * which are allocated from and freed to at a high rate.
+ *
+ * Buffers cached by one CPU are not available to allocations on other
+ * CPUs, so the pool needs that many more buffers on SMP systems. While an
+ * allocation is waiting for a buffer, freed buffers bypass the caches.
+ *
+ * Must be called before the first allocation from the pool.
+ *
+ * @param pool Pool to attach the cache to.
+ * @param cache Cache storage, it must not be used by another pool.
+ */
+void net_buf_pool_cache_init(struct net_buf_pool *pool, struct net_buf_pool_cache *cache);
+
+/**
+ * @brief Return the buffers cached by the current CPU to the pool.
+ *
+ * @param pool Pool with a cache attached.
+ */
+void net_buf_pool_cache_flush(struct net_buf_pool *pool);
+
+/** @cond INTERNAL_HIDDEN */
+bool net_buf_pool_cache_put(struct net_buf_pool *pool, struct net_buf *buf);
+/** @endcond */
+#endif /* CONFIG_NET_BUF_POOL_CACHE */
+
 /**
  * @brief Allocate a new buffer from a pool but with external data pointer.
  *
@@ -1466,6 +1569,12 @@ static inline void net_buf_destroy(struct net_buf *buf)
 		buf->__buf = NULL;
 	}
 
+#if defined(CONFIG_NET_BUF_POOL_CACHE)
+	if (pool->cache != NULL && net_buf_pool_cache_put(pool, buf)) {
+		return;
+	}
+#endif
+
 	k_lifo_put(&pool->free, buf);
 }
 
@@ -1519,6 +1628,8 @@ __deprecated void net_buf_put(struct k_fifo *fifo, struct net_buf *buf);
  * @brief Decrements the reference count of a buffer.
  *
  * The buffer is put back into the pool if the reference count reaches zero.
+ * The same is done for its fragments, the ones from the same pool are put
+ * back in one operation.
  *
  * @param buf A valid pointer on a buffer
  */
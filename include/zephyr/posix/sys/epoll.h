@@ -0,0 +1,40 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_INCLUDE_POSIX_SYS_EPOLL_H_
+#define ZEPHYR_INCLUDE_POSIX_SYS_EPOLL_H_
+
+#include <zephyr/net/socket_epoll.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define epoll_data zsock_epoll_data
+#define epoll_event zsock_epoll_event
+
+typedef union zsock_epoll_data epoll_data_t;
+
+#define EPOLLIN ZSOCK_EPOLLIN
+#define EPOLLPRI ZSOCK_EPOLLPRI
+#define EPOLLOUT ZSOCK_EPOLLOUT
+#define EPOLLERR ZSOCK_EPOLLERR
+#define EPOLLHUP ZSOCK_EPOLLHUP
+
+#define EPOLL_CTL_ADD ZSOCK_EPOLL_CTL_ADD
+#define EPOLL_CTL_DEL ZSOCK_EPOLL_CTL_DEL
+#define EPOLL_CTL_MOD ZSOCK_EPOLL_CTL_MOD
+
+int epoll_create(int size);
+int epoll_create1(int flags);
+int epoll_ctl(int epfd, int op, int fd, struct epoll_event *event);
+int epoll_wait(int epfd, struct epoll_event *events, int maxevents, int timeout);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_POSIX_SYS_EPOLL_H_ */
@@ -269,6 +269,7 @@ struct rtio_sqe_pool;
 struct rtio_cqe_pool;
 struct rtio_iodev;
 struct rtio_iodev_sqe;
+struct rtio_iodev_worker;
 /** @endcond */
 
 /**
@@ -520,6 +521,11 @@ struct rtio_iodev {
 
 	/* Data associated with this iodev */
 	void *data;
+
+#ifdef CONFIG_RTIO_WORKER
+	/* Worker submitting to this iodev, NULL to submit on the caller's thread */
+	struct rtio_iodev_worker *worker;
+#endif
 };
 
 /** An operation that does nothing and will complete immediately */
@@ -833,6 +839,78 @@ static inline void rtio_block_pool_free(struct rtio *r, void *buf, uint32_t buf_
 		.data = (iodev_data),				\
 	}
 
+#if defined(CONFIG_RTIO_WORKER) || defined(__DOXYGEN__)
+
+/** @cond INTERNAL_HIDDEN */
+#define Z_RTIO_WORKER_CONTEXTS 4
+/** @endcond */
+
+/**
+ * @brief A thread submitting to the iodevs of a bus
+ *
+ * Submissions to the iodevs attached to a worker are put in the worker's
+ * lock-free queue by the executor and given to the iodevs on the worker's
+ * thread, so that iodevs doing blocking transfers do not hold up the
+ * submitting thread or the iodevs of other buses. Completions made on the
+ * worker's thread are notified to the waiters once for a whole batch.
+ */
+struct rtio_iodev_worker {
+	/* Submissions to give to the iodevs */
+	struct mpsc sq;
+
+	/* Given once for each submission put in the queue */
+	struct k_sem *sem;
+
+	/* The worker's thread, set once it runs */
+	k_tid_t thread;
+
+	/* Completions of the current batch, per context, not yet notified */
+	struct rtio *cq_ctx[Z_RTIO_WORKER_CONTEXTS];
+	uint16_t cq_pending[Z_RTIO_WORKER_CONTEXTS];
+	uint16_t cq_count;
+};
+
+/** @cond INTERNAL_HIDDEN */
+void rtio_iodev_worker_thread(void *p1, void *p2, void *p3);
+void rtio_iodev_worker_submit(struct rtio_iodev_worker *worker,
+			      struct rtio_iodev_sqe *iodev_sqe);
+void rtio_iodev_worker_cqe_submit(struct rtio_iodev_worker *worker, struct rtio *r,
+				  int result, void *userdata, uint32_t flags);
+/** @endcond */
+
+/**
+ * @brief Statically define and start an iodev worker
+ *
+ * @param name Name of the worker
+ * @param stack_size Stack size of the worker's thread
+ * @param prio Priority of the worker's thread
+ */
+#define RTIO_IODEV_WORKER_DEFINE(name, stack_size, prio)                                           \
+	static K_SEM_DEFINE(CONCAT(_rtio_worker_sem_, name), 0, K_SEM_MAX_LIMIT);                  \
+	struct rtio_iodev_worker name = {                                                          \
+		.sq = MPSC_INIT((name.sq)),                                                        \
+		.sem = &CONCAT(_rtio_worker_sem_, name),                                           \
+	};                                                                                         \
+	K_THREAD_DEFINE(CONCAT(_rtio_worker_thread_, name), stack_size, rtio_iodev_worker_thread,  \
+			&name, NULL, NULL, prio, 0, 0)
+
+/**
+ * @brief Submit to an iodev through a worker
+ *
+ * The iodevs of a bus should share one worker, which then serializes their
+ * submissions. Must not be called while submissions to the iodev are pending.
+ *
+ * @param iodev IO device
+ * @param worker Worker to submit through, NULL to submit on the caller's thread
+ */
+static inline void rtio_iodev_set_worker(struct rtio_iodev *iodev,
+					 struct rtio_iodev_worker *worker)
+{
+	iodev->worker = worker;
+}
+
+#endif /* CONFIG_RTIO_WORKER */
+
 #define Z_RTIO_SQE_POOL_DEFINE(name, sz)			\
 	static struct rtio_iodev_sqe CONCAT(_sqe_pool_, name)[sz];	\
 	STRUCT_SECTION_ITERABLE(rtio_sqe_pool, name) = {	\
@@ -1236,17 +1314,17 @@ static inline void rtio_iodev_sqe_err(struct rtio_iodev_sqe *iodev_sqe, int resu
 }
 
 /**
- * Submit a completion queue event with a given result and userdata
+ * Queue a completion queue event with a given result and userdata
  *
- * Called by the executor to produce a completion queue event, no inherent
- * locking is performed and this is not safe to do from multiple callers.
+ * The completion is not counted and its waiters are not woken up until
+ * rtio_cqe_notify() is called.
  *
  * @param r RTIO context
  * @param result Integer result code (could be -errno)
  * @param userdata Userdata to pass along to completion
  * @param flags Flags to use for the CEQ see RTIO_CQE_FLAG_*
  */
-static inline void rtio_cqe_submit(struct rtio *r, int result, void *userdata, uint32_t flags)
+static inline void rtio_cqe_queue(struct rtio *r, int result, void *userdata, uint32_t flags)
 {
 	struct rtio_cqe *cqe = rtio_cqe_acquire(r);
 
@@ -1258,7 +1336,19 @@ static inline void rtio_cqe_submit(struct rtio *r, int result, void *userdata, u
 		cqe->flags = flags;
 		rtio_cqe_produce(r, cqe);
 	}
+}
 
+/**
+ * Count completions and wake up the threads waiting for them
+ *
+ * No inherent locking is performed and this is not safe to do from
+ * multiple callers.
+ *
+ * @param r RTIO context
+ * @param count Number of completions queued with rtio_cqe_queue()
+ */
+static inline void rtio_cqe_notify(struct rtio *r, uint32_t count)
+{
 	/* atomic_t isn't guaranteed to wrap correctly as it could be signed, so
 	 * we must resort to a cas loop.
 	 */
@@ -1266,22 +1356,43 @@ static inline void rtio_cqe_submit(struct rtio *r, int result, void *userdata, u
 
 	do {
 		val = atomic_get(&r->cq_count);
-		new_val = (atomic_t)((uintptr_t)val + 1);
+		new_val = (atomic_t)((uintptr_t)val + count);
 	} while (!atomic_cas(&r->cq_count, val, new_val));
 
 #ifdef CONFIG_RTIO_SUBMIT_SEM
 	if (r->submit_count > 0) {
-		r->submit_count--;
-		if (r->submit_count == 0) {
+		if (r->submit_count <= count) {
+			r->submit_count = 0;
 			k_sem_give(r->submit_sem);
+		} else {
+			r->submit_count -= count;
 		}
 	}
 #endif
 #ifdef CONFIG_RTIO_CONSUME_SEM
-	k_sem_give(r->consume_sem);
+	for (uint32_t i = 0; i < count; i++) {
+		k_sem_give(r->consume_sem);
+	}
 #endif
 }
 
+/**
+ * Submit a completion queue event with a given result and userdata
+ *
+ * Called by the executor to produce a completion queue event, no inherent
+ * locking is performed and this is not safe to do from multiple callers.
+ *
+ * @param r RTIO context
+ * @param result Integer result code (could be -errno)
+ * @param userdata Userdata to pass along to completion
+ * @param flags Flags to use for the CEQ see RTIO_CQE_FLAG_*
+ */
+static inline void rtio_cqe_submit(struct rtio *r, int result, void *userdata, uint32_t flags)
+{
+	rtio_cqe_queue(r, result, userdata, flags);
+	rtio_cqe_notify(r, 1);
+}
+
 #define __RTIO_MEMPOOL_GET_NUM_BLKS(num_bytes, blk_size) (((num_bytes) + (blk_size)-1) / (blk_size))
 
 /**
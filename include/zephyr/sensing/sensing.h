@@ -282,6 +282,28 @@ int sensing_get_config(
 const struct sensing_sensor_info *sensing_get_sensor_info(
 		sensing_sensor_handle_t handle);
 
+/**
+ * @brief Copy the next sample of a sensor instance not read yet by the handle.
+ *
+ * For handles opened without a data event callback. Samples are kept in a ring
+ * per sensor, written once for all such handles, each reading it through its
+ * own cursor and decimated to its interval like the data events. Only the
+ * latest @kconfig{CONFIG_SENSING_SHARED_RING_SIZE} samples are kept, a handle
+ * falling further behind skips to the oldest one still in the ring.
+ *
+ * @note Enable with @kconfig{CONFIG_SENSING_SHARED_RING}
+ *
+ * @param handle The sensor instance handle.
+ * @param buf Buffer the sample is copied to.
+ * @param size Size of the buffer.
+ * @return size of the sample on success, -ENODATA if there is no new sample,
+ * -ENOSPC if the buffer is too small, -ENOTSUP if the handle has a data event
+ * callback or negative error value on other failures.
+ */
+int sensing_read_sample(
+		sensing_sensor_handle_t handle,
+		void *buf, size_t size);
+
 #ifdef __cplusplus
 }
 #endif
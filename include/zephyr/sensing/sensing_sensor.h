@@ -91,6 +91,12 @@ struct sensing_connection {
 	/** Next consume time of the connection. Unit is micro seconds. */
 	uint64_t next_consume_time;
 	struct sensing_callback_list *callback_list; /**< Callback list of the connection. */
+#ifdef CONFIG_SENSING_SHARED_RING
+	/** Sequence number of the next source sample consumed by the connection. */
+	uint32_t next_seq;
+	/** Number of source samples per sample consumed by the connection. */
+	uint16_t decimation;
+#endif
 };
 
 /**
@@ -119,6 +125,17 @@ struct sensing_sensor {
 	struct rtio_sqe *stream_sqe;      /**< Sqe for streaming mode. */
 	atomic_t flag;                    /**< Sensor flag of the sensor instance. */
 	struct sensing_connection *conns; /**< Pointer to sensor connections. */
+#ifdef CONFIG_SENSING_SHARED_RING
+	/** Sequence number of the next sample of the sensor. */
+	atomic_t ring_seq;
+	/** Sequence number of the sample in each slot of the shared ring. */
+	atomic_t ring_tag[CONFIG_SENSING_SHARED_RING_SIZE];
+	/** Size of the sample in each slot of the shared ring. */
+	uint16_t ring_len[CONFIG_SENSING_SHARED_RING_SIZE];
+	/** Latest samples of the sensor, for the clients reading them. */
+	uint8_t ring[CONFIG_SENSING_SHARED_RING_SIZE][CONFIG_SENSING_SHARED_RING_SAMPLE_SIZE]
+		__aligned(8);
+#endif
 };
 
 /**
@@ -10,7 +10,11 @@
 #include <stdbool.h>
 #include <zephyr/types.h>
 #include <zephyr/sys/mem_stats.h>
+#include <zephyr/sys/util.h>
 #include <zephyr/toolchain.h>
+#ifdef CONFIG_SYS_HEAP_CACHE
+#include <zephyr/spinlock.h>
+#endif
 
 #ifdef __cplusplus
 extern "C" {
@@ -58,13 +62,49 @@ struct sys_heap {
 	struct z_heap *heap;
 	void *init_mem;
 	size_t init_bytes;
+#ifdef CONFIG_SYS_HEAP_CACHE
+	struct sys_heap_cache *cache;
+#endif
+};
+
+#ifdef CONFIG_SYS_HEAP_CACHE
+
+/* Cached size classes are powers of two from 32 bytes up to
+ * CONFIG_SYS_HEAP_CACHE_MAX_BYTES (rounded up to a power of two).
+ */
+#define SYS_HEAP_CACHE_MIN_SHIFT 5
+#define SYS_HEAP_CACHE_CLASSES \
+	(LOG2CEIL(CONFIG_SYS_HEAP_CACHE_MAX_BYTES) - SYS_HEAP_CACHE_MIN_SHIFT + 1)
+
+struct sys_heap_magazine {
+	uint32_t count;
+	void *blocks[CONFIG_SYS_HEAP_CACHE_DEPTH];
+};
+
+struct sys_heap_cpu_cache {
+	/* Only contended when another CPU flushes the magazines */
+	struct k_spinlock lock;
+	struct sys_heap_magazine mags[SYS_HEAP_CACHE_CLASSES];
+	uint32_t hits;
+	uint32_t misses;
+};
+
+/* Per-CPU magazines of free blocks sitting in front of a sys_heap.
+ * Owned by the user, see sys_heap_cache_init().
+ */
+struct sys_heap_cache {
+	struct sys_heap_cpu_cache cpu[CONFIG_MP_MAX_NUM_CPUS];
 };
 
+#endif /* CONFIG_SYS_HEAP_CACHE */
+
 struct z_heap_stress_result {
 	uint32_t total_allocs;
 	uint32_t successful_allocs;
 	uint32_t total_frees;
 	uint64_t accumulated_in_use_bytes;
+	uint64_t alloc_cycles;
+	uint64_t free_cycles;
 };
 
 /**
@@ -229,7 +269,8 @@ static inline bool sys_heap_validate(struct sys_heap *heap)
  * target_percent full.  Allocation and free operations are provided
  * by the caller as callbacks (i.e. this can in theory test any heap).
  * Results, including counts of frees and successful/unsuccessful
- * allocations, are returned via the @a result struct.
+ * allocations and the cycles spent in the callbacks, are returned
+ * via the @a result struct.
  *
  * @param alloc_fn Callback to perform an allocation.  Passes back the @a
  *              arg parameter as a context handle.
@@ -257,6 +298,91 @@ void sys_heap_stress(void *(*alloc_fn)(void *arg, size_t bytes),
 		     int target_percent,
 		     struct z_heap_stress_result *result);
 
+#ifdef CONFIG_SYS_HEAP_CACHE
+
+/** @brief Attach a per-CPU magazine cache to a sys_heap
+ *
+ * Once attached, the sys_heap_cache_*() functions serve small
+ * allocations out of per-CPU magazines of free blocks, without
+ * taking the lock the user provides for the heap.  Only requests of
+ * up to CONFIG_SYS_HEAP_CACHE_MAX_BYTES are cached; they are rounded
+ * up to the next power of two (minimum 32 bytes).  Blocks held in a
+ * magazine still count as allocated in the heap statistics.
+ *
+ * Must be called after sys_heap_init() and before any other
+ * operation on the heap.
+ *
+ * @param heap Heap to attach the cache to
+ * @param cache Storage for the cache, must outlive the heap
+ */
+void sys_heap_cache_init(struct sys_heap *heap, struct sys_heap_cache *cache);
+
+/** @brief Allocate from the magazine cache of the current CPU
+ *
+ * Fast path: only takes the cache lock of the current CPU, which is
+ * not contended unless another CPU flushes the cache.  Returns NULL on
+ * a miss (empty magazine, request too big, or no cache attached), in
+ * which case the caller should take the heap lock and call
+ * sys_heap_cache_refill().
+ *
+ * @param heap Heap from which to allocate
+ * @param bytes Number of bytes requested
+ * @return Pointer to memory the caller can now use, or NULL
+ */
+void *sys_heap_cache_alloc(struct sys_heap *heap, size_t bytes);
+
+/** @brief Allocate and refill the magazine of the current CPU
+ *
+ * Slow path for sys_heap_cache_alloc(), to be called with the heap
+ * lock held.  Allocates the requested block and a batch of
+ * CONFIG_SYS_HEAP_CACHE_BATCH more blocks of the same size class
+ * into the magazine.  Requests that are not cacheable are passed on
+ * to sys_heap_alloc().  When the heap is exhausted, the blocks cached
+ * by all CPUs are returned to it before giving up.
+ *
+ * @param heap Heap from which to allocate
+ * @param bytes Number of bytes requested
+ * @return Pointer to memory the caller can now use, or NULL
+ */
+void *sys_heap_cache_refill(struct sys_heap *heap, size_t bytes);
+
+/** @brief Free into the magazine cache of the current CPU
+ *
+ * Fast path: only takes the cache lock of the current CPU.  Returns
+ * false if the block was not cached (magazine full, block not of a cached
+ * size class, or no cache attached), in which case the caller should
+ * take the heap lock and call sys_heap_cache_drain().
+ *
+ * @param heap Heap to which to return the memory
+ * @param mem A pointer previously returned from an allocation
+ * @return true if the block was cached
+ */
+bool sys_heap_cache_free(struct sys_heap *heap, void *mem);
+
+/** @brief Free and drain the magazine of the current CPU
+ *
+ * Slow path for sys_heap_cache_free(), to be called with the heap
+ * lock held.  If the block belongs in a full magazine, a batch of
+ * CONFIG_SYS_HEAP_CACHE_BATCH of its oldest blocks is returned to
+ * the heap and the block is cached, otherwise the block is passed on
+ * to sys_heap_free().
+ *
+ * @param heap Heap to which to return the memory
+ * @param mem A pointer previously returned from an allocation
+ */
+void sys_heap_cache_drain(struct sys_heap *heap, void *mem);
+
+/** @brief Return the blocks cached by all CPUs to the heap
+ *
+ * To be called with the heap lock held, before giving up on an
+ * allocation or blocking on the heap.
+ *
+ * @param heap Heap whose cache to flush
+ */
+void sys_heap_cache_flush(struct sys_heap *heap);
+
+#endif /* CONFIG_SYS_HEAP_CACHE */
+
 /** @brief Print heap internal structure information to the console
  *
  * Print information on the heap structure such as its size, chunk buckets,
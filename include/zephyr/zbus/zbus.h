@@ -69,6 +69,27 @@ struct zbus_channel_data {
 	/** Number of times data has been published to this channel */
 	uint32_t publish_count;
 #endif /* CONFIG_ZBUS_CHANNEL_PUBLISH_STATS */
+
+#if defined(CONFIG_ZBUS_CHANNEL_LOAN) || defined(__DOXYGEN__)
+	/** Loan slots reference counters. Only loan channels have it, for the other channels it
+	 * is NULL. The slot holding the published message is referenced by the channel itself.
+	 */
+	atomic_t *loan_refs;
+
+	/** Free loan slots semaphore. Counts the slots that are not referenced at all. */
+	struct k_sem loan_sem;
+
+	/** Index of the slot holding the published message. */
+	atomic_t loan_current;
+
+	/** Publishing sequence counter. It lets readers detect a concurrent publication
+	 * without taking the channel's semaphore.
+	 */
+	atomic_t loan_seq;
+
+	/** Number of loan slots. */
+	uint8_t loan_slots;
+#endif /* CONFIG_ZBUS_CHANNEL_LOAN */
 };
 
 /**
@@ -269,8 +290,13 @@ struct zbus_channel_observation {
 
 #define _ZBUS_MESSAGE_NAME(_name) _CONCAT(_zbus_message_, _name)
 
+#define _ZBUS_LOAN_REFS_NAME(_name) _CONCAT(_zbus_loan_refs_, _name)
+
 /* clang-format off */
 #define _ZBUS_CHAN_DEFINE(_name, _id, _type, _validator, _user_data)                               \
+	_ZBUS_CHAN_DEFINE_WITH_DATA(_name, _id, _type, _validator, _user_data, ())
+
+#define _ZBUS_CHAN_DEFINE_WITH_DATA(_name, _id, _type, _validator, _user_data, _data_init)         \
 	static struct zbus_channel_data _CONCAT(_zbus_chan_data_, _name) = {                       \
 		.observers_start_idx = -1,                                                         \
 		.observers_end_idx = -1,                                                           \
@@ -280,6 +306,7 @@ struct zbus_channel_observation {
 		 IF_ENABLED(CONFIG_ZBUS_RUNTIME_OBSERVERS,                                         \
 			   (.observers = SYS_SLIST_STATIC_INIT(                                    \
 				&_CONCAT(_zbus_chan_data_, _name).observers),))                    \
+		__DEBRACKET _data_init                                                             \
 	};                                                                                         \
 	static K_MUTEX_DEFINE(_CONCAT(_zbus_mutex_, _name));                                       \
 	_ZBUS_CPP_EXTERN const STRUCT_SECTION_ITERABLE(zbus_channel, _name) = {                    \
@@ -413,6 +440,47 @@ struct zbus_channel_observation {
 	/* Create all channel observations from observers list */                                  \
 	FOR_EACH_FIXED_ARG_NONEMPTY_TERM(_ZBUS_CHAN_OBSERVATION, (;), _name, _observers)
 
+#if defined(CONFIG_ZBUS_CHANNEL_LOAN) || defined(__DOXYGEN__)
+
+/**
+ * @brief Zbus loan channel definition.
+ *
+ * This macro defines a channel whose message is stored in @p _slots slots. The publishers
+ * write the message directly into a loaned slot (see @ref zbus_chan_loan), the readers copy a
+ * consistent snapshot without taking the channel's semaphore, and the message subscribers
+ * receive a reference to the published slot instead of a copy. One slot is always held by the
+ * published message, and one is needed for every loan and every message subscriber
+ * notification not yet consumed.
+ *
+ * @param _name The channel's name.
+ * @param _type The Message type. It must be a struct or union.
+ * @param _slots The number of message slots, at least 2.
+ * @param _validator The validator function.
+ * @param _user_data A pointer to the user data.
+ *
+ * @see struct zbus_channel
+ * @param _observers The observers list. The sequence indicates the priority of the observer. The
+ * first the highest priority.
+ * @param _init_val The message initialization.
+ */
+#define ZBUS_CHAN_DEFINE_LOAN(_name, _type, _slots, _validator, _user_data, _observers, _init_val) \
+	BUILD_ASSERT((_slots) >= 2 && (_slots) <= UINT8_MAX,                                       \
+		     "A loan channel needs from 2 up to 255 slots");                               \
+	static _type _ZBUS_MESSAGE_NAME(_name)[_slots] = {_init_val};                              \
+	static atomic_t _ZBUS_LOAN_REFS_NAME(_name)[_slots] = {ATOMIC_INIT(1)};                    \
+	_ZBUS_CHAN_DEFINE_WITH_DATA(                                                               \
+		_name, ZBUS_CHAN_ID_INVALID, _type, _validator, _user_data,                        \
+		(.loan_refs = _ZBUS_LOAN_REFS_NAME(_name),                                         \
+		 .loan_sem = Z_SEM_INITIALIZER(_CONCAT(_zbus_chan_data_, _name).loan_sem,          \
+					       (_slots) - 1, (_slots) - 1),                        \
+		 .loan_slots = (_slots),));                                                        \
+	/* Extern declaration of observers */                                                      \
+	ZBUS_OBS_DECLARE(_observers);                                                              \
+	/* Create all channel observations from observers list */                                  \
+	FOR_EACH_FIXED_ARG_NONEMPTY_TERM(_ZBUS_CHAN_OBSERVATION, (;), _name, _observers)
+
+#endif /* CONFIG_ZBUS_CHANNEL_LOAN */
+
 /**
  * @brief Initialize a message.
  *
@@ -554,7 +622,8 @@ struct zbus_channel_observation {
  *
  * @brief Publish to a channel
  *
- * This routine publishes a message to a channel.
+ * This routine publishes a message to a channel. For a loan channel, the message is copied into
+ * a loaned slot which is then published, see @ref zbus_chan_pub_loan.
  *
  * @param chan The channel's reference.
  * @param msg Reference to the message where the publish function copies the channel's
@@ -576,7 +645,9 @@ int zbus_chan_pub(const struct zbus_channel *chan, const void *msg, k_timeout_t
 /**
  * @brief Read a channel
  *
- * This routine reads a message from a channel.
+ * This routine reads a message from a channel. A loan channel is read without taking the
+ * channel's semaphore, so the read never blocks and the timeout is ignored. The copy is retried
+ * if a message was published meanwhile.
  *
  * @param[in] chan The channel's reference.
  * @param[out] msg Reference to the message where the read function copies the channel's
@@ -651,6 +722,67 @@ int zbus_chan_finish(const struct zbus_channel *chan);
  */
 int zbus_chan_notify(const struct zbus_channel *chan, k_timeout_t timeout);
 
+#if defined(CONFIG_ZBUS_CHANNEL_LOAN) || defined(__DOXYGEN__)
+
+/**
+ * @brief Loan a message slot from a loan channel.
+ *
+ * This routine hands over a free message slot of a channel defined with
+ * @ref ZBUS_CHAN_DEFINE_LOAN. The caller writes the message directly into the slot and
+ * then publishes it with @ref zbus_chan_pub_loan, or gives it back with
+ * @ref zbus_chan_loan_discard. The channel is not locked while the slot is loaned.
+ *
+ * @param[in] chan The channel's reference.
+ * @param[out] msg The loaned message slot reference.
+ * @param[in] timeout Waiting period for a free slot,
+ *                or one of the special values K_NO_WAIT and K_FOREVER.
+ *
+ * @retval 0 Slot loaned.
+ * @retval -EBUSY No slot is free.
+ * @retval -EAGAIN Waiting period timed out.
+ * @retval -EFAULT A parameter is incorrect, the channel is not a loan channel, or the function
+ * context is invalid (inside an ISR). The function only returns this value when the
+ * @kconfig{CONFIG_ZBUS_ASSERT_MOCK} is enabled.
+ */
+int zbus_chan_loan(const struct zbus_channel *chan, void **msg, k_timeout_t timeout);
+
+/**
+ * @brief Publish a loaned message.
+ *
+ * This routine makes the loaned slot the channel's message, without copying it, and notifies
+ * the observers. The message subscribers receive a reference to the slot. The loan ends with
+ * this call, even when it fails.
+ *
+ * @param chan The channel's reference.
+ * @param msg The message slot returned by @ref zbus_chan_loan.
+ * @param timeout Waiting period to publish the channel,
+ *                or one of the special values K_NO_WAIT and K_FOREVER.
+ *
+ * @retval 0 Channel published.
+ * @retval -ENOMSG The message is invalid based on the validator function or some of the
+ * observers could not receive the notification.
+ * @retval -EBUSY The channel is busy.
+ * @retval -EAGAIN Waiting period timed out.
+ * @retval -EFAULT A parameter is incorrect, the notification could not be sent to one or more
+ * observer, or the function context is invalid (inside an ISR). The function only returns this
+ * value when the @kconfig{CONFIG_ZBUS_ASSERT_MOCK} is enabled.
+ */
+int zbus_chan_pub_loan(const struct zbus_channel *chan, void *msg, k_timeout_t timeout);
+
+/**
+ * @brief Give back a loaned message slot without publishing it.
+ *
+ * @param chan The channel's reference.
+ * @param msg The message slot returned by @ref zbus_chan_loan.
+ *
+ * @retval 0 Slot given back.
+ * @retval -EFAULT A parameter is incorrect. The function only returns this value when the
+ * @kconfig{CONFIG_ZBUS_ASSERT_MOCK} is enabled.
+ */
+int zbus_chan_loan_discard(const struct zbus_channel *chan, void *msg);
+
+#endif /* CONFIG_ZBUS_CHANNEL_LOAN */
+
 #if defined(CONFIG_ZBUS_CHANNEL_NAME) || defined(__DOXYGEN__)
 
 /**
@@ -685,6 +817,15 @@ const struct zbus_channel *zbus_chan_from_id(uint32_t channel_id);
 
 #endif
 
+/** @cond INTERNAL_HIDDEN */
+#if defined(CONFIG_ZBUS_CHANNEL_LOAN)
+static inline void *_zbus_chan_loan_slot(const struct zbus_channel *chan, atomic_val_t idx)
+{
+	return (uint8_t *)chan->message + idx * chan->message_size;
+}
+#endif /* CONFIG_ZBUS_CHANNEL_LOAN */
+/** @endcond */
+
 /**
  * @brief Get the reference for a channel message directly.
  *
@@ -693,6 +834,9 @@ const struct zbus_channel *zbus_chan_from_id(uint32_t channel_id);
  * @warning This function must only be used directly for already locked channels. This
  * can be done inside a listener for the receiving channel or after claim a channel.
  *
+ * @warning The message of a loan channel must not be changed through this reference, since
+ * it is read without locking the channel. Publish a loaned message instead.
+ *
  * @param chan The channel's reference.
  *
  * @return Channel's message reference.
@@ -701,6 +845,12 @@ static inline void *zbus_chan_msg(const struct zbus_channel *chan)
 {
 	__ASSERT(chan != NULL, "chan is required");
 
+#if defined(CONFIG_ZBUS_CHANNEL_LOAN)
+	if (chan->data->loan_refs != NULL) {
+		return _zbus_chan_loan_slot(chan, atomic_get(&chan->data->loan_current));
+	}
+#endif /* CONFIG_ZBUS_CHANNEL_LOAN */
+
 	return chan->message;
 }
 
@@ -720,9 +870,7 @@ static inline void *zbus_chan_msg(const struct zbus_channel *chan)
  */
 static inline const void *zbus_chan_const_msg(const struct zbus_channel *chan)
 {
-	__ASSERT(chan != NULL, "chan is required");
-
-	return chan->message;
+	return zbus_chan_msg(chan);
 }
 
 /**
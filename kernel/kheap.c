@@ -16,6 +16,9 @@ void k_heap_init(struct k_heap *heap, void *mem, size_t bytes)
 {
 	z_waitq_init(&heap->wait_q);
 	heap->lock = (struct k_spinlock) {};
+#ifdef CONFIG_SYS_HEAP_CACHE
+	atomic_clear(&heap->waiters);
+#endif
 	sys_heap_init(&heap->heap, mem, bytes);
 
 	SYS_PORT_TRACING_OBJ_INIT(k_heap, heap);
@@ -63,12 +66,77 @@ SYS_INIT_NAMED(statics_init_pre, statics_init, PRE_KERNEL_1, CONFIG_KERNEL_INIT_
 SYS_INIT_NAMED(statics_init_post, statics_init, POST_KERNEL, 0);
 #endif /* CONFIG_DEMAND_PAGING && !CONFIG_LINKER_GENERIC_SECTIONS_PRESENT_AT_BOOT */
 
+static void *heap_alloc_locked(struct k_heap *heap, size_t align, size_t bytes)
+{
+	void *ret;
+
+#ifdef CONFIG_SYS_HEAP_CACHE
+	/* Cached blocks are only guaranteed pointer alignment */
+	if (align <= sizeof(void *)) {
+		return sys_heap_cache_refill(&heap->heap, bytes);
+	}
+#endif
+	ret = sys_heap_aligned_alloc(&heap->heap, align, bytes);
+#ifdef CONFIG_SYS_HEAP_CACHE
+	if (ret == NULL) {
+		/* Blocks cached by any CPU may coalesce into what we need */
+		sys_heap_cache_flush(&heap->heap);
+		ret = sys_heap_aligned_alloc(&heap->heap, align, bytes);
+	}
+#endif
+	return ret;
+}
+
+/* Called with the heap lock held when an allocation failed and the
+ * caller is about to pend.  The first time around it only registers the
+ * caller as a waiter and returns true to have the allocation retried:
+ * a block freed into a magazine from then on makes k_heap_free() take
+ * the heap lock and flush, and one freed before is found by the retry.
+ */
+static inline bool heap_waiter_retry(struct k_heap *heap, bool *waiting)
+{
+#ifdef CONFIG_SYS_HEAP_CACHE
+	if (!*waiting) {
+		*waiting = true;
+		atomic_inc(&heap->waiters);
+		return true;
+	}
+#else
+	ARG_UNUSED(heap);
+	ARG_UNUSED(waiting);
+#endif
+	return false;
+}
+
+static inline void heap_waiter_done(struct k_heap *heap, bool waiting)
+{
+#ifdef CONFIG_SYS_HEAP_CACHE
+	if (waiting) {
+		atomic_dec(&heap->waiters);
+	}
+#else
+	ARG_UNUSED(heap);
+	ARG_UNUSED(waiting);
+#endif
+}
+
 void *k_heap_aligned_alloc(struct k_heap *heap, size_t align, size_t bytes,
 			k_timeout_t timeout)
 {
 	k_timepoint_t end = sys_timepoint_calc(timeout);
 	void *ret = NULL;
 
+#ifdef CONFIG_SYS_HEAP_CACHE
+	if (align <= sizeof(void *)) {
+		ret = sys_heap_cache_alloc(&heap->heap, bytes);
+		if (ret != NULL) {
+			SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_heap, aligned_alloc, heap, timeout);
+			SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_heap, aligned_alloc, heap, timeout, ret);
+			return ret;
+		}
+	}
+#endif
+
 	k_spinlock_key_t key = k_spin_lock(&heap->lock);
 
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_heap, aligned_alloc, heap, timeout);
@@ -76,15 +144,20 @@ void *k_heap_aligned_alloc(struct k_heap *heap, size_t align, size_t bytes,
 	__ASSERT(!arch_is_in_isr() || K_TIMEOUT_EQ(timeout, K_NO_WAIT), "");
 
 	bool blocked_alloc = false;
+	bool waiting = false;
 
 	while (ret == NULL) {
-		ret = sys_heap_aligned_alloc(&heap->heap, align, bytes);
+		ret = heap_alloc_locked(heap, align, bytes);
 
 		if (!IS_ENABLED(CONFIG_MULTITHREADING) ||
 		    (ret != NULL) || K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
 			break;
 		}
 
+		if (heap_waiter_retry(heap, &waiting)) {
+			continue;
+		}
+
 		if (!blocked_alloc) {
 			blocked_alloc = true;
 
@@ -100,6 +173,8 @@ void *k_heap_aligned_alloc(struct k_heap *heap, size_t align, size_t bytes,
 		key = k_spin_lock(&heap->lock);
 	}
 
+	heap_waiter_done(heap, waiting);
+
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_heap, aligned_alloc, heap, timeout, ret);
 
 	k_spin_unlock(&heap->lock, key);
@@ -147,19 +222,33 @@ void *k_heap_realloc(struct k_heap *heap, void *ptr, size_t bytes, k_timeout_t t
 
 	__ASSERT(!arch_is_in_isr() || K_TIMEOUT_EQ(timeout, K_NO_WAIT), "");
 
+	bool waiting = false;
+
 	while (ret == NULL) {
 		ret = sys_heap_aligned_realloc(&heap->heap, ptr, sizeof(void *), bytes);
+#ifdef CONFIG_SYS_HEAP_CACHE
+		if (ret == NULL) {
+			sys_heap_cache_flush(&heap->heap);
+			ret = sys_heap_aligned_realloc(&heap->heap, ptr, sizeof(void *), bytes);
+		}
+#endif
 
 		if (!IS_ENABLED(CONFIG_MULTITHREADING) ||
 		    (ret != NULL) || K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
 			break;
 		}
 
+		if (heap_waiter_retry(heap, &waiting)) {
+			continue;
+		}
+
 		timeout = sys_timepoint_timeout(end);
 		(void) z_pend_curr(&heap->lock, key, &heap->wait_q, timeout);
 		key = k_spin_lock(&heap->lock);
 	}
 
+	heap_waiter_done(heap, waiting);
+
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_heap, realloc, heap, ptr, bytes, timeout, ret);
 
 	k_spin_unlock(&heap->lock, key);
@@ -168,9 +257,36 @@ void *k_heap_realloc(struct k_heap *heap, void *ptr, size_t bytes, k_timeout_t t
 
 void k_heap_free(struct k_heap *heap, void *mem)
 {
-	k_spinlock_key_t key = k_spin_lock(&heap->lock);
+	k_spinlock_key_t key;
+
+#ifdef CONFIG_SYS_HEAP_CACHE
+	if (sys_heap_cache_free(&heap->heap, mem)) {
+		if (!IS_ENABLED(CONFIG_MULTITHREADING)) {
+			SYS_PORT_TRACING_OBJ_FUNC(k_heap, free, heap);
+			return;
+		}
+
+		/* An allocator counts itself as a waiter before its last
+		 * flush and retry, so either that retry finds this block or
+		 * the count is already visible here.
+		 */
+		if (atomic_get(&heap->waiters) == 0) {
+			SYS_PORT_TRACING_OBJ_FUNC(k_heap, free, heap);
+			return;
+		}
+
+		/* Someone is blocked on this heap, hand the caches back to it */
+		key = k_spin_lock(&heap->lock);
+		sys_heap_cache_flush(&heap->heap);
+	} else {
+		key = k_spin_lock(&heap->lock);
+		sys_heap_cache_drain(&heap->heap, mem);
+	}
+#else
+	key = k_spin_lock(&heap->lock);
 
 	sys_heap_free(&heap->heap, mem);
+#endif
 
 	SYS_PORT_TRACING_OBJ_FUNC(k_heap, free, heap);
 	if (IS_ENABLED(CONFIG_MULTITHREADING) && (z_unpend_all(&heap->wait_q) != 0)) {
@@ -45,9 +45,65 @@ BUILD_ASSERT(CONFIG_NUM_COOP_PRIORITIES >= CONFIG_NUM_METAIRQ_PRIORITIES,
 	     "CONFIG_NUM_METAIRQ_PRIORITIES as Meta IRQs are just a special class of cooperative "
 	     "threads.");
 
+#ifdef CONFIG_SCHED_PER_CPU_RUNQ
+BUILD_ASSERT(CONFIG_MP_MAX_NUM_CPUS <= ATOMIC_BITS, "CPUs don't fit in runq_nonempty");
+
+/* Bit per CPU whose run queue isn't empty, so that picking the next
+ * thread only looks at the queues of other CPUs when there's something
+ * to steal.  Written with _sched_spinlock held.
+ */
+static atomic_t runq_nonempty;
+
+static ALWAYS_INLINE bool runq_cpu_allowed(struct k_thread *thread, unsigned int cpu)
+{
+#ifdef CONFIG_SCHED_CPU_MASK
+	return (thread->base.cpu_mask & BIT(cpu)) != 0;
+#else
+	ARG_UNUSED(thread);
+	ARG_UNUSED(cpu);
+	return true;
+#endif /* CONFIG_SCHED_CPU_MASK */
+}
+
+/* Migration policy, picks the run queue for a thread being queued:
+ * an allowed CPU currently running its idle thread (so it starts
+ * right away), else the CPU it last ran on (warm caches), else the
+ * lowest allowed CPU.  Anything suboptimal about this choice is
+ * corrected by runq_steal() on the CPU that gets to run it.
+ */
+static unsigned int runq_select_cpu(struct k_thread *thread)
+{
+	unsigned int num_cpus = arch_num_cpus();
+	unsigned int first = num_cpus;
+
+	for (unsigned int i = 0; i < num_cpus; i++) {
+		struct k_thread *curr = _kernel.cpus[i].current;
+
+		if (!runq_cpu_allowed(thread, i)) {
+			continue;
+		}
+		if ((curr != NULL) && z_is_idle_thread_object(curr)) {
+			return i;
+		}
+		if (first == num_cpus) {
+			first = i;
+		}
+	}
+
+	if (runq_cpu_allowed(thread, thread->base.cpu)) {
+		return thread->base.cpu;
+	}
+
+	/* Same edge case as PIN_ONLY: a thread with no CPUs allowed */
+	return (first == num_cpus) ? 0 : first;
+}
+#endif /* CONFIG_SCHED_PER_CPU_RUNQ */
+
 static ALWAYS_INLINE void *thread_runq(struct k_thread *thread)
 {
-#ifdef CONFIG_SCHED_CPU_MASK_PIN_ONLY
+#if defined(CONFIG_SCHED_PER_CPU_RUNQ)
+	return &_kernel.cpus[thread->base.runq_cpu].ready_q.runq;
+#elif defined(CONFIG_SCHED_CPU_MASK_PIN_ONLY)
 	int cpu, m = thread->base.cpu_mask;
 
 	/* Edge case: it's legal per the API to "make runnable" a
@@ -62,23 +118,37 @@ static ALWAYS_INLINE void *thread_runq(struct k_thread *thread)
 #else
 	ARG_UNUSED(thread);
 	return &_kernel.ready_q.runq;
-#endif /* CONFIG_SCHED_CPU_MASK_PIN_ONLY */
+#endif /* CONFIG_SCHED_PER_CPU_RUNQ */
 }
 
 static ALWAYS_INLINE void *curr_cpu_runq(void)
 {
-#ifdef CONFIG_SCHED_CPU_MASK_PIN_ONLY
+#if defined(CONFIG_SCHED_CPU_MASK_PIN_ONLY) || defined(CONFIG_SCHED_PER_CPU_RUNQ)
 	return &arch_curr_cpu()->ready_q.runq;
 #else
 	return &_kernel.ready_q.runq;
-#endif /* CONFIG_SCHED_CPU_MASK_PIN_ONLY */
+#endif /* CONFIG_SCHED_CPU_MASK_PIN_ONLY || CONFIG_SCHED_PER_CPU_RUNQ */
 }
 
 static ALWAYS_INLINE void runq_add(struct k_thread *thread)
 {
 	__ASSERT_NO_MSG(!z_is_idle_thread_object(thread));
 
+#ifdef CONFIG_SCHED_PER_CPU_RUNQ
+	thread->base.runq_cpu = runq_select_cpu(thread);
+#endif /* CONFIG_SCHED_PER_CPU_RUNQ */
+
 	_priq_run_add(thread_runq(thread), thread);
+
+#ifdef CONFIG_SCHED_PER_CPU_RUNQ
+	struct _ready_q *ready_q = &_kernel.cpus[thread->base.runq_cpu].ready_q;
+
+	/* Equal priorities queue behind the head */
+	if ((ready_q->head == NULL) || (z_sched_prio_cmp(thread, ready_q->head) > 0)) {
+		ready_q->head = thread;
+	}
+	atomic_or(&runq_nonempty, BIT(thread->base.runq_cpu));
+#endif /* CONFIG_SCHED_PER_CPU_RUNQ */
 }
 
 static ALWAYS_INLINE void runq_remove(struct k_thread *thread)
@@ -86,6 +156,22 @@ static ALWAYS_INLINE void runq_remove(struct k_thread *thread)
 	__ASSERT_NO_MSG(!z_is_idle_thread_object(thread));
 
 	_priq_run_remove(thread_runq(thread), thread);
+
+#ifdef CONFIG_SCHED_PER_CPU_RUNQ
+	struct _ready_q *ready_q = &_kernel.cpus[thread->base.runq_cpu].ready_q;
+
+	if (ready_q->head == thread) {
+#ifdef CONFIG_SCHED_DUMB
+		/* Not the CPU mask aware variant */
+		ready_q->head = z_priq_dumb_best(&ready_q->runq);
+#else
+		ready_q->head = _priq_run_best(&ready_q->runq);
+#endif /* CONFIG_SCHED_DUMB */
+		if (ready_q->head == NULL) {
+			atomic_and(&runq_nonempty, ~BIT(thread->base.runq_cpu));
+		}
+	}
+#endif /* CONFIG_SCHED_PER_CPU_RUNQ */
 }
 
 static ALWAYS_INLINE void runq_yield(void)
@@ -93,9 +179,56 @@ static ALWAYS_INLINE void runq_yield(void)
 	_priq_run_yield(curr_cpu_runq());
 }
 
+#ifdef CONFIG_SCHED_PER_CPU_RUNQ
+/* Work stealing: returns the best thread queued on another CPU that
+ * this CPU may run, if it outranks the local choice (or there is no
+ * local choice, i.e. this CPU would otherwise go idle).  Ties favor
+ * the local queue.  The thread stays in its queue until next_up()
+ * actually selects and dequeues it.
+ *
+ * Only non-empty queues are visited, and only their cached head is
+ * looked at unless it outranks the best choice so far, so the cost
+ * doesn't grow with the number of CPUs while the other queues are
+ * empty or hold lower priority threads.
+ */
+static struct k_thread *runq_steal(struct k_thread *local)
+{
+	atomic_val_t cpus = atomic_get(&runq_nonempty) & ~BIT(_current_cpu->id);
+	struct k_thread *best = local;
+
+	while (cpus != 0) {
+		unsigned int i = u32_count_trailing_zeros(cpus);
+		struct k_thread *thread = _kernel.cpus[i].ready_q.head;
+
+		cpus &= cpus - 1;
+
+		if ((best != NULL) && (z_sched_prio_cmp(thread, best) <= 0)) {
+			continue;
+		}
+
+#ifdef CONFIG_SCHED_CPU_MASK
+		/* Skips the threads that may not run on the current CPU */
+		thread = _priq_run_best(&_kernel.cpus[i].ready_q.runq);
+		if ((thread == NULL) ||
+		    ((best != NULL) && (z_sched_prio_cmp(thread, best) <= 0))) {
+			continue;
+		}
+#endif /* CONFIG_SCHED_CPU_MASK */
+
+		best = thread;
+	}
+
+	return best;
+}
+#endif /* CONFIG_SCHED_PER_CPU_RUNQ */
+
 static ALWAYS_INLINE struct k_thread *runq_best(void)
 {
+#ifdef CONFIG_SCHED_PER_CPU_RUNQ
+	return runq_steal(_priq_run_best(curr_cpu_runq()));
+#else
 	return _priq_run_best(curr_cpu_runq());
+#endif /* CONFIG_SCHED_PER_CPU_RUNQ */
 }
 
 /* _current is never in the run queue until context switch on
@@ -937,13 +1070,13 @@ void init_ready_q(struct _ready_q *ready_q)
 
 void z_sched_init(void)
 {
-#ifdef CONFIG_SCHED_CPU_MASK_PIN_ONLY
+#if defined(CONFIG_SCHED_CPU_MASK_PIN_ONLY) || defined(CONFIG_SCHED_PER_CPU_RUNQ)
 	for (int i = 0; i < CONFIG_MP_MAX_NUM_CPUS; i++) {
 		init_ready_q(&_kernel.cpus[i].ready_q);
 	}
 #else
 	init_ready_q(&_kernel.ready_q);
-#endif /* CONFIG_SCHED_CPU_MASK_PIN_ONLY */
+#endif /* CONFIG_SCHED_CPU_MASK_PIN_ONLY || CONFIG_SCHED_PER_CPU_RUNQ */
 }
 
 void z_impl_k_thread_priority_set(k_tid_t thread, int prio)
@@ -14,7 +14,18 @@
 
 static uint64_t curr_tick;
 
+#ifdef CONFIG_TIMEOUT_QUEUE_SCALABLE
+static bool timeout_lessthan(struct rbnode *a, struct rbnode *b);
+
+static struct rbtree timeout_tree = {
+	.lessthan_fn = timeout_lessthan,
+};
+
+/* Never zero, see z_is_inactive_timeout() */
+static uint32_t next_order_key = 1U;
+#else
 static sys_dlist_t timeout_list = SYS_DLIST_STATIC_INIT(&timeout_list);
+#endif /* CONFIG_TIMEOUT_QUEUE_SCALABLE */
 
 /*
  * The timeout code shall take no locks other than its own (timeout_lock), nor
@@ -40,6 +51,57 @@ static inline int z_vrfy_sys_clock_hw_cycles_per_sec_runtime_get(void)
 #endif /* CONFIG_USERSPACE */
 #endif /* CONFIG_TIMER_READS_ITS_FREQUENCY_AT_RUNTIME */
 
+#ifdef CONFIG_TIMEOUT_QUEUE_SCALABLE
+static bool timeout_lessthan(struct rbnode *a, struct rbnode *b)
+{
+	struct _timeout *ta = CONTAINER_OF(a, struct _timeout, node);
+	struct _timeout *tb = CONTAINER_OF(b, struct _timeout, node);
+
+	if (ta->dticks != tb->dticks) {
+		return ta->dticks < tb->dticks;
+	}
+
+	/* Equal expiries fire in the order they were added, as with
+	 * the list backend.  The key wraps, so compare the difference;
+	 * this only misorders entries added 2^31 timeouts apart that
+	 * still share an expiry tick.
+	 */
+	return (int32_t)(ta->order_key - tb->order_key) < 0;
+}
+
+static struct _timeout *first(void)
+{
+	struct rbnode *n = rb_get_min(&timeout_tree);
+
+	return (n == NULL) ? NULL : CONTAINER_OF(n, struct _timeout, node);
+}
+
+static void remove_timeout(struct _timeout *t)
+{
+	rb_remove(&timeout_tree, &t->node);
+	t->order_key = 0U;
+}
+
+/* Inserts a timeout whose dticks holds the delay from curr_tick */
+static void insert_timeout(struct _timeout *to)
+{
+	to->dticks += curr_tick;
+	to->order_key = next_order_key;
+
+	++next_order_key;
+	if (next_order_key == 0U) {
+		next_order_key = 1U;
+	}
+
+	rb_insert(&timeout_tree, &to->node);
+}
+
+/* Ticks from curr_tick until the given queued timeout expires */
+static inline k_ticks_t timeout_delta(const struct _timeout *t)
+{
+	return t->dticks - (k_ticks_t)curr_tick;
+}
+#else
 static struct _timeout *first(void)
 {
 	sys_dnode_t *t = sys_dlist_peek_head(&timeout_list);
@@ -63,6 +125,32 @@ static void remove_timeout(struct _timeout *t)
 	sys_dlist_remove(&t->node);
 }
 
+/* Inserts a timeout whose dticks holds the delay from curr_tick */
+static void insert_timeout(struct _timeout *to)
+{
+	struct _timeout *t;
+
+	for (t = first(); t != NULL; t = next(t)) {
+		if (t->dticks > to->dticks) {
+			t->dticks -= to->dticks;
+			sys_dlist_insert(&t->node, &to->node);
+			return;
+		}
+		to->dticks -= t->dticks;
+	}
+
+	sys_dlist_append(&timeout_list, &to->node);
+}
+
+/* Ticks from curr_tick until the given timeout expires.  Only valid
+ * for the head of the list, all other entries are relative.
+ */
+static inline k_ticks_t timeout_delta(const struct _timeout *t)
+{
+	return t->dticks;
+}
+#endif /* CONFIG_TIMEOUT_QUEUE_SCALABLE */
+
 static int32_t elapsed(void)
 {
 	/* While sys_clock_announce() is executing, new relative timeouts will be
@@ -91,10 +179,10 @@ static int32_t next_timeout(void)
 	int32_t ret;
 
 	if ((to == NULL) ||
-	    ((int64_t)(to->dticks - ticks_elapsed) > (int64_t)INT_MAX)) {
+	    ((int64_t)(timeout_delta(to) - ticks_elapsed) > (int64_t)INT_MAX)) {
 		ret = MAX_WAIT;
 	} else {
-		ret = MAX(0, to->dticks - ticks_elapsed);
+		ret = MAX(0, timeout_delta(to) - ticks_elapsed);
 	}
 
 	return ret;
@@ -111,12 +199,10 @@ void z_add_timeout(struct _timeout *to, _timeout_func_t fn,
 	__ASSERT_NO_MSG(arch_mem_coherent(to));
 #endif /* CONFIG_KERNEL_COHERENCE */
 
-	__ASSERT(!sys_dnode_is_linked(&to->node), "");
+	__ASSERT(z_is_inactive_timeout(to), "");
 	to->fn = fn;
 
 	K_SPINLOCK(&timeout_lock) {
-		struct _timeout *t;
-
 		if (IS_ENABLED(CONFIG_TIMEOUT_64BIT) &&
 		    (Z_TICK_ABS(timeout.ticks) >= 0)) {
 			k_ticks_t ticks = Z_TICK_ABS(timeout.ticks) - curr_tick;
@@ -126,18 +212,7 @@ void z_add_timeout(struct _timeout *to, _timeout_func_t fn,
 			to->dticks = timeout.ticks + 1 + elapsed();
 		}
 
-		for (t = first(); t != NULL; t = next(t)) {
-			if (t->dticks > to->dticks) {
-				t->dticks -= to->dticks;
-				sys_dlist_insert(&t->node, &to->node);
-				break;
-			}
-			to->dticks -= t->dticks;
-		}
-
-		if (t == NULL) {
-			sys_dlist_append(&timeout_list, &to->node);
-		}
+		insert_timeout(to);
 
 		if (to == first() && announce_remaining == 0) {
 			sys_clock_set_timeout(next_timeout(), false);
@@ -150,7 +225,7 @@ int z_abort_timeout(struct _timeout *to)
 	int ret = -EINVAL;
 
 	K_SPINLOCK(&timeout_lock) {
-		if (sys_dnode_is_linked(&to->node)) {
+		if (!z_is_inactive_timeout(to)) {
 			bool is_first = (to == first());
 
 			remove_timeout(to);
@@ -167,6 +242,9 @@ int z_abort_timeout(struct _timeout *to)
 /* must be locked */
 static k_ticks_t timeout_rem(const struct _timeout *timeout)
 {
+#ifdef CONFIG_TIMEOUT_QUEUE_SCALABLE
+	return timeout_delta(timeout);
+#else
 	k_ticks_t ticks = 0;
 
 	for (struct _timeout *t = first(); t != NULL; t = next(t)) {
@@ -177,6 +255,7 @@ static k_ticks_t timeout_rem(const struct _timeout *timeout)
 	}
 
 	return ticks;
+#endif /* CONFIG_TIMEOUT_QUEUE_SCALABLE */
 }
 
 k_ticks_t z_timeout_remaining(const struct _timeout *timeout)
@@ -237,12 +316,14 @@ void sys_clock_announce(int32_t ticks)
 	struct _timeout *t;
 
 	for (t = first();
-	     (t != NULL) && (t->dticks <= announce_remaining);
+	     (t != NULL) && (timeout_delta(t) <= announce_remaining);
 	     t = first()) {
-		int dt = t->dticks;
+		int dt = timeout_delta(t);
 
 		curr_tick += dt;
-		t->dticks = 0;
+		if (!IS_ENABLED(CONFIG_TIMEOUT_QUEUE_SCALABLE)) {
+			t->dticks = 0;
+		}
 		remove_timeout(t);
 
 		k_spin_unlock(&timeout_lock, key);
@@ -251,7 +332,7 @@ void sys_clock_announce(int32_t ticks)
 		announce_remaining -= dt;
 	}
 
-	if (t != NULL) {
+	if (!IS_ENABLED(CONFIG_TIMEOUT_QUEUE_SCALABLE) && (t != NULL)) {
 		t->dticks -= announce_remaining;
 	}
 
@@ -0,0 +1,131 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Engines shared by the CRC32 (IEEE) and CRC32C (Castagnoli)
+ * implementations.  Both are reflected CRCs, so the same table driven
+ * and instruction based update loops serve either polynomial.  All of
+ * them work on the raw register, pre and post inversion is up to the
+ * caller.
+ */
+
+#ifndef ZEPHYR_LIB_CRC_CRC32_ENGINE_H_
+#define ZEPHYR_LIB_CRC_CRC32_ENGINE_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <zephyr/sys/byteorder.h>
+
+#if defined(CONFIG_CRC32_SLICE_BY_8)
+#define CRC32_TABLE_SLICES 8
+#elif defined(CONFIG_CRC32_SLICE_BY_4)
+#define CRC32_TABLE_SLICES 4
+#elif defined(CONFIG_CRC32_BYTE_TABLE)
+#define CRC32_TABLE_SLICES 1
+#endif
+
+#ifdef CRC32_TABLE_SLICES
+
+#include "crc32_tables.h"
+
+#if CRC32_TABLE_SLICES == 8
+#define CRC32_TABLES(name)                                                     \
+	{ name##_TABLE_0, name##_TABLE_1, name##_TABLE_2, name##_TABLE_3,      \
+	  name##_TABLE_4, name##_TABLE_5, name##_TABLE_6, name##_TABLE_7 }
+#elif CRC32_TABLE_SLICES == 4
+#define CRC32_TABLES(name)                                                     \
+	{ name##_TABLE_0, name##_TABLE_1, name##_TABLE_2, name##_TABLE_3 }
+#else
+#define CRC32_TABLES(name) { name##_TABLE_0 }
+#endif
+
+static inline uint32_t crc32_table_update(const uint32_t table[][256], uint32_t crc,
+					  const uint8_t *data, size_t len)
+{
+#if CRC32_TABLE_SLICES == 8
+	for (; len >= 8; len -= 8, data += 8) {
+		uint32_t lo = crc ^ sys_get_le32(data);
+		uint32_t hi = sys_get_le32(data + 4);
+
+		crc = table[7][lo & 0xff] ^ table[6][(lo >> 8) & 0xff] ^
+		      table[5][(lo >> 16) & 0xff] ^ table[4][lo >> 24] ^
+		      table[3][hi & 0xff] ^ table[2][(hi >> 8) & 0xff] ^
+		      table[1][(hi >> 16) & 0xff] ^ table[0][hi >> 24];
+	}
+#elif CRC32_TABLE_SLICES == 4
+	for (; len >= 4; len -= 4, data += 4) {
+		uint32_t w = crc ^ sys_get_le32(data);
+
+		crc = table[3][w & 0xff] ^ table[2][(w >> 8) & 0xff] ^
+		      table[1][(w >> 16) & 0xff] ^ table[0][w >> 24];
+	}
+#endif
+
+	for (; len > 0; len--, data++) {
+		crc = (crc >> 8) ^ table[0][(crc ^ *data) & 0xff];
+	}
+
+	return crc;
+}
+
+#endif /* CRC32_TABLE_SLICES */
+
+/*
+ * CRC instructions, when the compiler is told the target has them:
+ * ARMv8 has both polynomials, SSE4.2 only has Castagnoli.
+ */
+#if defined(CONFIG_CRC32_HW) && defined(__ARM_FEATURE_CRC32)
+
+#include <arm_acle.h>
+
+#define CRC32_HW_IEEE 1
+#define CRC32_HW_C    1
+
+static inline uint32_t crc32_hw_ieee_update(uint32_t crc, const uint8_t *data, size_t len)
+{
+	for (; len >= 4; len -= 4, data += 4) {
+		crc = __crc32w(crc, sys_get_le32(data));
+	}
+	for (; len > 0; len--, data++) {
+		crc = __crc32b(crc, *data);
+	}
+
+	return crc;
+}
+
+static inline uint32_t crc32_hw_c_update(uint32_t crc, const uint8_t *data, size_t len)
+{
+	for (; len >= 4; len -= 4, data += 4) {
+		crc = __crc32cw(crc, sys_get_le32(data));
+	}
+	for (; len > 0; len--, data++) {
+		crc = __crc32cb(crc, *data);
+	}
+
+	return crc;
+}
+
+#elif defined(CONFIG_CRC32_HW) && defined(__SSE4_2__)
+
+#include <nmmintrin.h>
+
+#define CRC32_HW_C 1
+
+static inline uint32_t crc32_hw_c_update(uint32_t crc, const uint8_t *data, size_t len)
+{
+	for (; len >= 4; len -= 4, data += 4) {
+		crc = _mm_crc32_u32(crc, sys_get_le32(data));
+	}
+	for (; len > 0; len--, data++) {
+		crc = _mm_crc32_u8(crc, *data);
+	}
+
+	return crc;
+}
+
+#endif /* CONFIG_CRC32_HW */
+
+#endif /* ZEPHYR_LIB_CRC_CRC32_ENGINE_H_ */
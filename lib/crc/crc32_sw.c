@@ -5,6 +5,7 @@
  */
 
 #include <zephyr/sys/crc.h>
+#include "crc32_engine.h"
 
 uint32_t crc32_ieee(const uint8_t *data, size_t len)
 {
@@ -13,6 +14,13 @@ uint32_t crc32_ieee(const uint8_t *data, size_t len)
 
 uint32_t crc32_ieee_update(uint32_t crc, const uint8_t *data, size_t len)
 {
+#if defined(CRC32_HW_IEEE)
+	return ~crc32_hw_ieee_update(~crc, data, len);
+#elif defined(CRC32_TABLE_SLICES)
+	static const uint32_t table[CRC32_TABLE_SLICES][256] = CRC32_TABLES(CRC32_IEEE);
+
+	return ~crc32_table_update(table, ~crc, data, len);
+#else
 	/* crc table generated from polynomial 0xedb88320 */
 	static const uint32_t table[16] = {
 		0x00000000U, 0x1db71064U, 0x3b6e20c8U, 0x26d930acU,
@@ -31,4 +39,5 @@ uint32_t crc32_ieee_update(uint32_t crc, const uint8_t *data, size_t len)
 	}
 
 	return (~crc);
+#endif
 }
@@ -0,0 +1,495 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <zephyr/sys/byteorder.h>
+#include <zephyr/sys/hash_map.h>
+#include <zephyr/sys/hash_map_swiss.h>
+#include <zephyr/sys/math_extras.h>
+#include <zephyr/sys/util.h>
+
+/*
+ * A table is an array of entries followed by one control byte per entry. A
+ * control byte is either CTRL_EMPTY, CTRL_MOVED or the top 7 bits of the hash
+ * of the key stored in the entry. Control bytes are read in groups of
+ * GROUP_WIDTH as one 64-bit word and compared to the hash bits of a key with a
+ * few word operations, so entries that can't hold the key are rarely read.
+ * The first GROUP_WIDTH - 1 control bytes are repeated after the last one, so
+ * reading a group never wraps around.
+ *
+ * Keys are placed with linear probing from their home entry. This keeps
+ * removal free of tombstones: the following entries of the probe sequence are
+ * shifted back into the removed entry instead.
+ *
+ * Resizing does not move all entries at once. The previous table is kept and
+ * each following insertion or removal moves REHASH_STEP of its entries, until
+ * it is empty and freed. Entries moved out of or removed from the previous
+ * table are marked CTRL_MOVED rather than shifted, which would disturb the
+ * rehash position. The marks are gone with the table.
+ */
+
+#define GROUP_WIDTH 8
+#define REHASH_STEP (2 * GROUP_WIDTH)
+
+#define CTRL_EMPTY 0x80
+#define CTRL_MOVED 0xfe
+
+#define GROUP_LSBS 0x0101010101010101ULL
+#define GROUP_MSBS 0x8080808080808080ULL
+
+struct swiss_entry {
+	uint64_t key;
+	uint64_t value;
+};
+
+struct swiss_table {
+	struct swiss_entry *entries;
+	uint8_t *ctrl;
+	size_t mask;
+};
+
+BUILD_ASSERT(offsetof(struct sys_hashmap_swiss_data, buckets) ==
+	     offsetof(struct sys_hashmap_data, buckets));
+BUILD_ASSERT(offsetof(struct sys_hashmap_swiss_data, n_buckets) ==
+	     offsetof(struct sys_hashmap_data, n_buckets));
+BUILD_ASSERT(offsetof(struct sys_hashmap_swiss_data, size) ==
+	     offsetof(struct sys_hashmap_data, size));
+
+static inline size_t swiss_alloc_size(size_t n_buckets)
+{
+	return n_buckets * (sizeof(struct swiss_entry) + 1) + GROUP_WIDTH - 1;
+}
+
+static inline struct swiss_table swiss_table(void *buckets, size_t n_buckets)
+{
+	return (struct swiss_table){
+		.entries = buckets,
+		.ctrl = (uint8_t *)buckets + n_buckets * sizeof(struct swiss_entry),
+		.mask = n_buckets - 1,
+	};
+}
+
+static inline uint32_t swiss_hash(const struct sys_hashmap *map, uint64_t key)
+{
+	return map->hash_func(&key, sizeof(key));
+}
+
+static inline uint8_t swiss_h2(uint32_t hash)
+{
+	return hash >> 25;
+}
+
+static inline uint64_t group_load(const uint8_t *ctrl)
+{
+	uint64_t group;
+
+	memcpy(&group, ctrl, sizeof(group));
+
+	return sys_le64_to_cpu(group);
+}
+
+/*
+ * Bytes of the group equal to h2. A byte following a match may be reported as
+ * well, which is sorted out by the key comparison.
+ */
+static inline uint64_t group_match(uint64_t group, uint8_t h2)
+{
+	uint64_t x = group ^ (GROUP_LSBS * h2);
+
+	return (x - GROUP_LSBS) & ~x & GROUP_MSBS;
+}
+
+/* Bytes of the group equal to CTRL_EMPTY, bit 1 tells it from CTRL_MOVED */
+static inline uint64_t group_match_empty(uint64_t group)
+{
+	return group & ~(group << 6) & GROUP_MSBS;
+}
+
+static inline size_t group_first(uint64_t match)
+{
+	return u64_count_trailing_zeros(match) / 8;
+}
+
+static inline void swiss_set_ctrl(struct swiss_table *t, size_t i, uint8_t ctrl)
+{
+	t->ctrl[i] = ctrl;
+	if (i < GROUP_WIDTH - 1) {
+		t->ctrl[t->mask + 1 + i] = ctrl;
+	}
+}
+
+/* Tables always keep an empty entry, which ends every probe sequence */
+static struct swiss_entry *swiss_find(const struct swiss_table *t, uint64_t key, uint32_t hash)
+{
+	const uint8_t h2 = swiss_h2(hash);
+	size_t pos = hash & t->mask;
+	uint64_t group;
+
+	while (true) {
+		group = group_load(&t->ctrl[pos]);
+
+		for (uint64_t m = group_match(group, h2); m != 0; m &= m - 1) {
+			size_t i = (pos + group_first(m)) & t->mask;
+
+			if (t->entries[i].key == key) {
+				return &t->entries[i];
+			}
+		}
+
+		if (group_match_empty(group) != 0) {
+			return NULL;
+		}
+
+		pos = (pos + GROUP_WIDTH) & t->mask;
+	}
+}
+
+/* Place a key which is not in the table into its first empty entry */
+static void swiss_place(struct swiss_table *t, uint64_t key, uint64_t value, uint32_t hash)
+{
+	size_t pos = hash & t->mask;
+	uint64_t empty;
+	size_t i;
+
+	while (true) {
+		empty = group_match_empty(group_load(&t->ctrl[pos]));
+		if (empty != 0) {
+			break;
+		}
+		pos = (pos + GROUP_WIDTH) & t->mask;
+	}
+
+	i = (pos + group_first(empty)) & t->mask;
+	t->entries[i].key = key;
+	t->entries[i].value = value;
+	swiss_set_ctrl(t, i, swiss_h2(hash));
+}
+
+static void swiss_erase(const struct sys_hashmap *map, struct swiss_table *t, size_t hole)
+{
+	size_t home;
+	size_t i = hole;
+
+	/*
+	 * Shift the following entries of the probe sequence back, so that no
+	 * lookup stops at the removed entry before reaching them.
+	 */
+	while (true) {
+		i = (i + 1) & t->mask;
+		if (t->ctrl[i] == CTRL_EMPTY) {
+			break;
+		}
+
+		home = swiss_hash(map, t->entries[i].key) & t->mask;
+		if (((i - home) & t->mask) >= ((i - hole) & t->mask)) {
+			t->entries[hole] = t->entries[i];
+			swiss_set_ctrl(t, hole, t->ctrl[i]);
+			hole = i;
+		}
+	}
+
+	swiss_set_ctrl(t, hole, CTRL_EMPTY);
+}
+
+/* Move up to n entries of the previous table into the current one */
+static void swiss_rehash_step(const struct sys_hashmap *map, size_t n)
+{
+	struct sys_hashmap_swiss_data *data = (struct sys_hashmap_swiss_data *)map->data;
+	struct swiss_table old_t;
+	struct swiss_table t;
+	struct swiss_entry *entry;
+
+	if (data->old_buckets == NULL) {
+		return;
+	}
+
+	old_t = swiss_table(data->old_buckets, data->old_n_buckets);
+	t = swiss_table(data->buckets, data->n_buckets);
+
+	for (; n > 0 && data->rehash_pos < data->old_n_buckets; --n, ++data->rehash_pos) {
+		if (old_t.ctrl[data->rehash_pos] & CTRL_EMPTY) {
+			continue;
+		}
+
+		entry = &old_t.entries[data->rehash_pos];
+		swiss_place(&t, entry->key, entry->value, swiss_hash(map, entry->key));
+		swiss_set_ctrl(&old_t, data->rehash_pos, CTRL_MOVED);
+	}
+
+	if (data->rehash_pos == data->old_n_buckets) {
+		map->alloc_func(data->old_buckets, 0);
+		data->old_buckets = NULL;
+		data->old_n_buckets = 0;
+		data->rehash_pos = 0;
+	}
+}
+
+static int swiss_rehash_start(struct sys_hashmap *map, size_t new_n_buckets)
+{
+	struct sys_hashmap_swiss_data *data = (struct sys_hashmap_swiss_data *)map->data;
+	void *buckets;
+
+	__ASSERT_NO_MSG(data->old_buckets == NULL);
+
+	buckets = map->alloc_func(NULL, swiss_alloc_size(new_n_buckets));
+	if (buckets == NULL) {
+		return -ENOMEM;
+	}
+
+	memset(swiss_table(buckets, new_n_buckets).ctrl, CTRL_EMPTY,
+	       new_n_buckets + GROUP_WIDTH - 1);
+
+	if (data->buckets != NULL) {
+		data->old_buckets = data->buckets;
+		data->old_n_buckets = data->n_buckets;
+		data->rehash_pos = 0;
+	}
+
+	data->buckets = buckets;
+	data->n_buckets = new_n_buckets;
+
+	return 0;
+}
+
+static int swiss_grow(struct sys_hashmap *map)
+{
+	size_t new_n_buckets = 0;
+	struct sys_hashmap_swiss_data *data = (struct sys_hashmap_swiss_data *)map->data;
+
+	/* keep an empty entry even with a load factor of 100 */
+	if (!sys_hashmap_should_rehash(map, true, 0, &new_n_buckets) &&
+	    data->size + 1 < data->n_buckets) {
+		return 0;
+	}
+
+	/* only with very low load factors, the previous rehash is not done yet */
+	swiss_rehash_step(map, SIZE_MAX);
+
+	return swiss_rehash_start(map, MAX(new_n_buckets, GROUP_WIDTH));
+}
+
+static void swiss_shrink(struct sys_hashmap *map)
+{
+	struct sys_hashmap_swiss_data *data = (struct sys_hashmap_swiss_data *)map->data;
+	size_t new_n_buckets = data->n_buckets / 2;
+
+	/*
+	 * Shrink to half the load factor only, so that the following insertions
+	 * do not grow the table again while it is being rehashed.
+	 */
+	if (data->old_buckets != NULL || new_n_buckets < GROUP_WIDTH ||
+	    data->size >= new_n_buckets ||
+	    data->size * 200 / new_n_buckets > map->config->load_factor) {
+		return;
+	}
+
+	/* ignore a possible -ENOMEM since the table will remain intact */
+	(void)swiss_rehash_start(map, new_n_buckets);
+}
+
+static struct swiss_entry *swiss_lookup(const struct sys_hashmap *map, uint64_t key,
+					uint32_t hash, bool *in_old)
+{
+	struct sys_hashmap_swiss_data *data = (struct sys_hashmap_swiss_data *)map->data;
+	struct swiss_table t;
+	struct swiss_entry *entry;
+
+	*in_old = false;
+
+	if (data->n_buckets == 0) {
+		return NULL;
+	}
+
+	t = swiss_table(data->buckets, data->n_buckets);
+	entry = swiss_find(&t, key, hash);
+	if (entry != NULL || data->old_buckets == NULL) {
+		return entry;
+	}
+
+	*in_old = true;
+	t = swiss_table(data->old_buckets, data->old_n_buckets);
+
+	return swiss_find(&t, key, hash);
+}
+
+static void sys_hashmap_swiss_iter_next(struct sys_hashmap_iterator *it)
+{
+	struct swiss_table t;
+	size_t i;
+	size_t j;
+	const struct sys_hashmap *map = (const struct sys_hashmap *)it->map;
+	struct sys_hashmap_swiss_data *data = (struct sys_hashmap_swiss_data *)map->data;
+	const size_t n_total = data->old_n_buckets + data->n_buckets;
+
+	__ASSERT(it->size == map->data->size, "Concurrent modification!");
+	__ASSERT(sys_hashmap_iterator_has_next(it), "Attempt to access beyond current bound!");
+
+	/* the state is the next bucket, counting the previous table first */
+	i = (it->pos == 0) ? 0 : (uintptr_t)it->state;
+	__ASSERT(i < n_total, "Invalid iterator state %p", it->state);
+
+	for (; i < n_total; ++i) {
+		if (i < data->old_n_buckets) {
+			t = swiss_table(data->old_buckets, data->old_n_buckets);
+			j = i;
+		} else {
+			t = swiss_table(data->buckets, data->n_buckets);
+			j = i - data->old_n_buckets;
+		}
+
+		if (!(t.ctrl[j] & CTRL_EMPTY)) {
+			it->state = (void *)(uintptr_t)(i + 1);
+			it->key = t.entries[j].key;
+			it->value = t.entries[j].value;
+			++it->pos;
+			return;
+		}
+	}
+
+	__ASSERT(false, "Entire Hashmap traversed and no entry was found");
+}
+
+/*
+ * Swiss Table Hashmap API
+ */
+
+static void sys_hashmap_swiss_iter(const struct sys_hashmap *map, struct sys_hashmap_iterator *it)
+{
+	it->map = map;
+	it->next = sys_hashmap_swiss_iter_next;
+	it->pos = 0;
+	*((size_t *)&it->size) = map->data->size;
+}
+
+static void sys_hashmap_swiss_clear(struct sys_hashmap *map, sys_hashmap_callback_t cb,
+				    void *cookie)
+{
+	struct sys_hashmap_swiss_data *data = (struct sys_hashmap_swiss_data *)map->data;
+	struct sys_hashmap_iterator it = {0};
+
+	for (sys_hashmap_swiss_iter(map, &it); cb != NULL && sys_hashmap_iterator_has_next(&it);) {
+		it.next(&it);
+		cb(it.key, it.value, cookie);
+	}
+
+	if (data->old_buckets != NULL) {
+		map->alloc_func(data->old_buckets, 0);
+		data->old_buckets = NULL;
+	}
+
+	if (data->buckets != NULL) {
+		map->alloc_func(data->buckets, 0);
+		data->buckets = NULL;
+	}
+
+	data->old_n_buckets = 0;
+	data->rehash_pos = 0;
+	data->n_buckets = 0;
+	data->size = 0;
+}
+
+static int sys_hashmap_swiss_insert(struct sys_hashmap *map, uint64_t key, uint64_t value,
+				    uint64_t *old_value)
+{
+	int ret;
+	bool in_old;
+	struct swiss_table t;
+	struct swiss_entry *entry;
+	const uint32_t hash = swiss_hash(map, key);
+	struct sys_hashmap_swiss_data *data = (struct sys_hashmap_swiss_data *)map->data;
+
+	entry = swiss_lookup(map, key, hash, &in_old);
+	if (entry != NULL) {
+		if (old_value != NULL) {
+			*old_value = entry->value;
+		}
+		entry->value = value;
+		ret = 0;
+	} else {
+		if (data->size >= map->config->max_size) {
+			return -ENOSPC;
+		}
+
+		ret = swiss_grow(map);
+		if (ret < 0) {
+			return ret;
+		}
+
+		t = swiss_table(data->buckets, data->n_buckets);
+		swiss_place(&t, key, value, hash);
+		++data->size;
+		ret = 1;
+	}
+
+	swiss_rehash_step(map, REHASH_STEP);
+
+	return ret;
+}
+
+static bool sys_hashmap_swiss_remove(struct sys_hashmap *map, uint64_t key, uint64_t *value)
+{
+	bool in_old;
+	struct swiss_table t;
+	struct swiss_entry *entry;
+	struct sys_hashmap_swiss_data *data = (struct sys_hashmap_swiss_data *)map->data;
+
+	entry = swiss_lookup(map, key, swiss_hash(map, key), &in_old);
+	if (entry == NULL) {
+		return false;
+	}
+
+	if (value != NULL) {
+		*value = entry->value;
+	}
+
+	if (in_old) {
+		t = swiss_table(data->old_buckets, data->old_n_buckets);
+		swiss_set_ctrl(&t, entry - t.entries, CTRL_MOVED);
+	} else {
+		t = swiss_table(data->buckets, data->n_buckets);
+		swiss_erase(map, &t, entry - t.entries);
+	}
+
+	if (--data->size == 0) {
+		sys_hashmap_swiss_clear(map, NULL, NULL);
+		return true;
+	}
+
+	swiss_rehash_step(map, REHASH_STEP);
+	swiss_shrink(map);
+
+	return true;
+}
+
+static bool sys_hashmap_swiss_get(const struct sys_hashmap *map, uint64_t key, uint64_t *value)
+{
+	bool in_old;
+	struct swiss_entry *entry;
+
+	entry = swiss_lookup(map, key, swiss_hash(map, key), &in_old);
+	if (entry == NULL) {
+		return false;
+	}
+
+	if (value != NULL) {
+		*value = entry->value;
+	}
+
+	return true;
+}
+
+const struct sys_hashmap_api sys_hashmap_swiss_api = {
+	.iter = sys_hashmap_swiss_iter,
+	.clear = sys_hashmap_swiss_clear,
+	.insert = sys_hashmap_swiss_insert,
+	.remove = sys_hashmap_swiss_remove,
+	.get = sys_hashmap_swiss_get,
+};
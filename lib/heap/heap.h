@@ -247,6 +247,28 @@ static inline size_t chunksz_to_bytes(struct z_heap *h, chunksz_t chunksz_in)
 	return chunksz_in * CHUNK_UNIT - chunk_header_bytes(h);
 }
 
+static inline void *chunk_mem(struct z_heap *h, chunkid_t c)
+{
+	chunk_unit_t *buf = chunk_buf(h);
+	uint8_t *ret = ((uint8_t *)&buf[c]) + chunk_header_bytes(h);
+
+	CHECK(!(((uintptr_t)ret) & (big_heap(h) ? 7 : 3)));
+
+	return ret;
+}
+
+/*
+ * Return the closest chunk ID corresponding to given memory pointer.
+ * Here "closest" is only meaningful in the context of sys_heap_aligned_alloc()
+ * where wanted alignment might not always correspond to a chunk header
+ * boundary.
+ */
+static inline chunkid_t mem_to_chunkid(struct z_heap *h, void *p)
+{
+	uint8_t *mem = p, *base = (uint8_t *)chunk_buf(h);
+	return (mem - chunk_header_bytes(h) - base) / CHUNK_UNIT;
+}
+
 static inline int bucket_idx(struct z_heap *h, chunksz_t sz)
 {
 	unsigned int usable_sz = sz - min_chunk_size(h) + 1;
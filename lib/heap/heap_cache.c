@@ -0,0 +1,244 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include <zephyr/sys/sys_heap.h>
+#include <zephyr/sys/util.h>
+#include <zephyr/kernel.h>
+#include <string.h>
+#include "heap.h"
+
+/* Per-CPU magazine cache.
+ *
+ * Each CPU owns one magazine (a small LIFO stack of free blocks) per
+ * power-of-two size class.  The fast paths only ever touch the
+ * magazines of the CPU they run on, under that CPU's cache lock, so
+ * they never contend on the heap lock.  The slow paths move blocks
+ * between a magazine and the heap in batches, and run under the heap
+ * lock provided by the user.  Flushing is the only operation touching
+ * the magazines of other CPUs, which is what the per-CPU lock is for.
+ * Lock order is heap lock first, then a CPU cache lock.
+ */
+
+BUILD_ASSERT(CONFIG_SYS_HEAP_CACHE_BATCH <= CONFIG_SYS_HEAP_CACHE_DEPTH,
+	     "magazine batch must not exceed its depth");
+
+static inline size_t class_bytes(int cls)
+{
+	return (size_t)1 << (cls + SYS_HEAP_CACHE_MIN_SHIFT);
+}
+
+/* Size class serving a request, or -1 if it is not cached */
+static inline int request_class(size_t bytes)
+{
+	if ((bytes == 0U) || (bytes > class_bytes(SYS_HEAP_CACHE_CLASSES - 1))) {
+		return -1;
+	}
+	if (bytes <= class_bytes(0)) {
+		return 0;
+	}
+	return __z_log2(bytes - 1) + 1 - SYS_HEAP_CACHE_MIN_SHIFT;
+}
+
+/* Size class of an allocated block, or -1 if it can't be cached.
+ * Only whole chunks of exactly a class size qualify, so anything that
+ * was realloc'ed or carved out of an aligned allocation goes back to
+ * the heap.
+ */
+static int block_class(struct z_heap *h, void *mem)
+{
+	chunkid_t c = mem_to_chunkid(h, mem);
+	chunksz_t sz;
+
+	if (mem != chunk_mem(h, c)) {
+		return -1;
+	}
+
+	__ASSERT(chunk_used(h, c),
+		 "unexpected heap state (double-free?) for memory at %p", mem);
+
+	sz = chunk_size(h, c);
+	for (int cls = 0; cls < SYS_HEAP_CACHE_CLASSES; cls++) {
+		if (sz == bytes_to_chunksz(h, class_bytes(cls))) {
+			return cls;
+		}
+	}
+
+	return -1;
+}
+
+/* Locks the magazines of the current CPU.  Being migrated after
+ * picking them is harmless: the lock still makes using another CPU's
+ * magazines safe, it is just no longer uncontended.
+ */
+static inline struct sys_heap_cpu_cache *cpu_cache_lock(struct sys_heap *heap,
+							k_spinlock_key_t *key)
+{
+	struct sys_heap_cpu_cache *cc;
+
+#ifdef CONFIG_SMP
+	cc = &heap->cache->cpu[arch_curr_cpu()->id];
+#else
+	cc = &heap->cache->cpu[0];
+#endif
+	*key = k_spin_lock(&cc->lock);
+
+	return cc;
+}
+
+static inline void cpu_cache_unlock(struct sys_heap_cpu_cache *cc, k_spinlock_key_t key)
+{
+	k_spin_unlock(&cc->lock, key);
+}
+
+void sys_heap_cache_init(struct sys_heap *heap, struct sys_heap_cache *cache)
+{
+	(void)memset(cache, 0, sizeof(*cache));
+	heap->cache = cache;
+}
+
+void *sys_heap_cache_alloc(struct sys_heap *heap, size_t bytes)
+{
+	int cls = request_class(bytes);
+	struct sys_heap_cpu_cache *cc;
+	struct sys_heap_magazine *mag;
+	void *mem = NULL;
+	k_spinlock_key_t key;
+
+	if ((heap->cache == NULL) || (cls < 0)) {
+		return NULL;
+	}
+
+	cc = cpu_cache_lock(heap, &key);
+	mag = &cc->mags[cls];
+	if (mag->count > 0U) {
+		mem = mag->blocks[--mag->count];
+		cc->hits++;
+	} else {
+		cc->misses++;
+	}
+	cpu_cache_unlock(cc, key);
+
+	return mem;
+}
+
+void *sys_heap_cache_refill(struct sys_heap *heap, size_t bytes)
+{
+	int cls = request_class(bytes);
+	struct sys_heap_cpu_cache *cc;
+	struct sys_heap_magazine *mag;
+	k_spinlock_key_t key;
+	void *mem;
+
+	if ((heap->cache == NULL) || (cls < 0)) {
+		mem = sys_heap_alloc(heap, bytes);
+		if ((mem == NULL) && (heap->cache != NULL)) {
+			sys_heap_cache_flush(heap);
+			mem = sys_heap_alloc(heap, bytes);
+		}
+		return mem;
+	}
+
+	mem = sys_heap_alloc(heap, class_bytes(cls));
+	if (mem == NULL) {
+		/* Let what all CPUs hoard coalesce back and retry */
+		sys_heap_cache_flush(heap);
+		return sys_heap_alloc(heap, class_bytes(cls));
+	}
+
+	cc = cpu_cache_lock(heap, &key);
+	mag = &cc->mags[cls];
+	for (int i = 0; (i < CONFIG_SYS_HEAP_CACHE_BATCH) &&
+			(mag->count < CONFIG_SYS_HEAP_CACHE_DEPTH); i++) {
+		void *blk = sys_heap_alloc(heap, class_bytes(cls));
+
+		if (blk == NULL) {
+			break;
+		}
+		mag->blocks[mag->count++] = blk;
+	}
+	cpu_cache_unlock(cc, key);
+
+	return mem;
+}
+
+bool sys_heap_cache_free(struct sys_heap *heap, void *mem)
+{
+	struct sys_heap_cpu_cache *cc;
+	struct sys_heap_magazine *mag;
+	bool cached = false;
+	k_spinlock_key_t key;
+	int cls;
+
+	if ((heap->cache == NULL) || (mem == NULL)) {
+		return false;
+	}
+
+	cls = block_class(heap->heap, mem);
+	if (cls < 0) {
+		return false;
+	}
+
+	cc = cpu_cache_lock(heap, &key);
+	mag = &cc->mags[cls];
+	if (mag->count < CONFIG_SYS_HEAP_CACHE_DEPTH) {
+		mag->blocks[mag->count++] = mem;
+		cached = true;
+	}
+	cpu_cache_unlock(cc, key);
+
+	return cached;
+}
+
+void sys_heap_cache_drain(struct sys_heap *heap, void *mem)
+{
+	struct sys_heap_cpu_cache *cc;
+	struct sys_heap_magazine *mag;
+	k_spinlock_key_t key;
+	int cls = -1;
+
+	if ((heap->cache != NULL) && (mem != NULL)) {
+		cls = block_class(heap->heap, mem);
+	}
+
+	if (cls < 0) {
+		sys_heap_free(heap, mem);
+		return;
+	}
+
+	cc = cpu_cache_lock(heap, &key);
+	mag = &cc->mags[cls];
+	if (mag->count == CONFIG_SYS_HEAP_CACHE_DEPTH) {
+		/* Give back the oldest blocks, the recent ones are still warm */
+		for (int i = 0; i < CONFIG_SYS_HEAP_CACHE_BATCH; i++) {
+			sys_heap_free(heap, mag->blocks[i]);
+		}
+		mag->count -= CONFIG_SYS_HEAP_CACHE_BATCH;
+		(void)memmove(&mag->blocks[0], &mag->blocks[CONFIG_SYS_HEAP_CACHE_BATCH],
+			      mag->count * sizeof(mag->blocks[0]));
+	}
+	mag->blocks[mag->count++] = mem;
+	cpu_cache_unlock(cc, key);
+}
+
+void sys_heap_cache_flush(struct sys_heap *heap)
+{
+	if (heap->cache == NULL) {
+		return;
+	}
+
+	for (int cpu = 0; cpu < CONFIG_MP_MAX_NUM_CPUS; cpu++) {
+		struct sys_heap_cpu_cache *cc = &heap->cache->cpu[cpu];
+		k_spinlock_key_t key = k_spin_lock(&cc->lock);
+
+		for (int cls = 0; cls < SYS_HEAP_CACHE_CLASSES; cls++) {
+			struct sys_heap_magazine *mag = &cc->mags[cls];
+
+			while (mag->count > 0U) {
+				sys_heap_free(heap, mag->blocks[--mag->count]);
+			}
+		}
+		k_spin_unlock(&cc->lock, key);
+	}
+}
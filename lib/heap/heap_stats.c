@@ -19,6 +19,17 @@ int sys_heap_runtime_stats_get(struct sys_heap *heap,
 	stats->allocated_bytes = heap->heap->allocated_bytes;
 	stats->max_allocated_bytes = heap->heap->max_allocated_bytes;
 
+#ifdef CONFIG_SYS_HEAP_CACHE
+	stats->cache_hits = 0;
+	stats->cache_misses = 0;
+	if (heap->cache != NULL) {
+		for (int i = 0; i < CONFIG_MP_MAX_NUM_CPUS; i++) {
+			stats->cache_hits += heap->cache->cpu[i].hits;
+			stats->cache_misses += heap->cache->cpu[i].misses;
+		}
+	}
+#endif
+
 	return 0;
 }
 
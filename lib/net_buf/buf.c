@@ -222,6 +222,184 @@ static uint8_t *data_ref(struct net_buf *buf, uint8_t *data)
 	return pool->alloc->cb->ref(buf, data);
 }
 
+/* Put back a list of buffers of a pool, linked through node. Each one is
+ * prepended to the free LIFO, so the last buffers of the list, the most
+ * recently used ones, are handed out first while still cache-hot.
+ */
+static void pool_free_prepend(struct net_buf_pool *pool, struct net_buf *head)
+{
+	struct net_buf *buf;
+
+	while (head != NULL) {
+		buf = head;
+		head = SYS_SLIST_PEEK_NEXT_CONTAINER(buf, node);
+		k_lifo_put(&pool->free, buf);
+	}
+}
+
+#if defined(CONFIG_NET_BUF_POOL_CACHE)
+/* Must be called with local interrupts masked */
+static inline struct net_buf_pool_cpu_cache *cpu_cache(struct net_buf_pool *pool)
+{
+#ifdef CONFIG_SMP
+	return &pool->cache->cpu[arch_curr_cpu()->id];
+#else
+	return &pool->cache->cpu[0];
+#endif
+}
+
+void net_buf_pool_cache_init(struct net_buf_pool *pool, struct net_buf_pool_cache *cache)
+{
+	(void)memset(cache, 0, sizeof(*cache));
+	pool->cache = cache;
+}
+
+/* Take up to count buffers cached by this CPU, linked through frags */
+static size_t cache_get(struct net_buf_pool *pool, struct net_buf **head, size_t count)
+{
+	struct net_buf_pool_cpu_cache *cc;
+	struct net_buf *buf;
+	unsigned int key;
+	size_t n = 0;
+
+	if (pool->cache == NULL) {
+		return 0;
+	}
+
+	key = arch_irq_lock();
+	cc = cpu_cache(pool);
+	for (; n < count && cc->count > 0U; n++) {
+		buf = cc->bufs[--cc->count];
+		buf->frags = *head;
+		*head = buf;
+	}
+	arch_irq_unlock(key);
+
+	return n;
+}
+
+/* Move the buffers cached by this CPU into a list linked through node,
+ * the most recently cached one last.
+ */
+static struct net_buf *cache_take_all(struct net_buf_pool *pool)
+{
+	struct net_buf_pool_cpu_cache *cc;
+	struct net_buf *head = NULL;
+	unsigned int key;
+
+	key = arch_irq_lock();
+	cc = cpu_cache(pool);
+	while (cc->count > 0U) {
+		struct net_buf *buf = cc->bufs[--cc->count];
+
+		buf->node.next = (head != NULL) ? &head->node : NULL;
+		head = buf;
+	}
+	arch_irq_unlock(key);
+
+	return head;
+}
+
+/* Cache the buffers of a list linked through node, return the rest */
+static struct net_buf *cache_put_list(struct net_buf_pool *pool, struct net_buf *head)
+{
+	struct net_buf_pool_cpu_cache *cc;
+	unsigned int key;
+
+	if (pool->cache == NULL) {
+		return head;
+	}
+
+	key = arch_irq_lock();
+	cc = cpu_cache(pool);
+	/* Checked with interrupts masked, so that a local waiter either sees
+	 * the cached buffers or the buffers are not cached.
+	 */
+	while (head != NULL && cc->count < CONFIG_NET_BUF_POOL_CACHE_SIZE &&
+	       atomic_get(&pool->cache->waiters) == 0) {
+		cc->bufs[cc->count++] = head;
+		head = SYS_SLIST_PEEK_NEXT_CONTAINER(head, node);
+	}
+	arch_irq_unlock(key);
+
+	return head;
+}
+
+void net_buf_pool_cache_flush(struct net_buf_pool *pool)
+{
+	pool_free_prepend(pool, cache_take_all(pool));
+}
+
+bool net_buf_pool_cache_put(struct net_buf_pool *pool, struct net_buf *buf)
+{
+	buf->node.next = NULL;
+	if (cache_put_list(pool, buf) == NULL) {
+		return true;
+	}
+
+	/* An allocation waits, don't keep buffers it could use */
+	if (atomic_get(&pool->cache->waiters) != 0) {
+		net_buf_pool_cache_flush(pool);
+	}
+
+	return false;
+}
+#endif /* CONFIG_NET_BUF_POOL_CACHE */
+
+/* Put back a list of destroyed buffers of a pool, linked through node */
+static void pool_free_list(struct net_buf_pool *pool, struct net_buf *head)
+{
+#if defined(CONFIG_NET_BUF_POOL_CACHE)
+	head = cache_put_list(pool, head);
+	if (head == NULL) {
+		return;
+	}
+
+	if (pool->cache != NULL && atomic_get(&pool->cache->waiters) != 0) {
+		net_buf_pool_cache_flush(pool);
+	}
+#endif
+
+	pool_free_prepend(pool, head);
+}
+
+/* Set up a buffer taken from the pool, with size bytes of data */
+static int buf_init(struct net_buf *buf, size_t size, k_timepoint_t end)
+{
+	if (size) {
+#if __ASSERT_ON
+		size_t req_size = size;
+#endif
+		buf->__buf = data_alloc(buf, &size, sys_timepoint_timeout(end));
+		if (!buf->__buf) {
+			return -ENOMEM;
+		}
+
+#if __ASSERT_ON
+		NET_BUF_ASSERT(req_size <= size);
+#endif
+	} else {
+		buf->__buf = NULL;
+	}
+
+	buf->ref   = 1U;
+	buf->flags = 0U;
+	buf->frags = NULL;
+	buf->size  = size;
+	memset(buf->user_data, 0, buf->user_data_size);
+	net_buf_reset(buf);
+
+#if defined(CONFIG_NET_BUF_POOL_USAGE)
+	struct net_buf_pool *pool = net_buf_pool_get(buf->pool_id);
+
+	atomic_dec(&pool->avail_count);
+	__ASSERT_NO_MSG(atomic_get(&pool->avail_count) >= 0);
+	pool->max_used = MAX(pool->max_used,
+			     pool->buf_count - atomic_get(&pool->avail_count));
+#endif
+	return 0;
+}
+
 #if defined(CONFIG_NET_BUF_LOG)
 struct net_buf *net_buf_alloc_len_debug(struct net_buf_pool *pool, size_t size,
 					k_timeout_t timeout, const char *func,
@@ -239,6 +417,13 @@ struct net_buf *net_buf_alloc_len(struct net_buf_pool *pool, size_t size,
 
 	NET_BUF_DBG("%s():%d: pool %p size %zu", func, line, pool, size);
 
+#if defined(CONFIG_NET_BUF_POOL_CACHE)
+	buf = NULL;
+	if (cache_get(pool, &buf, 1)) {
+		goto success;
+	}
+#endif
+
 	/* We need to prevent race conditions
 	 * when accessing pool->uninit_count.
 	 */
@@ -271,6 +456,18 @@ struct net_buf *net_buf_alloc_len(struct net_buf_pool *pool, size_t size,
 
 	k_spin_unlock(&pool->lock, key);
 
+#if defined(CONFIG_NET_BUF_POOL_CACHE)
+	if (pool->cache != NULL && !K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+		/* Freed buffers bypass the caches while waiting */
+		atomic_inc(&pool->cache->waiters);
+		buf = NULL;
+		if (cache_get(pool, &buf, 1)) {
+			atomic_dec(&pool->cache->waiters);
+			goto success;
+		}
+	}
+#endif
+
 #if defined(CONFIG_NET_BUF_LOG) && (CONFIG_NET_BUF_LOG_LEVEL >= LOG_LEVEL_WRN)
 	if (K_TIMEOUT_EQ(timeout, K_FOREVER)) {
 		uint32_t ref = k_uptime_get_32();
@@ -300,6 +497,13 @@ struct net_buf *net_buf_alloc_len(struct net_buf_pool *pool, size_t size,
 #else
 	buf = k_lifo_get(&pool->free, timeout);
 #endif
+
+#if defined(CONFIG_NET_BUF_POOL_CACHE)
+	if (pool->cache != NULL && !K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+		atomic_dec(&pool->cache->waiters);
+	}
+#endif
+
 	if (!buf) {
 		NET_BUF_ERR("%s():%d: Failed to get free buffer", func, line);
 		return NULL;
@@ -308,40 +512,160 @@ struct net_buf *net_buf_alloc_len(struct net_buf_pool *pool, size_t size,
 success:
 	NET_BUF_DBG("allocated buf %p", buf);
 
-	if (size) {
-#if __ASSERT_ON
-		size_t req_size = size;
+	if (buf_init(buf, size, end)) {
+		NET_BUF_ERR("%s():%d: Failed to allocate data", func, line);
+		net_buf_destroy(buf);
+		return NULL;
+	}
+
+	return buf;
+}
+
+/* Take up to count buffers without waiting, linked through frags */
+static size_t pool_get_free(struct net_buf_pool *pool, struct net_buf **head,
+			    size_t count)
+{
+	struct net_buf *buf;
+	k_spinlock_key_t key;
+	size_t n = 0;
+
+#if defined(CONFIG_NET_BUF_POOL_CACHE)
+	n += cache_get(pool, head, count);
 #endif
-		timeout = sys_timepoint_timeout(end);
-		buf->__buf = data_alloc(buf, &size, timeout);
-		if (!buf->__buf) {
-			NET_BUF_ERR("%s():%d: Failed to allocate data",
-				    func, line);
-			net_buf_destroy(buf);
-			return NULL;
+
+	key = k_spin_lock(&pool->lock);
+
+	if (pool->uninit_count < pool->buf_count) {
+		for (; n < count; n++) {
+			buf = k_lifo_get(&pool->free, K_NO_WAIT);
+			if (!buf) {
+				break;
+			}
+			buf->frags = *head;
+			*head = buf;
 		}
+	}
 
-#if __ASSERT_ON
-		NET_BUF_ASSERT(req_size <= size);
-#endif
-	} else {
+	for (; n < count && pool->uninit_count; n++) {
+		buf = pool_get_uninit(pool, pool->uninit_count--);
 		buf->__buf = NULL;
+		buf->frags = *head;
+		*head = buf;
 	}
 
-	buf->ref   = 1U;
-	buf->flags = 0U;
-	buf->frags = NULL;
-	buf->size  = size;
-	memset(buf->user_data, 0, buf->user_data_size);
-	net_buf_reset(buf);
+	k_spin_unlock(&pool->lock, key);
 
+	return n;
+}
+
+/* Give back buffers taken by pool_get_free(), linked through frags */
+static void pool_put_free(struct net_buf_pool *pool, struct net_buf *head)
+{
+	struct net_buf *list = head;
+	struct net_buf *buf;
+
+	while (head != NULL) {
+		buf = head;
+		head = buf->frags;
+		buf->frags = NULL;
+		buf->node.next = (head != NULL) ? &head->node : NULL;
+	}
+
+	pool_free_list(pool, list);
+}
+
+#if defined(CONFIG_NET_BUF_LOG)
+struct net_buf *net_buf_alloc_len_bulk_debug(struct net_buf_pool *pool, size_t size,
+					     size_t count, k_timeout_t timeout,
+					     const char *func, int line)
+#else
+struct net_buf *net_buf_alloc_len_bulk(struct net_buf_pool *pool, size_t size,
+				       size_t count, k_timeout_t timeout)
+#endif
+{
+	k_timepoint_t end = sys_timepoint_calc(timeout);
+	struct net_buf *head = NULL;
+	struct net_buf *chain = NULL;
+	struct net_buf *buf;
+	size_t n = 0;
+
+	__ASSERT_NO_MSG(pool);
+	__ASSERT_NO_MSG(count > 0);
+
+	NET_BUF_DBG("%s():%d: pool %p size %zu count %zu", func, line, pool,
+		    size, count);
+
+	/* Collect the buffers in a list linked through frags first. A partial
+	 * set is never held while blocking, so that concurrent allocations
+	 * cannot starve each other: it goes back to the pool and the whole
+	 * set is tried for again.
+	 */
+	while (true) {
+		n += pool_get_free(pool, &head, count - n);
+		if (n == count) {
+			break;
+		}
+
+		pool_put_free(pool, head);
+		head = NULL;
+
+		if (K_TIMEOUT_EQ(timeout, K_NO_WAIT) || sys_timepoint_expired(end)) {
+			n = 0;
+			break;
+		}
+
+		if (n > 0) {
+			/* The buffers just given back are all the pool has,
+			 * poll for more instead of spinning on them.
+			 */
+			n = 0;
+			k_sleep(K_TICKS(1));
+			continue;
+		}
+
+		/* The pool is empty, wait for a buffer to be freed */
+#if defined(CONFIG_NET_BUF_LOG)
+		buf = net_buf_alloc_len_debug(pool, 0, sys_timepoint_timeout(end), func, line);
+#else
+		buf = net_buf_alloc_len(pool, 0, sys_timepoint_timeout(end));
+#endif
+		if (!buf) {
+			break;
+		}
 #if defined(CONFIG_NET_BUF_POOL_USAGE)
-	atomic_dec(&pool->avail_count);
-	__ASSERT_NO_MSG(atomic_get(&pool->avail_count) >= 0);
-	pool->max_used = MAX(pool->max_used,
-			     pool->buf_count - atomic_get(&pool->avail_count));
+		/* buf_init() below accounts for it again */
+		atomic_inc(&pool->avail_count);
 #endif
-	return buf;
+		buf->frags = NULL;
+		head = buf;
+		n = 1;
+	}
+
+	/* Set up the buffers and link them as fragments of the chain */
+	while (head) {
+		buf = head;
+		head = buf->frags;
+
+		if (n < count || buf_init(buf, size, end)) {
+			buf->frags = NULL;
+			net_buf_destroy(buf);
+			n = 0;
+			continue;
+		}
+
+		buf->frags = chain;
+		chain = buf;
+	}
+
+	if (n < count) {
+		NET_BUF_ERR("%s():%d: Failed to get %zu buffers", func, line, count);
+		if (chain) {
+			net_buf_unref(chain);
+		}
+		return NULL;
+	}
+
+	return chain;
 }
 
 #if defined(CONFIG_NET_BUF_LOG)
@@ -453,6 +777,10 @@ void net_buf_unref_debug(struct net_buf *buf, const char *func, int line)
 void net_buf_unref(struct net_buf *buf)
 #endif
 {
+	struct net_buf_pool *list_pool = NULL;
+	struct net_buf *head = NULL;
+	struct net_buf *tail = NULL;
+
 	__ASSERT_NO_MSG(buf);
 
 	while (buf) {
@@ -463,14 +791,14 @@ void net_buf_unref(struct net_buf *buf)
 		if (!buf->ref) {
 			NET_BUF_ERR("%s():%d: buf %p double free", func, line,
 				    buf);
-			return;
+			break;
 		}
 #endif
 		NET_BUF_DBG("buf %p ref %u pool_id %u frags %p", buf, buf->ref,
 			    buf->pool_id, buf->frags);
 
 		if (--buf->ref > 0) {
-			return;
+			break;
 		}
 
 		buf->data = NULL;
@@ -485,12 +813,40 @@ void net_buf_unref(struct net_buf *buf)
 
 		if (pool->destroy) {
 			pool->destroy(buf);
+			buf = frags;
+			continue;
+		}
+
+		/* Collect the fragments of a pool to put them back at once */
+		if (pool != list_pool) {
+			if (head) {
+				pool_free_list(list_pool, head);
+			}
+			list_pool = pool;
+			head = NULL;
+		}
+
+		if (buf->__buf) {
+			if (!(buf->flags & NET_BUF_EXTERNAL_DATA)) {
+				pool->alloc->cb->unref(buf, buf->__buf);
+			}
+			buf->__buf = NULL;
+		}
+
+		buf->node.next = NULL;
+		if (head) {
+			tail->node.next = &buf->node;
 		} else {
-			net_buf_destroy(buf);
+			head = buf;
 		}
+		tail = buf;
 
 		buf = frags;
 	}
+
+	if (head) {
+		pool_free_list(list_pool, head);
+	}
 }
 
 struct net_buf *net_buf_ref(struct net_buf *buf)
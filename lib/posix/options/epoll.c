@@ -0,0 +1,36 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+
+#include <zephyr/net/socket_epoll.h>
+#include <zephyr/posix/sys/epoll.h>
+
+int epoll_create(int size)
+{
+	/* The size hint is ignored, but must be positive like on Linux */
+	if (size <= 0) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	return zsock_epoll_create(0);
+}
+
+int epoll_create1(int flags)
+{
+	return zsock_epoll_create(flags);
+}
+
+int epoll_ctl(int epfd, int op, int fd, struct epoll_event *event)
+{
+	return zsock_epoll_ctl(epfd, op, fd, event);
+}
+
+int epoll_wait(int epfd, struct epoll_event *events, int maxevents, int timeout)
+{
+	return zsock_epoll_wait(epfd, events, maxevents, timeout);
+}
@@ -5,7 +5,6 @@
  */
 
 #include <zephyr/sys/__assert.h>
-#include <ctype.h>
 #include <errno.h>
 #include <limits.h>
 #include <zephyr/sys/printk.h>
@@ -59,203 +58,178 @@ static void emit(struct json_lexer *lex, enum json_tokens token)
 	lex->start = lex->pos;
 }
 
-static int next(struct json_lexer *lex)
-{
-	if (lex->pos >= lex->end) {
-		lex->pos = lex->end + 1;
-
-		return '\0';
-	}
-
-	return *lex->pos++;
-}
-
-static void ignore(struct json_lexer *lex)
-{
-	lex->start = lex->pos;
-}
+/* Character classes, looked up by the lexers instead of going through ctype */
+#define CC_SPACE      BIT(0)
+#define CC_DIGIT      BIT(1)
+#define CC_XDIGIT     BIT(2)
+/* Characters ending a run of plain characters in a string */
+#define CC_STRING_END BIT(3)
+/* Characters of a number after the first one */
+#define CC_NUMBER     BIT(4)
+/* Characters of a number accepted by the streaming parser */
+#define CC_NUMBER_EXT BIT(5)
+
+static const uint8_t char_class[256] = {
+	['\0'] = CC_STRING_END,
+	['\t'] = CC_SPACE,
+	['\n'] = CC_SPACE,
+	['\v'] = CC_SPACE,
+	['\f'] = CC_SPACE,
+	['\r'] = CC_SPACE,
+	[' '] = CC_SPACE,
+	['"'] = CC_STRING_END,
+	['\\'] = CC_STRING_END,
+	['+'] = CC_NUMBER_EXT,
+	['-'] = CC_NUMBER_EXT,
+	['.'] = CC_NUMBER | CC_NUMBER_EXT,
+	['0' ... '9'] = CC_DIGIT | CC_XDIGIT | CC_NUMBER | CC_NUMBER_EXT,
+	['A' ... 'D'] = CC_XDIGIT,
+	['E'] = CC_XDIGIT | CC_NUMBER_EXT,
+	['F'] = CC_XDIGIT,
+	['a' ... 'd'] = CC_XDIGIT,
+	['e'] = CC_XDIGIT | CC_NUMBER_EXT,
+	['f'] = CC_XDIGIT,
+};
 
-static void backup(struct json_lexer *lex)
+static inline bool char_is(char chr, uint8_t class)
 {
-	lex->pos--;
+	return (char_class[(uint8_t)chr] & class) != 0;
 }
 
-static int peek(struct json_lexer *lex)
+static void *lexer_error(struct json_lexer *lex, char *pos)
 {
-	int chr = next(lex);
-
-	backup(lex);
+	lex->pos = pos;
+	emit(lex, JSON_TOK_ERROR);
 
-	return chr;
+	return NULL;
 }
 
-static void *lexer_string(struct json_lexer *lex)
+static void *lexer_string(struct json_lexer *lex, char *pos)
 {
-	ignore(lex);
+	lex->start = pos;
 
 	while (true) {
-		int chr = next(lex);
-
-		if (chr == '\0') {
-			emit(lex, JSON_TOK_ERROR);
-			return NULL;
+		/* Skip the characters without special meaning at once */
+		while (pos < lex->end && !char_is(*pos, CC_STRING_END)) {
+			pos++;
 		}
 
-		if (chr == '\\') {
-			switch (next(lex)) {
-			case '"':
-			case '\\':
-			case '/':
-			case 'b':
-			case 'f':
-			case 'n':
-			case 'r':
-			case 't':
-				continue;
-			case 'u':
-				if (isxdigit(next(lex)) == 0) {
-					goto error;
-				}
-
-				if (isxdigit(next(lex)) == 0) {
-					goto error;
-				}
-
-				if (isxdigit(next(lex)) == 0) {
-					goto error;
-				}
-
-				if (isxdigit(next(lex)) == 0) {
-					goto error;
-				}
-
-				break;
-			default:
-				goto error;
-			}
+		if (pos >= lex->end || *pos == '\0') {
+			return lexer_error(lex, pos);
 		}
 
-		if (chr == '"') {
-			backup(lex);
+		if (*pos == '"') {
+			lex->pos = pos;
 			emit(lex, JSON_TOK_STRING);
 
-			next(lex);
-			ignore(lex);
+			lex->pos = pos + 1;
+			lex->start = lex->pos;
 
 			return lexer_json;
 		}
-	}
 
-error:
-	emit(lex, JSON_TOK_ERROR);
-	return NULL;
-}
-
-static int accept_run(struct json_lexer *lex, const char *run)
-{
-	for (; *run; run++) {
-		if (next(lex) != *run) {
-			return -EINVAL;
+		/* Escape sequence */
+		if (++pos >= lex->end) {
+			return lexer_error(lex, pos);
 		}
-	}
-
-	return 0;
-}
 
-static void *lexer_boolean(struct json_lexer *lex)
-{
-	backup(lex);
+		switch (*pos++) {
+		case '"':
+		case '\\':
+		case '/':
+		case 'b':
+		case 'f':
+		case 'n':
+		case 'r':
+		case 't':
+			break;
+		case 'u':
+			if (lex->end - pos < 4 || !char_is(pos[0], CC_XDIGIT) ||
+			    !char_is(pos[1], CC_XDIGIT) || !char_is(pos[2], CC_XDIGIT) ||
+			    !char_is(pos[3], CC_XDIGIT)) {
+				return lexer_error(lex, pos);
+			}
 
-	switch (next(lex)) {
-	case 't':
-		if (!accept_run(lex, "rue")) {
-			emit(lex, JSON_TOK_TRUE);
-			return lexer_json;
-		}
-		break;
-	case 'f':
-		if (!accept_run(lex, "alse")) {
-			emit(lex, JSON_TOK_FALSE);
-			return lexer_json;
+			pos += 4;
+			break;
+		default:
+			return lexer_error(lex, pos);
 		}
-		break;
 	}
-
-	emit(lex, JSON_TOK_ERROR);
-	return NULL;
 }
 
-static void *lexer_null(struct json_lexer *lex)
+static void *lexer_literal(struct json_lexer *lex, char *pos, const char *run,
+			   enum json_tokens token)
 {
-	if (accept_run(lex, "ull") < 0) {
-		emit(lex, JSON_TOK_ERROR);
-		return NULL;
+	size_t len = strlen(run);
+
+	if ((size_t)(lex->end - pos) < len || memcmp(pos, run, len) != 0) {
+		return lexer_error(lex, pos);
 	}
 
-	emit(lex, JSON_TOK_NULL);
+	lex->pos = pos + len;
+	emit(lex, token);
+
 	return lexer_json;
 }
 
-static void *lexer_number(struct json_lexer *lex)
+static void *lexer_json(struct json_lexer *lex)
 {
-	while (true) {
-		int chr = next(lex);
-
-		if (isdigit(chr) != 0 || chr == '.') {
-			continue;
-		}
-
-		backup(lex);
-		emit(lex, JSON_TOK_NUMBER);
+	char *pos = lex->pos;
+	char chr;
 
-		return lexer_json;
+	while (pos < lex->end && char_is(*pos, CC_SPACE)) {
+		pos++;
 	}
-}
 
-static void *lexer_json(struct json_lexer *lex)
-{
-	while (true) {
-		int chr = next(lex);
-
-		switch (chr) {
-		case '\0':
-			emit(lex, JSON_TOK_EOF);
-			return NULL;
-		case '}':
-		case '{':
-		case '[':
-		case ']':
-		case ',':
-		case ':':
-			emit(lex, (enum json_tokens)chr);
-			return lexer_json;
-		case '"':
-			return lexer_string;
-		case 'n':
-			return lexer_null;
-		case 't':
-		case 'f':
-			return lexer_boolean;
-		case '-':
-			if (isdigit(peek(lex)) != 0) {
-				return lexer_number;
-			}
+	lex->start = pos;
 
-			__fallthrough;
-		default:
-			if (isspace(chr) != 0) {
-				ignore(lex);
-				continue;
-			}
+	if (pos >= lex->end || *pos == '\0') {
+		lex->pos = pos;
+		emit(lex, JSON_TOK_EOF);
+		return NULL;
+	}
 
-			if (isdigit(chr) != 0) {
-				return lexer_number;
-			}
+	chr = *pos++;
 
-			emit(lex, JSON_TOK_ERROR);
-			return NULL;
+	switch (chr) {
+	case '}':
+	case '{':
+	case '[':
+	case ']':
+	case ',':
+	case ':':
+		lex->pos = pos;
+		emit(lex, (enum json_tokens)chr);
+		return lexer_json;
+	case '"':
+		return lexer_string(lex, pos);
+	case 'n':
+		return lexer_literal(lex, pos, "ull", JSON_TOK_NULL);
+	case 't':
+		return lexer_literal(lex, pos, "rue", JSON_TOK_TRUE);
+	case 'f':
+		return lexer_literal(lex, pos, "alse", JSON_TOK_FALSE);
+	case '-':
+		if (pos >= lex->end || !char_is(*pos, CC_DIGIT)) {
+			return lexer_error(lex, pos);
+		}
+		break;
+	default:
+		if (!char_is(chr, CC_DIGIT)) {
+			return lexer_error(lex, pos);
 		}
+		break;
 	}
+
+	while (pos < lex->end && char_is(*pos, CC_NUMBER)) {
+		pos++;
+	}
+
+	lex->pos = pos;
+	emit(lex, JSON_TOK_NUMBER);
+
+	return lexer_json;
 }
 
 static void lexer_init(struct json_lexer *lex, char *data, size_t len)
@@ -856,6 +830,433 @@ int json_arr_separate_parse_object(struct json_obj *json, const struct json_obj_
 	return obj_parse(json, descr, descr_len, val);
 }
 
+/* What the streaming parser expects next */
+enum stream_state {
+	STREAM_VALUE,
+	STREAM_VALUE_OR_ARRAY_END,
+	STREAM_KEY,
+	STREAM_KEY_OR_OBJECT_END,
+	STREAM_COLON,
+	STREAM_COMMA_OR_END,
+	STREAM_DONE,
+	STREAM_ERROR,
+};
+
+/* Token being scanned by the streaming parser */
+enum stream_tok_state {
+	STREAM_TOK_NONE,
+	STREAM_TOK_STRING,
+	STREAM_TOK_ESCAPE,
+	STREAM_TOK_UNICODE,
+	STREAM_TOK_NUMBER,
+	STREAM_TOK_LITERAL,
+};
+
+static const char *stream_literal(enum json_tokens type)
+{
+	switch (type) {
+	case JSON_TOK_TRUE:
+		return "true";
+	case JSON_TOK_FALSE:
+		return "false";
+	default:
+		return "null";
+	}
+}
+
+/*
+ * Scan the current token up to its end or to the end of the chunk. Returns 1
+ * if the token ended, with pos at the character following it, 0 if the chunk
+ * ended first.
+ */
+static int stream_scan(struct json_stream *stream, const char **pos, const char *end)
+{
+	const char *p = *pos;
+	const char *literal;
+
+	while (p < end) {
+		switch (stream->tok_state) {
+		case STREAM_TOK_STRING:
+			while (p < end && !char_is(*p, CC_STRING_END)) {
+				p++;
+			}
+
+			if (p == end) {
+				break;
+			}
+
+			if (*p == '"') {
+				*pos = p;
+				return 1;
+			}
+
+			if (*p == '\0') {
+				return -EINVAL;
+			}
+
+			p++;
+			stream->tok_state = STREAM_TOK_ESCAPE;
+			break;
+		case STREAM_TOK_ESCAPE:
+			switch (*p++) {
+			case '"':
+			case '\\':
+			case '/':
+			case 'b':
+			case 'f':
+			case 'n':
+			case 'r':
+			case 't':
+				stream->tok_state = STREAM_TOK_STRING;
+				break;
+			case 'u':
+				stream->tok_state = STREAM_TOK_UNICODE;
+				stream->tok_pos = 0;
+				break;
+			default:
+				return -EINVAL;
+			}
+			break;
+		case STREAM_TOK_UNICODE:
+			if (!char_is(*p++, CC_XDIGIT)) {
+				return -EINVAL;
+			}
+
+			if (++stream->tok_pos == 4) {
+				stream->tok_state = STREAM_TOK_STRING;
+			}
+			break;
+		case STREAM_TOK_NUMBER:
+			while (p < end && char_is(*p, CC_NUMBER_EXT)) {
+				p++;
+			}
+
+			if (p < end) {
+				*pos = p;
+				return 1;
+			}
+			break;
+		case STREAM_TOK_LITERAL:
+			literal = stream_literal(stream->tok_type);
+
+			if (*p++ != literal[stream->tok_pos]) {
+				return -EINVAL;
+			}
+
+			if (literal[++stream->tok_pos] == '\0') {
+				*pos = p;
+				return 1;
+			}
+			break;
+		default:
+			return -EINVAL;
+		}
+	}
+
+	*pos = p;
+
+	return 0;
+}
+
+/* Keep the part of the current token found in this chunk for the next ones */
+static int stream_save(struct json_stream *stream, const char *start, const char *end)
+{
+	size_t len = end - start;
+
+	if (len == 0) {
+		return 0;
+	}
+
+	if (stream->key_len + stream->tok_len + len > stream->buf_size) {
+		return -ENOMEM;
+	}
+
+	memcpy(stream->buf + stream->key_len + stream->tok_len, start, len);
+	stream->tok_len += len;
+
+	return 0;
+}
+
+static int stream_emit(struct json_stream *stream, enum json_tokens type,
+		       const char *value, size_t value_len)
+{
+	struct json_stream_event event = {
+		.type = type,
+		.key = stream->has_key ? stream->buf : NULL,
+		.key_len = stream->has_key ? stream->key_len : 0,
+		.value = value,
+		.value_len = value_len,
+		.depth = stream->depth,
+	};
+
+	return stream->cb(&event, stream->user_data);
+}
+
+static void stream_value_done(struct json_stream *stream)
+{
+	stream->has_key = false;
+	stream->key_len = 0;
+	stream->state = stream->depth == 0 ? STREAM_DONE : STREAM_COMMA_OR_END;
+}
+
+/* Handle the end of the token that started at start, or in a previous chunk */
+static int stream_token_done(struct json_stream *stream, const char *start, const char *end)
+{
+	const char *text = start;
+	size_t len = end - start;
+	int ret;
+
+	if (stream->tok_len > 0) {
+		ret = stream_save(stream, start, end);
+		if (ret < 0) {
+			return ret;
+		}
+
+		text = stream->buf + stream->key_len;
+		len = stream->tok_len;
+		stream->tok_len = 0;
+	}
+
+	stream->tok_state = STREAM_TOK_NONE;
+
+	if (stream->state == STREAM_KEY || stream->state == STREAM_KEY_OR_OBJECT_END) {
+		if (len > stream->buf_size) {
+			return -ENOMEM;
+		}
+
+		memmove(stream->buf, text, len);
+		stream->key_len = len;
+		stream->has_key = true;
+		stream->state = STREAM_COLON;
+
+		return 0;
+	}
+
+	if (stream->tok_type == JSON_TOK_STRING || stream->tok_type == JSON_TOK_NUMBER) {
+		ret = stream_emit(stream, stream->tok_type, text, len);
+	} else {
+		ret = stream_emit(stream, stream->tok_type, NULL, 0);
+	}
+
+	stream_value_done(stream);
+
+	return ret;
+}
+
+static int stream_container_start(struct json_stream *stream, enum json_tokens type)
+{
+	int ret;
+
+	if (stream->depth == JSON_STREAM_MAX_DEPTH) {
+		return -E2BIG;
+	}
+
+	ret = stream_emit(stream, type, NULL, 0);
+	if (ret < 0) {
+		return ret;
+	}
+
+	if (type == JSON_TOK_OBJECT_START) {
+		stream->containers |= BIT(stream->depth);
+		stream->state = STREAM_KEY_OR_OBJECT_END;
+	} else {
+		stream->containers &= ~BIT(stream->depth);
+		stream->state = STREAM_VALUE_OR_ARRAY_END;
+	}
+
+	stream->depth++;
+	stream->has_key = false;
+	stream->key_len = 0;
+
+	return 0;
+}
+
+static int stream_container_end(struct json_stream *stream, enum json_tokens type)
+{
+	bool in_object;
+	int ret;
+
+	if (stream->depth == 0) {
+		return -EINVAL;
+	}
+
+	in_object = (stream->containers & BIT(stream->depth - 1)) != 0;
+	if (in_object != (type == JSON_TOK_OBJECT_END)) {
+		return -EINVAL;
+	}
+
+	stream->depth--;
+
+	ret = stream_emit(stream, type, NULL, 0);
+
+	stream_value_done(stream);
+
+	return ret;
+}
+
+/* Handle a character outside of strings, numbers and literals */
+static int stream_structural(struct json_stream *stream, const char **pos)
+{
+	char chr = **pos;
+	enum stream_state state = stream->state;
+	bool value = state == STREAM_VALUE || state == STREAM_VALUE_OR_ARRAY_END;
+	bool key = state == STREAM_KEY || state == STREAM_KEY_OR_OBJECT_END;
+
+	(*pos)++;
+
+	switch (chr) {
+	case '{':
+		return value ? stream_container_start(stream, JSON_TOK_OBJECT_START) : -EINVAL;
+	case '[':
+		return value ? stream_container_start(stream, JSON_TOK_ARRAY_START) : -EINVAL;
+	case '}':
+		if (state != STREAM_KEY_OR_OBJECT_END && state != STREAM_COMMA_OR_END) {
+			return -EINVAL;
+		}
+		return stream_container_end(stream, JSON_TOK_OBJECT_END);
+	case ']':
+		if (state != STREAM_VALUE_OR_ARRAY_END && state != STREAM_COMMA_OR_END) {
+			return -EINVAL;
+		}
+		return stream_container_end(stream, JSON_TOK_ARRAY_END);
+	case ',':
+		if (state != STREAM_COMMA_OR_END) {
+			return -EINVAL;
+		}
+		stream->state = (stream->containers & BIT(stream->depth - 1)) ? STREAM_KEY
+									      : STREAM_VALUE;
+		return 0;
+	case ':':
+		if (state != STREAM_COLON) {
+			return -EINVAL;
+		}
+		stream->state = STREAM_VALUE;
+		return 0;
+	case '"':
+		if (!value && !key) {
+			return -EINVAL;
+		}
+		stream->tok_state = STREAM_TOK_STRING;
+		stream->tok_type = JSON_TOK_STRING;
+		return 0;
+	case 't':
+	case 'f':
+	case 'n':
+		if (!value) {
+			return -EINVAL;
+		}
+		stream->tok_state = STREAM_TOK_LITERAL;
+		stream->tok_type = chr;
+		stream->tok_pos = 1;
+		return 0;
+	default:
+		if (!value || (chr != '-' && !char_is(chr, CC_DIGIT))) {
+			return -EINVAL;
+		}
+		/* The first character is part of the number */
+		(*pos)--;
+		stream->tok_state = STREAM_TOK_NUMBER;
+		stream->tok_type = JSON_TOK_NUMBER;
+		return 0;
+	}
+}
+
+void json_stream_init(struct json_stream *stream, char *buf, size_t buf_size,
+		      json_stream_cb_t cb, void *user_data)
+{
+	*stream = (struct json_stream) {
+		.cb = cb,
+		.user_data = user_data,
+		.buf = buf,
+		.buf_size = buf_size,
+		.state = STREAM_VALUE,
+		.tok_state = STREAM_TOK_NONE,
+	};
+}
+
+static int stream_feed(struct json_stream *stream, const char *pos, const char *end)
+{
+	const char *start = pos;
+	int ret;
+
+	while (pos < end) {
+		if (stream->tok_state != STREAM_TOK_NONE) {
+			ret = stream_scan(stream, &pos, end);
+			if (ret < 0) {
+				return ret;
+			}
+
+			if (ret == 0) {
+				if (stream->tok_state == STREAM_TOK_LITERAL) {
+					return 0;
+				}
+				return stream_save(stream, start, end);
+			}
+
+			ret = stream_token_done(stream, start, pos);
+			if (ret < 0) {
+				return ret;
+			}
+
+			/* Skip the closing quote */
+			if (*pos == '"' && stream->tok_type == JSON_TOK_STRING) {
+				pos++;
+			}
+			continue;
+		}
+
+		if (char_is(*pos, CC_SPACE)) {
+			pos++;
+			continue;
+		}
+
+		if (stream->state == STREAM_DONE) {
+			return -EINVAL;
+		}
+
+		ret = stream_structural(stream, &pos);
+		if (ret < 0) {
+			return ret;
+		}
+
+		start = pos;
+	}
+
+	return 0;
+}
+
+int json_stream_feed(struct json_stream *stream, const char *data, size_t len)
+{
+	int ret;
+
+	if (stream->state == STREAM_ERROR) {
+		return -EINVAL;
+	}
+
+	ret = stream_feed(stream, data, data + len);
+	if (ret < 0) {
+		stream->state = STREAM_ERROR;
+	}
+
+	return ret;
+}
+
+int json_stream_finish(struct json_stream *stream)
+{
+	int ret;
+
+	if (stream->depth == 0 && stream->tok_state == STREAM_TOK_NUMBER) {
+		/* The number has been saved by json_stream_feed() */
+		ret = stream_token_done(stream, stream->buf, stream->buf);
+		if (ret < 0) {
+			stream->state = STREAM_ERROR;
+			return ret;
+		}
+	}
+
+	return stream->state == STREAM_DONE ? 0 : -EINVAL;
+}
+
 static char escape_as(char chr)
 {
 	switch (chr) {
@@ -25,6 +25,17 @@ LOG_MODULE_DECLARE(zbus, CONFIG_ZBUS_LOG_LEVEL);
 #define CONSUMER_STACK_SIZE (CONFIG_IDLE_STACK_SIZE + CONFIG_BM_MESSAGE_SIZE)
 #define PRODUCER_STACK_SIZE (CONFIG_MAIN_STACK_SIZE + CONFIG_BM_MESSAGE_SIZE)
 
+#if defined(CONFIG_BM_LOAN)
+ZBUS_CHAN_DEFINE_LOAN(bm_channel,           /* Name */
+		      struct bm_msg,        /* Message type */
+		      CONFIG_BM_LOAN_SLOTS, /* Slots */
+
+		      NULL,                 /* Validator */
+		      NULL,                 /* User data */
+		      ZBUS_OBSERVERS_EMPTY, /* observers */
+		      ZBUS_MSG_INIT(0)      /* Initial value {0} */
+);
+#else
 ZBUS_CHAN_DEFINE(bm_channel,    /* Name */
 		 struct bm_msg, /* Message type */
 
@@ -33,18 +44,19 @@ ZBUS_CHAN_DEFINE(bm_channel,    /* Name */
 		 ZBUS_OBSERVERS_EMPTY, /* observers */
 		 ZBUS_MSG_INIT(0)      /* Initial value {0} */
 );
+#endif /* CONFIG_BM_LOAN */
 
 #define BYTES_TO_BE_SENT (256LLU * 1024LLU)
 atomic_t count;
 
 static void producer_thread(void)
 {
-	LOG_INF("Benchmark 1 to %d using %s to transmit with message size: %u bytes",
+	LOG_INF("Benchmark 1 to %d using %s%s to transmit with message size: %u bytes",
 		CONFIG_BM_ONE_TO,
 		IS_ENABLED(CONFIG_BM_LISTENERS)
 			? "LISTENERS"
 			: (IS_ENABLED(CONFIG_BM_SUBSCRIBERS) ? "SUBSCRIBERS" : "MSG_SUBSCRIBERS"),
-		CONFIG_BM_MESSAGE_SIZE);
+		IS_ENABLED(CONFIG_BM_LOAN) ? " and LOAN" : "", CONFIG_BM_MESSAGE_SIZE);
 
 	struct bm_msg msg = {{0}};
 
@@ -56,7 +68,15 @@ static void producer_thread(void)
 
 	for (uint64_t internal_count = BYTES_TO_BE_SENT / CONFIG_BM_ONE_TO; internal_count > 0;
 	     internal_count -= CONFIG_BM_MESSAGE_SIZE) {
+#if defined(CONFIG_BM_LOAN)
+		struct bm_msg *slot;
+
+		zbus_chan_loan(&bm_channel, (void **)&slot, K_FOREVER);
+		memcpy(slot->bytes, &message_size, sizeof(message_size));
+		zbus_chan_pub_loan(&bm_channel, slot, K_FOREVER);
+#else
 		zbus_chan_pub(&bm_channel, &msg, K_FOREVER);
+#endif /* CONFIG_BM_LOAN */
 	}
 
 	uint64_t end_ns = GET_ARCH_TIME_NS();
@@ -64,3 +64,10 @@ class LogParser(abc.ABC):
     def parse_log_data(self, logdata, debug=False):
         """Parse log data"""
         return None
+
+
+    def parse_log_stream(self, logdata):
+        """Parse the next chunk of a continuous stream of log data.
+        Parsers which cannot carry incomplete messages over to the next
+        chunk parse each chunk on its own."""
+        return self.parse_log_data(logdata)
@@ -22,6 +22,7 @@ from colorama import Fore
 
 from .log_parser import (LogParser, get_log_level_str_color, formalize_fmt_string)
 from .data_types import DataTypes
+from .utils import decode_varint
 
 
 HEX_BYTES_IN_LINE = 16
@@ -46,6 +47,7 @@ FMT_MSG_HDR_64 = "BHHQ"
 # Message type
 # 0: normal message
 # 1: number of dropped messages
+# 2: normal message in compact format
 FMT_MSG_TYPE = "B"
 
 # Depends on CONFIG_LOG_TIMESTAMP_64BIT
@@ -55,6 +57,11 @@ FMT_MSG_TIMESTAMP_64 = "Q"
 # Keep message types in sync with include/logging/log_output_dict.h
 MSG_TYPE_NORMAL = 0
 MSG_TYPE_DROPPED = 1
+MSG_TYPE_NORMAL_COMPACT = 2
+
+# Flag in the info byte of a compact message, see
+# LOG_DICT_COMPACT_TS_ABSOLUTE in include/logging/log_output_dict.h.
+COMPACT_TS_ABSOLUTE = 0x80
 
 # Number of dropped messages
 FMT_DROPPED_CNT = "H"
@@ -85,8 +92,19 @@ class LogParserV3(LogParser):
 
         if "CONFIG_LOG_TIMESTAMP_64BIT" in self.database.get_kconfigs():
             self.fmt_msg_timestamp = endian + FMT_MSG_TIMESTAMP_64
+            self.timestamp_mask = (1 << 64) - 1
         else:
             self.fmt_msg_timestamp = endian + FMT_MSG_TIMESTAMP_32
+            self.timestamp_mask = (1 << 32) - 1
+
+        # Package arguments of compact messages are sent as 32-bit words
+        self.fmt_pkg_word = endian + "I"
+
+        # Timestamp of the previous compact message
+        self.last_timestamp = 0
+
+        # Data of an incomplete message at the end of a stream chunk
+        self.stream_data = b''
 
 
     def __get_string(self, arg, arg_offset, string_tbl):
@@ -354,32 +372,157 @@ class LogParserV3(LogParser):
         return next_msg_offset
 
 
+    def parse_one_compact_msg(self, logdata, offset):
+        """Parse one compact log message and print the encoded message"""
+        frame_len, offset = decode_varint(logdata, offset)
+        next_msg_offset = offset + frame_len
+
+        info = logdata[offset]
+        offset += 1
+        level = info & 0x07
+        domain_id = (info >> 3) & 0x0F
+
+        source_id, offset = decode_varint(logdata, offset)
+        timestamp, offset = decode_varint(logdata, offset)
+        data_len, offset = decode_varint(logdata, offset)
+
+        # The target sends an absolute timestamp every so often, so after a
+        # lost message the timestamps are only off until the next one.
+        if (info & COMPACT_TS_ABSOLUTE) == 0:
+            timestamp = (self.last_timestamp + timestamp) & self.timestamp_mask
+
+        self.last_timestamp = timestamp
+
+        # Rebuild the package. The first word is the package header
+        # which holds the number of argument words.
+        word, offset = decode_varint(logdata, offset)
+        package = struct.pack(self.fmt_pkg_word, word)
+        num_words = package[0]
+
+        for _ in range(1, num_words):
+            word, offset = decode_varint(logdata, offset)
+            package += struct.pack(self.fmt_pkg_word, word)
+
+        package += logdata[offset:(next_msg_offset - data_len)]
+        extra_data = logdata[(next_msg_offset - data_len):next_msg_offset]
+
+        # Hand over to the normal message parser
+        if self.is_big_endian:
+            domain_lvl = (domain_id << 4) | level
+        else:
+            domain_lvl = (level << 4) | domain_id
+
+        msg = struct.pack(self.fmt_msg_hdr, domain_lvl, len(package), data_len, source_id)
+        msg += struct.pack(self.fmt_msg_timestamp, timestamp)
+        msg += package + extra_data
+
+        if self.parse_one_normal_msg(msg, 0) is None:
+            return None
+
+        return next_msg_offset
+
+
+    def get_msg_len(self, logdata, offset):
+        """Get the length of the message at offset, including the
+        message type, or None if the data does not hold the complete
+        message"""
+        avail = len(logdata) - offset
+        type_len = struct.calcsize(self.fmt_msg_type)
+        if avail < type_len:
+            return None
+
+        msg_type = struct.unpack_from(self.fmt_msg_type, logdata, offset)[0]
+
+        if msg_type == MSG_TYPE_DROPPED:
+            msg_len = type_len + struct.calcsize(self.fmt_dropped_cnt)
+
+        elif msg_type == MSG_TYPE_NORMAL:
+            hdr_len = struct.calcsize(self.fmt_msg_hdr)
+            if avail < type_len + hdr_len:
+                return None
+
+            _, pkg_len, data_len, _ = struct.unpack_from(self.fmt_msg_hdr, logdata,
+                                                         offset + type_len)
+            msg_len = (type_len + hdr_len + struct.calcsize(self.fmt_msg_timestamp) +
+                       pkg_len + data_len)
+
+        elif msg_type == MSG_TYPE_NORMAL_COMPACT:
+            ret = decode_varint(logdata, offset + type_len)
+            if ret is None:
+                return None
+
+            frame_len, frame_offset = ret
+            msg_len = frame_offset - offset + frame_len
+
+        else:
+            # Unknown type, let the parser report it
+            msg_len = type_len
+
+        return msg_len if msg_len <= avail else None
+
+
+    def parse_one_msg(self, logdata, offset):
+        """Parse one log message of any type and print it. Return the
+        offset of the next message, or None on error"""
+        # Get message type
+        msg_type = struct.unpack_from(self.fmt_msg_type, logdata, offset)[0]
+        offset += struct.calcsize(self.fmt_msg_type)
+
+        if msg_type == MSG_TYPE_DROPPED:
+            num_dropped = struct.unpack_from(self.fmt_dropped_cnt, logdata, offset)
+            offset += struct.calcsize(self.fmt_dropped_cnt)
+
+            print(f"--- {num_dropped} messages dropped ---")
+
+            return offset
+
+        if msg_type == MSG_TYPE_NORMAL:
+            return self.parse_one_normal_msg(logdata, offset)
+
+        if msg_type == MSG_TYPE_NORMAL_COMPACT:
+            return self.parse_one_compact_msg(logdata, offset)
+
+        logger.error("------ Unknown message type: %s", msg_type)
+        return None
+
+
     def parse_log_data(self, logdata, debug=False):
         """Parse binary log data and print the encoded log messages"""
         offset = 0
 
         while offset < len(logdata):
-            # Get message type
-            msg_type = struct.unpack_from(self.fmt_msg_type, logdata, offset)[0]
-            offset += struct.calcsize(self.fmt_msg_type)
+            ret = self.parse_one_msg(logdata, offset)
+            if ret is None:
+                return False
 
-            if msg_type == MSG_TYPE_DROPPED:
-                num_dropped = struct.unpack_from(self.fmt_dropped_cnt, logdata, offset)
-                offset += struct.calcsize(self.fmt_dropped_cnt)
+            offset = ret
 
-                print(f"--- {num_dropped} messages dropped ---")
+        return True
 
-            elif msg_type == MSG_TYPE_NORMAL:
-                ret = self.parse_one_normal_msg(logdata, offset)
-                if ret is None:
-                    return False
 
-                offset = ret
+    def parse_log_stream(self, logdata):
+        """Parse the next chunk of a continuous stream of binary log
+        data and print the complete log messages. A message which is
+        not complete yet is kept until the next chunk arrives."""
+        data = self.stream_data + logdata
+        offset = 0
 
-            else:
-                logger.error("------ Unknown message type: %s", msg_type)
+        while True:
+            msg_len = self.get_msg_len(data, offset)
+            if msg_len is None:
+                break
+
+            ret = self.parse_one_msg(data[:offset + msg_len], offset)
+            if ret is None:
+                # Cannot tell where the next message starts, drop the data
+                # received so far and continue with the next chunk.
+                self.stream_data = b''
                 return False
 
+            offset = ret
+
+        self.stream_data = data[offset:]
+
         return True
 
 colorama.init()
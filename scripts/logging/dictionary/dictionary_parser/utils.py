@@ -65,3 +65,25 @@ def find_string_in_mappings(string_mappings, str_ptr):
             return whole_str[str_ptr - ptr:]
 
     return None
+
+
+def decode_varint(data, offset):
+    """
+    Decode one unsigned LEB128 varint at offset. Return a tuple of
+    the value and the offset after it, or None if the data ends
+    before the varint does.
+    """
+    value = 0
+    shift = 0
+
+    while offset < len(data):
+        byte = data[offset]
+        offset += 1
+
+        value |= (byte & 0x7F) << shift
+        shift += 7
+
+        if (byte & 0x80) == 0:
+            return (value, offset)
+
+    return None
@@ -0,0 +1,123 @@
+#!/usr/bin/env python3
+#
+# Copyright The Zephyr Project Contributors
+#
+# SPDX-License-Identifier: Apache-2.0
+
+"""
+Streaming Log Parser for Dictionary-based Logging
+
+This uses the JSON database file to decode binary log data as
+it arrives and print the log messages. The data can be read from
+a file which is still being written (e.g. by the file system
+backend or a capture tool), from standard input, or from a UDP or
+TCP socket (e.g. the network backend).
+"""
+
+import argparse
+import logging
+import socket
+import sys
+import time
+
+import parserlib
+
+LOGGER_FORMAT = "%(message)s"
+logger = logging.getLogger("parser")
+
+CHUNK_SIZE = 4096
+
+
+def parse_args():
+    """Parse command line arguments"""
+    argparser = argparse.ArgumentParser(allow_abbrev=False)
+
+    argparser.add_argument("dbfile", help="Dictionary Logging Database file")
+
+    source = argparser.add_mutually_exclusive_group(required=True)
+    source.add_argument("--file",
+                        help="Log data file, '-' for standard input")
+    source.add_argument("--udp", type=int, metavar="PORT",
+                        help="Receive log data on this UDP port")
+    source.add_argument("--tcp", metavar="HOST:PORT",
+                        help="Receive log data from this TCP server")
+
+    argparser.add_argument("--follow", action="store_true",
+                           help="Keep reading the file as it grows")
+    argparser.add_argument("--debug", action="store_true",
+                           help="Print extra debugging information")
+
+    return argparser.parse_args()
+
+
+def read_file(args):
+    """Generate chunks of log data from a file or standard input"""
+    if args.file == '-':
+        logfile = sys.stdin.buffer
+    else:
+        logfile = open(args.file, "rb")
+
+    with logfile:
+        while True:
+            data = logfile.read1(CHUNK_SIZE) if args.file == '-' else logfile.read(CHUNK_SIZE)
+            if data:
+                yield data
+            elif args.follow:
+                time.sleep(0.1)
+            else:
+                return
+
+
+def read_udp(args):
+    """Generate chunks of log data from UDP datagrams"""
+    with socket.socket(socket.AF_INET, socket.SOCK_DGRAM) as sock:
+        sock.bind(("", args.udp))
+
+        while True:
+            yield sock.recv(65535)
+
+
+def read_tcp(args):
+    """Generate chunks of log data from a TCP connection"""
+    host, port = args.tcp.rsplit(":", 1)
+
+    with socket.create_connection((host, int(port))) as sock:
+        while True:
+            data = sock.recv(CHUNK_SIZE)
+            if not data:
+                return
+
+            yield data
+
+
+def main():
+    """Main function of streaming log parser"""
+    args = parse_args()
+
+    # Setup logging for parser
+    logging.basicConfig(format=LOGGER_FORMAT)
+    if args.debug:
+        logger.setLevel(logging.DEBUG)
+    else:
+        logger.setLevel(logging.INFO)
+
+    log_parser = parserlib.get_log_parser(args.dbfile, logger)
+
+    if args.udp is not None:
+        chunks = read_udp(args)
+    elif args.tcp is not None:
+        chunks = read_tcp(args)
+    else:
+        chunks = read_file(args)
+
+    try:
+        for data in chunks:
+            if not log_parser.parse_log_stream(data):
+                logger.error("ERROR: there were error(s) parsing log data")
+            sys.stdout.flush()
+    except KeyboardInterrupt:
+        pass
+
+
+if __name__ == "__main__":
+    main()
@@ -50,14 +50,18 @@ def main():
     else:
         logger.setLevel(logging.INFO)
 
-    # Parse the log every second from serial port
+    log_parser = parserlib.get_log_parser(args.dbfile, logger)
+
+    # Parse the log every second from serial port. Messages split
+    # between reads are completed by the next read.
     with serial.Serial(args.serialPort, args.baudrate) as ser:
         ser.timeout = 2
         while True:
             size = ser.inWaiting()
             if size:
                 data = ser.read(size)
-                parserlib.parser(data, args.dbfile, logger)
+                if not log_parser.parse_log_stream(data):
+                    logger.error("ERROR: there were error(s) parsing log data")
             time.sleep(1)
 
 if __name__ == "__main__":
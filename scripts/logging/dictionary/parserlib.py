@@ -19,8 +19,8 @@ import dictionary_parser
 from dictionary_parser.log_database import LogDatabase
 
 
-def parser(logdata, dbfile, logger):
-    """function of serial parser"""
+def get_log_parser(dbfile, logger):
+    """Get the log parser for the database file"""
     # Read from database file
     database = LogDatabase.read_json_database(dbfile)
 
@@ -31,22 +31,30 @@ def parser(logdata, dbfile, logger):
         logger.error("ERROR: Cannot open database file:  exiting...")
         sys.exit(1)
 
+    log_parser = dictionary_parser.get_parser(database)
+    if log_parser is None:
+        logger.error("ERROR: Cannot find a suitable parser matching database version!")
+        sys.exit(1)
+
+    logger.debug("# Build ID: %s", database.get_build_id())
+    logger.debug("# Target: %s, %d-bit", database.get_arch(), database.get_tgt_bits())
+    if database.is_tgt_little_endian():
+        logger.debug("# Endianness: Little")
+    else:
+        logger.debug("# Endianness: Big")
+
+    return log_parser
+
+
+def parser(logdata, dbfile, logger):
+    """function of serial parser"""
+    log_parser = get_log_parser(dbfile, logger)
+
     if logdata is None:
         logger.error("ERROR: cannot read log from file:  exiting...")
         sys.exit(1)
 
-    log_parser = dictionary_parser.get_parser(database)
-    if log_parser is not None:
-        logger.debug("# Build ID: %s", database.get_build_id())
-        logger.debug("# Target: %s, %d-bit", database.get_arch(), database.get_tgt_bits())
-        if database.is_tgt_little_endian():
-            logger.debug("# Endianness: Little")
-        else:
-            logger.debug("# Endianness: Big")
-
-        ret = log_parser.parse_log_data(logdata)
-        if not ret:
-            logger.error("ERROR: there were error(s) parsing log data")
-            sys.exit(1)
-    else:
-        logger.error("ERROR: Cannot find a suitable parser matching database version!")
+    ret = log_parser.parse_log_data(logdata)
+    if not ret:
+        logger.error("ERROR: there were error(s) parsing log data")
+        sys.exit(1)
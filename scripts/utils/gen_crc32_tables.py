@@ -0,0 +1,104 @@
+#!/usr/bin/env python3
+#
+# Copyright The Zephyr Project Contributors
+#
+# SPDX-License-Identifier: Apache-2.0
+
+"""
+Generate lib/crc/crc32_tables.h, the lookup tables of the table driven
+CRC32 engines selected with CONFIG_CRC32_IMPLEMENTATION.
+
+Usage::
+
+    python $ZEPHYR_BASE/scripts/utils/gen_crc32_tables.py \\
+        -o $ZEPHYR_BASE/lib/crc/crc32_tables.h
+"""
+
+import argparse
+import sys
+
+# Reflected polynomials and the macro prefix of their tables
+POLYNOMIALS = (
+    (0xEDB88320, "CRC32_IEEE_TABLE"),
+    (0x82F63B78, "CRC32C_TABLE"),
+)
+
+# Slicing-by-8 needs the most tables
+NUM_TABLES = 8
+
+HEADER = """\
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Lookup tables for the table driven CRC32 engines, generated from the
+ * reflected polynomials 0xEDB88320 (IEEE 802.3) and 0x82F63B78
+ * (Castagnoli).  Table 0 holds the CRC of every byte value; table k holds
+ * the CRC of every byte value followed by k zero bytes, as used by the
+ * slicing-by-4 and slicing-by-8 engines.
+ *
+ * Generated by scripts/utils/gen_crc32_tables.py, do not edit.
+ */
+
+#ifndef ZEPHYR_LIB_CRC_CRC32_TABLES_H_
+#define ZEPHYR_LIB_CRC_CRC32_TABLES_H_
+
+"""
+
+FOOTER = "#endif /* ZEPHYR_LIB_CRC_CRC32_TABLES_H_ */\n"
+
+
+def crc_tables(poly):
+    """Return NUM_TABLES tables of 256 entries for a reflected polynomial."""
+    tables = [[0] * 256 for _ in range(NUM_TABLES)]
+
+    for i in range(256):
+        crc = i
+        for _ in range(8):
+            crc = (crc >> 1) ^ (poly if crc & 1 else 0)
+        tables[0][i] = crc
+
+    # Feeding one more zero byte through the CRC
+    for k in range(1, NUM_TABLES):
+        for i in range(256):
+            prev = tables[k - 1][i]
+            tables[k][i] = (prev >> 8) ^ tables[0][prev & 0xFF]
+
+    return tables
+
+
+def format_table(name, table):
+    lines = [f"#define {name} {{ \\"]
+    for row in range(0, 256, 4):
+        values = ", ".join(f"0x{v:08x}U" for v in table[row:row + 4])
+        lines.append(f"\t{values}, \\")
+    lines.append("}")
+
+    return "\n".join(lines) + "\n\n"
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter,
+                                     allow_abbrev=False)
+    parser.add_argument("-o", "--output", help="output header, stdout if omitted")
+    args = parser.parse_args()
+
+    out = HEADER
+    for poly, prefix in POLYNOMIALS:
+        for k, table in enumerate(crc_tables(poly)):
+            out += format_table(f"{prefix}_{k}", table)
+    out += FOOTER
+
+    if args.output:
+        with open(args.output, "w") as f:
+            f.write(out)
+    else:
+        sys.stdout.write(out)
+
+
+if __name__ == "__main__":
+    main()
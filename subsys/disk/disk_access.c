@@ -14,6 +14,8 @@
 #include <errno.h>
 #include <zephyr/device.h>
 
+#include "disk_cache.h"
+
 #define LOG_LEVEL CONFIG_DISK_LOG_LEVEL
 #include <zephyr/logging/log.h>
 LOG_MODULE_REGISTER(disk);
@@ -98,7 +100,11 @@ int disk_access_read(const char *pdrv, uint8_t *data_buf,
 
 	if ((disk != NULL) && (disk->ops != NULL) &&
 				(disk->ops->read != NULL)) {
-		rc = disk->ops->read(disk, data_buf, start_sector, num_sector);
+		if (IS_ENABLED(CONFIG_DISK_CACHE)) {
+			rc = disk_cache_read(disk, data_buf, start_sector, num_sector);
+		} else {
+			rc = disk->ops->read(disk, data_buf, start_sector, num_sector);
+		}
 	}
 
 	return rc;
@@ -112,7 +118,11 @@ int disk_access_write(const char *pdrv, const uint8_t *data_buf,
 
 	if ((disk != NULL) && (disk->ops != NULL) &&
 				(disk->ops->write != NULL)) {
-		rc = disk->ops->write(disk, data_buf, start_sector, num_sector);
+		if (IS_ENABLED(CONFIG_DISK_CACHE)) {
+			rc = disk_cache_write(disk, data_buf, start_sector, num_sector);
+		} else {
+			rc = disk->ops->write(disk, data_buf, start_sector, num_sector);
+		}
 	}
 
 	return rc;
@@ -143,12 +153,25 @@ int disk_access_ioctl(const char *pdrv, uint8_t cmd, void *buf)
 			if ((buf != NULL) && (*((bool *)buf))) {
 				/* Force deinit disk */
 				disk->refcnt = 0U;
+				if (IS_ENABLED(CONFIG_DISK_CACHE)) {
+					(void)disk_cache_sync(disk);
+					disk_cache_invalidate(disk);
+				}
 				disk->ops->ioctl(disk, cmd, buf);
 				rc = 0;
 			} else if (disk->refcnt == 1U) {
+				if (IS_ENABLED(CONFIG_DISK_CACHE)) {
+					rc = disk_cache_sync(disk);
+					if (rc != 0) {
+						break;
+					}
+				}
 				rc = disk->ops->ioctl(disk, cmd, buf);
 				if (rc == 0) {
 					disk->refcnt--;
+					if (IS_ENABLED(CONFIG_DISK_CACHE)) {
+						disk_cache_invalidate(disk);
+					}
 				}
 			} else if (disk->refcnt > 0) {
 				disk->refcnt--;
@@ -157,6 +180,16 @@ int disk_access_ioctl(const char *pdrv, uint8_t cmd, void *buf)
 				LOG_WRN("Disk is already deinitialized");
 			}
 			break;
+		case DISK_IOCTL_CTRL_SYNC:
+			if (IS_ENABLED(CONFIG_DISK_CACHE)) {
+				/* Write back the cache before syncing the disk */
+				rc = disk_cache_sync(disk);
+				if (rc != 0) {
+					break;
+				}
+			}
+			rc = disk->ops->ioctl(disk, cmd, buf);
+			break;
 		default:
 			rc = disk->ops->ioctl(disk, cmd, buf);
 		}
@@ -181,6 +214,13 @@ int disk_access_register(struct disk_info *disk)
 
 	/* Initialize reference count to zero */
 	disk->refcnt = 0U;
+#ifdef CONFIG_DISK_CACHE
+	k_mutex_init(&disk->cache_lock);
+	disk->cache_sector_size = 0U;
+#endif
+#ifdef CONFIG_DISK_CACHE_STATS
+	disk->cache_stats = (struct disk_cache_stats){0};
+#endif
 
 	spinlock_key = k_spin_lock(&lock);
 	/*  append to the disk list */
@@ -204,6 +244,12 @@ int disk_access_unregister(struct disk_info *disk)
 		return -EINVAL;
 	}
 
+	if (IS_ENABLED(CONFIG_DISK_CACHE)) {
+		/* Sectors written back later would go to a stale disk */
+		(void)disk_cache_sync(disk);
+		disk_cache_invalidate(disk);
+	}
+
 	spinlock_key = k_spin_lock(&lock);
 	/* remove disk node from the list */
 	sys_dlist_remove(&disk->node);
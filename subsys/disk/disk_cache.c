@@ -0,0 +1,493 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Set associative sector cache shared by all disks.
+ *
+ * Sector n of a disk is cached in set n % DISK_CACHE_SETS, so a run of
+ * consecutive sectors spreads over consecutive sets. Requests of at least
+ * DISK_CACHE_SETS sectors would only thrash the cache and go to the disk
+ * directly, keeping the cached copies coherent.
+ *
+ * Each disk has its own lock, serializing the cache operations on the disk
+ * including their driver calls. The lines are protected by the line lock,
+ * which is never held across driver calls: a slow disk doesn't hold up the
+ * others, and drivers like the loopback disk can access other disks from
+ * within their calls without lock order inversions against file system locks.
+ *
+ * Lines of a disk are only changed with the disk lock held, except clean
+ * lines, which any disk may replace. Dirty lines are written back by their
+ * own disk only, marked busy while the line lock is released. Lines found
+ * before releasing the line lock must be looked up again after.
+ */
+
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/util.h>
+#include <zephyr/storage/disk_access.h>
+
+#include "disk_cache.h"
+
+#define LOG_LEVEL CONFIG_DISK_LOG_LEVEL
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(disk);
+
+#define CACHE_SETS        CONFIG_DISK_CACHE_SETS
+#define CACHE_WAYS        CONFIG_DISK_CACHE_WAYS
+#define CACHE_SECTOR_SIZE CONFIG_DISK_CACHE_SECTOR_SIZE
+#define CACHE_READ_AHEAD  CONFIG_DISK_CACHE_READ_AHEAD
+
+BUILD_ASSERT(IS_POWER_OF_TWO(CACHE_SETS), "DISK_CACHE_SETS must be a power of two");
+
+/* Sector size of a disk which can't be cached */
+#define SECTOR_SIZE_UNCACHED UINT32_MAX
+
+#ifdef CONFIG_DISK_CACHE_STATS
+#define CACHE_STATS_ADD(disk, stat, n) ((disk)->cache_stats.stat += (n))
+#else
+#define CACHE_STATS_ADD(disk, stat, n)
+#endif
+
+struct cache_line {
+	/* Disk of the cached sector, NULL if the line is free */
+	struct disk_info *disk;
+	uint32_t sector;
+	/* Time of last use for LRU replacement */
+	uint32_t stamp;
+	bool dirty;
+	/* Handed to a driver, must not be replaced */
+	bool busy;
+	uint8_t data[CACHE_SECTOR_SIZE] __aligned(4);
+};
+
+static struct cache_line cache[CACHE_SETS][CACHE_WAYS];
+static uint32_t cache_stamp;
+static K_MUTEX_DEFINE(line_lock);
+
+#if CACHE_READ_AHEAD > 0
+static uint8_t read_ahead_buf[CACHE_READ_AHEAD * CACHE_SECTOR_SIZE] __aligned(4);
+static bool read_ahead_busy;
+#endif
+
+static bool cache_geometry(struct disk_info *disk)
+{
+	uint32_t sector_size;
+
+	if (disk->cache_sector_size != 0U) {
+		return disk->cache_sector_size != SECTOR_SIZE_UNCACHED;
+	}
+
+	disk->cache_sector_size = SECTOR_SIZE_UNCACHED;
+	disk->cache_sector_count = 0U;
+	disk->cache_next_sector = 0U;
+
+	if ((disk->ops->ioctl == NULL) ||
+	    (disk->ops->ioctl(disk, DISK_IOCTL_GET_SECTOR_SIZE, &sector_size) != 0)) {
+		LOG_WRN("disk %s: unknown sector size, not cached", disk->name);
+		return false;
+	}
+
+	if ((sector_size == 0U) || (sector_size > CACHE_SECTOR_SIZE)) {
+		LOG_INF("disk %s: sector size %u not cached", disk->name, sector_size);
+		return false;
+	}
+
+	/* Without a sector count there's nothing to clamp read-ahead to */
+	if (disk->ops->ioctl(disk, DISK_IOCTL_GET_SECTOR_COUNT,
+			     &disk->cache_sector_count) != 0) {
+		disk->cache_sector_count = 0U;
+	}
+
+	disk->cache_sector_size = sector_size;
+
+	return true;
+}
+
+static bool cache_in_bounds(struct disk_info *disk, uint32_t start_sector,
+			    uint32_t num_sector)
+{
+	uint32_t last_sector = start_sector + num_sector;
+
+	/* Sectors beyond the disk must fail even when they would be cached */
+	if ((last_sector < start_sector) ||
+	    ((disk->cache_sector_count != 0U) && (last_sector > disk->cache_sector_count))) {
+		LOG_ERR("disk %s: sector %u out of bounds", disk->name, last_sector);
+		return false;
+	}
+
+	return true;
+}
+
+static inline struct cache_line *cache_set(uint32_t sector)
+{
+	return cache[sector & (CACHE_SETS - 1)];
+}
+
+static struct cache_line *cache_lookup(struct disk_info *disk, uint32_t sector)
+{
+	struct cache_line *set = cache_set(sector);
+
+	for (int i = 0; i < CACHE_WAYS; i++) {
+		if ((set[i].disk == disk) && (set[i].sector == sector)) {
+			return &set[i];
+		}
+	}
+
+	return NULL;
+}
+
+static inline void cache_touch(struct cache_line *line)
+{
+	line->stamp = ++cache_stamp;
+}
+
+/* Called with the line lock held, which is released during the write */
+static int cache_write_back(struct cache_line *line)
+{
+	struct disk_info *disk = line->disk;
+	int rc;
+
+	line->busy = true;
+	k_mutex_unlock(&line_lock);
+	rc = disk->ops->write(disk, line->data, line->sector, 1);
+	k_mutex_lock(&line_lock, K_FOREVER);
+	line->busy = false;
+
+	if (rc != 0) {
+		LOG_ERR("disk %s: write back of sector %u failed (%d)", disk->name,
+			line->sector, rc);
+		return rc;
+	}
+
+	line->dirty = false;
+	CACHE_STATS_ADD(disk, write_backs, 1);
+
+	return 0;
+}
+
+/* Get a line for a sector not in the cache, NULL if none can be replaced */
+static struct cache_line *cache_alloc(struct disk_info *disk, uint32_t sector)
+{
+	struct cache_line *set = cache_set(sector);
+	struct cache_line *victim = NULL;
+
+	for (int i = 0; i < CACHE_WAYS; i++) {
+		/* Dirty lines of other disks can't be written back from here */
+		if (set[i].busy || (set[i].dirty && (set[i].disk != disk))) {
+			continue;
+		}
+		if (set[i].disk == NULL) {
+			victim = &set[i];
+			break;
+		}
+		if ((victim == NULL) || ((int32_t)(set[i].stamp - victim->stamp) < 0)) {
+			victim = &set[i];
+		}
+	}
+
+	if (victim == NULL) {
+		return NULL;
+	}
+
+	if (victim->dirty && (cache_write_back(victim) != 0)) {
+		return NULL;
+	}
+
+	victim->disk = disk;
+	victim->sector = sector;
+	cache_touch(victim);
+
+	return victim;
+}
+
+static void cache_fill(struct disk_info *disk, const uint8_t *data_buf,
+		       uint32_t start_sector, uint32_t num_sector)
+{
+	for (uint32_t i = 0; i < num_sector; i++) {
+		struct cache_line *line;
+
+		/* Never cache a sector twice */
+		if (cache_lookup(disk, start_sector + i) != NULL) {
+			continue;
+		}
+
+		line = cache_alloc(disk, start_sector + i);
+		if (line != NULL) {
+			memcpy(line->data, data_buf + i * disk->cache_sector_size,
+			       disk->cache_sector_size);
+		}
+	}
+}
+
+#if CACHE_READ_AHEAD > 0
+/* Called with the line lock held, which is released during the read */
+static void cache_read_ahead(struct disk_info *disk, uint32_t sector)
+{
+	uint32_t count = 0U;
+	int rc;
+
+	/* Read the sectors not cached yet following the request */
+	while ((count < CACHE_READ_AHEAD) &&
+	       (sector + count < disk->cache_sector_count) &&
+	       (cache_lookup(disk, sector + count) == NULL)) {
+		count++;
+	}
+
+	if ((count == 0U) || read_ahead_busy ||
+	    (count * disk->cache_sector_size > sizeof(read_ahead_buf))) {
+		return;
+	}
+
+	read_ahead_busy = true;
+	k_mutex_unlock(&line_lock);
+	rc = disk->ops->read(disk, read_ahead_buf, sector, count);
+	k_mutex_lock(&line_lock, K_FOREVER);
+	if (rc == 0) {
+		cache_fill(disk, read_ahead_buf, sector, count);
+		CACHE_STATS_ADD(disk, read_ahead, count);
+	}
+	read_ahead_busy = false;
+}
+#endif
+
+int disk_cache_read(struct disk_info *disk, uint8_t *data_buf,
+		    uint32_t start_sector, uint32_t num_sector)
+{
+	struct cache_line *line;
+	uint32_t sector_size;
+	uint32_t i = 0U;
+	uint32_t j;
+	int rc = 0;
+
+	k_mutex_lock(&disk->cache_lock, K_FOREVER);
+
+	if (!cache_geometry(disk)) {
+		k_mutex_unlock(&disk->cache_lock);
+		return disk->ops->read(disk, data_buf, start_sector, num_sector);
+	}
+
+	if (!cache_in_bounds(disk, start_sector, num_sector)) {
+		k_mutex_unlock(&disk->cache_lock);
+		return -EIO;
+	}
+
+	sector_size = disk->cache_sector_size;
+
+	if (num_sector >= CACHE_SETS) {
+		rc = disk->ops->read(disk, data_buf, start_sector, num_sector);
+		if (rc == 0) {
+			CACHE_STATS_ADD(disk, misses, num_sector);
+		}
+
+		i = num_sector;
+	}
+
+	k_mutex_lock(&line_lock, K_FOREVER);
+
+	/* The disk doesn't have the sectors written to the cache yet */
+	if (IS_ENABLED(CONFIG_DISK_CACHE_WRITE_BACK) && (rc == 0) && (num_sector >= CACHE_SETS)) {
+		for (j = 0U; j < num_sector; j++) {
+			line = cache_lookup(disk, start_sector + j);
+			if ((line != NULL) && line->dirty) {
+				memcpy(data_buf + j * sector_size, line->data, sector_size);
+			}
+		}
+	}
+
+	while ((rc == 0) && (i < num_sector)) {
+		line = cache_lookup(disk, start_sector + i);
+		if (line != NULL) {
+			memcpy(data_buf + i * sector_size, line->data, sector_size);
+			cache_touch(line);
+			CACHE_STATS_ADD(disk, hits, 1);
+			i++;
+			continue;
+		}
+
+		/* Read the run of missing sectors at once */
+		for (j = i + 1U; j < num_sector; j++) {
+			if (cache_lookup(disk, start_sector + j) != NULL) {
+				break;
+			}
+		}
+
+		k_mutex_unlock(&line_lock);
+		rc = disk->ops->read(disk, data_buf + i * sector_size, start_sector + i, j - i);
+		k_mutex_lock(&line_lock, K_FOREVER);
+		if (rc == 0) {
+			cache_fill(disk, data_buf + i * sector_size, start_sector + i, j - i);
+			CACHE_STATS_ADD(disk, misses, j - i);
+		}
+
+		i = j;
+	}
+
+#if CACHE_READ_AHEAD > 0
+	if ((rc == 0) && (start_sector == disk->cache_next_sector)) {
+		cache_read_ahead(disk, start_sector + num_sector);
+	}
+#endif
+
+	k_mutex_unlock(&line_lock);
+
+	disk->cache_next_sector = start_sector + num_sector;
+
+	k_mutex_unlock(&disk->cache_lock);
+
+	return rc;
+}
+
+int disk_cache_write(struct disk_info *disk, const uint8_t *data_buf,
+		     uint32_t start_sector, uint32_t num_sector)
+{
+	struct cache_line *line;
+	uint32_t sector_size;
+	int rc = 0;
+
+	k_mutex_lock(&disk->cache_lock, K_FOREVER);
+
+	if (!cache_geometry(disk)) {
+		k_mutex_unlock(&disk->cache_lock);
+		return disk->ops->write(disk, data_buf, start_sector, num_sector);
+	}
+
+	if (!cache_in_bounds(disk, start_sector, num_sector)) {
+		k_mutex_unlock(&disk->cache_lock);
+		return -EIO;
+	}
+
+	sector_size = disk->cache_sector_size;
+
+	if (!IS_ENABLED(CONFIG_DISK_CACHE_WRITE_BACK) || (num_sector >= CACHE_SETS)) {
+		rc = disk->ops->write(disk, data_buf, start_sector, num_sector);
+
+		/* Keep the cached copies, now clean */
+		k_mutex_lock(&line_lock, K_FOREVER);
+		for (uint32_t i = 0U; (rc == 0) && (i < num_sector); i++) {
+			line = cache_lookup(disk, start_sector + i);
+			if (line != NULL) {
+				memcpy(line->data, data_buf + i * sector_size, sector_size);
+				line->dirty = false;
+			}
+		}
+		k_mutex_unlock(&line_lock);
+
+		k_mutex_unlock(&disk->cache_lock);
+		return rc;
+	}
+
+	k_mutex_lock(&line_lock, K_FOREVER);
+
+	for (uint32_t i = 0U; (rc == 0) && (i < num_sector); i++) {
+		const uint8_t *data = data_buf + i * sector_size;
+
+		line = cache_lookup(disk, start_sector + i);
+		if (line == NULL) {
+			line = cache_alloc(disk, start_sector + i);
+		}
+
+		if (line == NULL) {
+			/* No line to keep the sector in, write it through */
+			k_mutex_unlock(&line_lock);
+			rc = disk->ops->write(disk, data, start_sector + i, 1);
+			k_mutex_lock(&line_lock, K_FOREVER);
+			continue;
+		}
+
+		memcpy(line->data, data, sector_size);
+		line->dirty = true;
+		cache_touch(line);
+	}
+
+	k_mutex_unlock(&line_lock);
+
+	k_mutex_unlock(&disk->cache_lock);
+
+	return rc;
+}
+
+int disk_cache_sync(struct disk_info *disk)
+{
+	int rc = 0;
+
+	k_mutex_lock(&disk->cache_lock, K_FOREVER);
+	k_mutex_lock(&line_lock, K_FOREVER);
+
+	for (int set = 0; set < CACHE_SETS; set++) {
+		for (int way = 0; way < CACHE_WAYS; way++) {
+			struct cache_line *line = &cache[set][way];
+
+			if ((line->disk == disk) && line->dirty) {
+				rc = cache_write_back(line);
+				if (rc != 0) {
+					goto out;
+				}
+			}
+		}
+	}
+
+out:
+	k_mutex_unlock(&line_lock);
+	k_mutex_unlock(&disk->cache_lock);
+
+	return rc;
+}
+
+void disk_cache_invalidate(struct disk_info *disk)
+{
+	k_mutex_lock(&disk->cache_lock, K_FOREVER);
+	k_mutex_lock(&line_lock, K_FOREVER);
+
+	for (int set = 0; set < CACHE_SETS; set++) {
+		for (int way = 0; way < CACHE_WAYS; way++) {
+			struct cache_line *line = &cache[set][way];
+
+			if (line->disk == disk) {
+				line->disk = NULL;
+				line->dirty = false;
+			}
+		}
+	}
+
+	k_mutex_unlock(&line_lock);
+
+	/* The medium may change until the next use */
+	disk->cache_sector_size = 0U;
+
+	k_mutex_unlock(&disk->cache_lock);
+}
+
+#ifdef CONFIG_DISK_CACHE_STATS
+int disk_access_cache_stats(const char *pdrv, struct disk_cache_stats *stats)
+{
+	struct disk_info *disk = disk_access_get_di(pdrv);
+
+	if ((disk == NULL) || (stats == NULL)) {
+		return -EINVAL;
+	}
+
+	k_mutex_lock(&disk->cache_lock, K_FOREVER);
+	*stats = disk->cache_stats;
+	k_mutex_unlock(&disk->cache_lock);
+
+	return 0;
+}
+
+int disk_access_cache_stats_reset(const char *pdrv)
+{
+	struct disk_info *disk = disk_access_get_di(pdrv);
+
+	if (disk == NULL) {
+		return -EINVAL;
+	}
+
+	k_mutex_lock(&disk->cache_lock, K_FOREVER);
+	disk->cache_stats = (struct disk_cache_stats){0};
+	k_mutex_unlock(&disk->cache_lock);
+
+	return 0;
+}
+#endif /* CONFIG_DISK_CACHE_STATS */
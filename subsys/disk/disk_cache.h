@@ -0,0 +1,29 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_SUBSYS_DISK_DISK_CACHE_H_
+#define ZEPHYR_SUBSYS_DISK_DISK_CACHE_H_
+
+#include <zephyr/drivers/disk.h>
+
+/* Defined in disk_access.c */
+struct disk_info *disk_access_get_di(const char *name);
+
+/* Read sectors through the cache, filling it and reading ahead */
+int disk_cache_read(struct disk_info *disk, uint8_t *data_buf,
+		    uint32_t start_sector, uint32_t num_sector);
+
+/* Write sectors through the cache */
+int disk_cache_write(struct disk_info *disk, const uint8_t *data_buf,
+		     uint32_t start_sector, uint32_t num_sector);
+
+/* Write the dirty sectors of a disk back to it */
+int disk_cache_sync(struct disk_info *disk);
+
+/* Drop all sectors of a disk, dirty or not, and forget its geometry */
+void disk_cache_invalidate(struct disk_info *disk);
+
+#endif /* ZEPHYR_SUBSYS_DISK_DISK_CACHE_H_ */
@@ -15,6 +15,7 @@
 #include <zephyr/fs/fs.h>
 #include <zephyr/fs/fs_sys.h>
 #include <zephyr/sys/check.h>
+#include "fs_impl.h"
 
 
 #define LOG_LEVEL CONFIG_FS_LOG_LEVEL
@@ -195,6 +196,10 @@ int fs_open(struct fs_file_t *zfp, const char *file_name, fs_mode_t flags)
 		}
 	}
 
+	if (IS_ENABLED(CONFIG_FILE_SYSTEM_ASYNC)) {
+		fs_async_file_init(zfp);
+	}
+
 	return rc;
 }
 
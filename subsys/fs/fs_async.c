@@ -0,0 +1,167 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Asynchronous file access on top of RTIO. Each open file has an IO device
+ * whose submissions are given to a worker thread doing the synchronous file
+ * operations, unless the file system starts them itself.
+ */
+
+#include <errno.h>
+#include <zephyr/kernel.h>
+#include <zephyr/fs/fs.h>
+#include <zephyr/fs/fs_sys.h>
+#include <zephyr/rtio/rtio.h>
+
+#include "fs_impl.h"
+
+#define LOG_LEVEL CONFIG_FS_LOG_LEVEL
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(fs);
+
+RTIO_IODEV_WORKER_DEFINE(fs_async_worker, CONFIG_FILE_SYSTEM_ASYNC_STACK_SIZE,
+			 CONFIG_FILE_SYSTEM_ASYNC_PRIORITY);
+
+static void fs_async_iodev_submit(struct rtio_iodev_sqe *iodev_sqe)
+{
+	const struct rtio_sqe *sqe = &iodev_sqe->sqe;
+	struct fs_file_t *zfp = sqe->iodev->data;
+	ssize_t rc;
+
+	if (zfp->mp == NULL) {
+		rtio_iodev_sqe_err(iodev_sqe, -EBADF);
+		return;
+	}
+
+	if (zfp->mp->fs->submit != NULL) {
+		zfp->mp->fs->submit(zfp, iodev_sqe);
+		return;
+	}
+
+	switch (sqe->op) {
+	case RTIO_OP_RX:
+		rc = fs_read(zfp, sqe->rx.buf, sqe->rx.buf_len);
+		break;
+	case RTIO_OP_TX:
+		rc = fs_write(zfp, sqe->tx.buf, sqe->tx.buf_len);
+		break;
+	case RTIO_OP_TINY_TX:
+		rc = fs_write(zfp, sqe->tiny_tx.buf, sqe->tiny_tx.buf_len);
+		break;
+	case RTIO_OP_NOP:
+		rc = 0;
+		break;
+	default:
+		LOG_ERR("unsupported file operation %u", sqe->op);
+		rc = -ENOTSUP;
+	}
+
+	if ((rc >= 0) && (sqe->op != RTIO_OP_RX) && (sqe->iodev_flags & RTIO_IODEV_FS_SYNC)) {
+		int err = fs_sync(zfp);
+
+		if (err < 0) {
+			rc = err;
+		}
+	}
+
+	if (rc < 0) {
+		rtio_iodev_sqe_err(iodev_sqe, rc);
+	} else {
+		rtio_iodev_sqe_ok(iodev_sqe, rc);
+	}
+}
+
+static const struct rtio_iodev_api fs_async_iodev_api = {
+	.submit = fs_async_iodev_submit,
+};
+
+void fs_async_file_init(struct fs_file_t *zfp)
+{
+	zfp->iodev.api = &fs_async_iodev_api;
+	zfp->iodev.data = zfp;
+	/* File systems starting the accesses themselves don't need the worker */
+	rtio_iodev_set_worker(&zfp->iodev,
+			      (zfp->mp->fs->submit == NULL) ? &fs_async_worker : NULL);
+}
+
+struct rtio_iodev *fs_file_iodev(struct fs_file_t *zfp)
+{
+	if (zfp->mp == NULL) {
+		return NULL;
+	}
+
+	return &zfp->iodev;
+}
+
+static struct rtio_sqe *fs_async_sqe_acquire(struct rtio *r, struct fs_file_t *zfp,
+					     struct rtio_iodev **iodev, int *rc)
+{
+	struct rtio_sqe *sqe;
+
+	*iodev = fs_file_iodev(zfp);
+	if (*iodev == NULL) {
+		*rc = -EBADF;
+		return NULL;
+	}
+
+	sqe = rtio_sqe_acquire(r);
+	if (sqe == NULL) {
+		*rc = -ENOMEM;
+	}
+
+	return sqe;
+}
+
+int fs_read_async(struct rtio *r, struct fs_file_t *zfp, void *ptr, size_t size,
+		  void *userdata)
+{
+	struct rtio_iodev *iodev;
+	struct rtio_sqe *sqe;
+	int rc;
+
+	sqe = fs_async_sqe_acquire(r, zfp, &iodev, &rc);
+	if (sqe == NULL) {
+		return rc;
+	}
+
+	rtio_sqe_prep_read(sqe, iodev, RTIO_PRIO_NORM, ptr, size, userdata);
+
+	return rtio_submit(r, 0);
+}
+
+int fs_write_async(struct rtio *r, struct fs_file_t *zfp, const void *ptr, size_t size,
+		   void *userdata)
+{
+	struct rtio_iodev *iodev;
+	struct rtio_sqe *sqe;
+	int rc;
+
+	sqe = fs_async_sqe_acquire(r, zfp, &iodev, &rc);
+	if (sqe == NULL) {
+		return rc;
+	}
+
+	rtio_sqe_prep_write(sqe, iodev, RTIO_PRIO_NORM, ptr, size, userdata);
+
+	return rtio_submit(r, 0);
+}
+
+int fs_sync_async(struct rtio *r, struct fs_file_t *zfp, void *userdata)
+{
+	struct rtio_iodev *iodev;
+	struct rtio_sqe *sqe;
+	int rc;
+
+	sqe = fs_async_sqe_acquire(r, zfp, &iodev, &rc);
+	if (sqe == NULL) {
+		return rc;
+	}
+
+	rtio_sqe_prep_nop(sqe, iodev, userdata);
+	sqe->iodev_flags = RTIO_IODEV_FS_SYNC;
+
+	return rtio_submit(r, 0);
+}
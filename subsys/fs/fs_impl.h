@@ -28,6 +28,16 @@ extern "C" {
 const char *fs_impl_strip_prefix(const char *path,
 				 const struct fs_mount_t *mp);
 
+/**
+ * @brief Set up the IO device of a file for asynchronous access.
+ *
+ * Called once the file is open, the IO device is then unchanged until the
+ * file is closed.
+ *
+ * @param zfp a pointer to the open file
+ */
+void fs_async_file_init(struct fs_file_t *zfp);
+
 
 #ifdef __cplusplus
 }
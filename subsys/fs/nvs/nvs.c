@@ -742,9 +742,73 @@ gc_done:
 	/* Erase the gc'ed sector */
 	rc = nvs_flash_erase_sector(fs, sec_addr);
 
+#ifdef CONFIG_NVS_BACKGROUND_GC
+	fs->bg_gc_start_free = fs->ate_wra - fs->data_wra;
+#endif
+
 	return rc;
 }
 
+#ifdef CONFIG_NVS_BACKGROUND_GC
+
+static struct k_work_q nvs_bg_gc_work_q;
+static K_THREAD_STACK_DEFINE(nvs_bg_gc_stack, CONFIG_NVS_BACKGROUND_GC_STACK_SIZE);
+
+/* Check if the active sector should be closed ahead of the next write, this
+ * is only done once a threshold worth of data was written since it was started.
+ */
+static bool nvs_bg_gc_needed(struct nvs_fs *fs)
+{
+	uint32_t threshold, free_space;
+
+	threshold = (uint32_t)fs->sector_size * CONFIG_NVS_BACKGROUND_GC_THRESHOLD / 100U;
+	free_space = fs->ate_wra - fs->data_wra;
+
+	return (free_space < threshold) &&
+	       (fs->bg_gc_start_free >= free_space + threshold);
+}
+
+static void nvs_bg_gc_work_handler(struct k_work *work)
+{
+	struct nvs_fs *fs = CONTAINER_OF(work, struct nvs_fs, bg_gc_work);
+	int rc = 0;
+
+	k_mutex_lock(&fs->nvs_lock, K_FOREVER);
+
+	/* a write might have started a new sector in the meantime */
+	if (fs->ready && nvs_bg_gc_needed(fs)) {
+		LOG_DBG("Background gc, closing sector %d", fs->ate_wra >> ADDR_SECT_SHIFT);
+
+		rc = nvs_sector_close(fs);
+		if (!rc) {
+			rc = nvs_gc(fs);
+		}
+	}
+
+	k_mutex_unlock(&fs->nvs_lock);
+
+	if (rc) {
+		LOG_ERR("Background gc failed: %d", rc);
+	}
+}
+
+static int nvs_bg_gc_init(void)
+{
+	const struct k_work_queue_config cfg = {
+		.name = "nvs_gc",
+	};
+
+	k_work_queue_start(&nvs_bg_gc_work_q, nvs_bg_gc_stack,
+			   K_THREAD_STACK_SIZEOF(nvs_bg_gc_stack),
+			   CONFIG_NVS_BACKGROUND_GC_THREAD_PRIO, &cfg);
+
+	return 0;
+}
+
+SYS_INIT(nvs_bg_gc_init, POST_KERNEL, CONFIG_KERNEL_INIT_PRIORITY_DEFAULT);
+
+#endif /* CONFIG_NVS_BACKGROUND_GC */
+
 static int nvs_startup(struct nvs_fs *fs)
 {
 	int rc;
@@ -975,6 +1039,9 @@ end:
 
 		rc = nvs_add_gc_done_ate(fs);
 	}
+#ifdef CONFIG_NVS_BACKGROUND_GC
+	fs->bg_gc_start_free = fs->ate_wra - fs->data_wra;
+#endif
 	k_mutex_unlock(&fs->nvs_lock);
 	return rc;
 }
@@ -989,6 +1056,12 @@ int nvs_clear(struct nvs_fs *fs)
 		return -EACCES;
 	}
 
+#ifdef CONFIG_NVS_BACKGROUND_GC
+	struct k_work_sync sync;
+
+	(void)k_work_cancel_sync(&fs->bg_gc_work, &sync);
+#endif
+
 	for (uint16_t i = 0; i < fs->sector_count; i++) {
 		addr = i << ADDR_SECT_SHIFT;
 		rc = nvs_flash_erase_sector(fs, addr);
@@ -1009,6 +1082,16 @@ int nvs_mount(struct nvs_fs *fs)
 	struct flash_pages_info info;
 	size_t write_block_size;
 
+#ifdef CONFIG_NVS_BACKGROUND_GC
+	if (fs->ready) {
+		struct k_work_sync sync;
+
+		/* remount, the work of the previous mount might still be queued */
+		(void)k_work_cancel_sync(&fs->bg_gc_work, &sync);
+	}
+	k_work_init(&fs->bg_gc_work, nvs_bg_gc_work_handler);
+#endif
+
 	k_mutex_init(&fs->nvs_lock);
 
 	fs->flash_parameters = flash_get_parameters(fs->flash_device);
@@ -1188,6 +1271,12 @@ no_cached_entry:
 		gc_count++;
 	}
 	rc = len;
+
+#ifdef CONFIG_NVS_BACKGROUND_GC
+	if (nvs_bg_gc_needed(fs)) {
+		(void)k_work_submit_to_queue(&nvs_bg_gc_work_q, &fs->bg_gc_work);
+	}
+#endif
 end:
 	k_mutex_unlock(&fs->nvs_lock);
 	return rc;
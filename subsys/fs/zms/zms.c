@@ -26,6 +26,17 @@ static int zms_ate_valid_different_sector(struct zms_fs *fs, const struct zms_at
 
 #ifdef CONFIG_ZMS_LOOKUP_CACHE
 
+BUILD_ASSERT(CONFIG_ZMS_LOOKUP_CACHE_SIZE % CONFIG_ZMS_LOOKUP_CACHE_WAYS == 0,
+	     "CONFIG_ZMS_LOOKUP_CACHE_SIZE must be a multiple of CONFIG_ZMS_LOOKUP_CACHE_WAYS");
+
+/*
+ * The lookup cache is set-associative: each set holds the most recent ATE address of up to
+ * CONFIG_ZMS_LOOKUP_CACHE_WAYS IDs, most recently written first. When an ID is evicted from a
+ * full set, the set keeps the address of its ATE. As the evicted IDs are the least recently
+ * written ones, the most recent ATE of any ID that is not in the set is found by walking back
+ * from that address.
+ */
+
 static inline size_t zms_lookup_cache_pos(uint32_t id)
 {
 	uint32_t hash;
@@ -38,7 +49,87 @@ static inline size_t zms_lookup_cache_pos(uint32_t id)
 	hash *= 0x846ca68bU;
 	hash ^= hash >> 16;
 
-	return hash % CONFIG_ZMS_LOOKUP_CACHE_SIZE;
+	return hash % ZMS_LOOKUP_CACHE_SETS;
+}
+
+/* Get the address to search the most recent ATE of id from, ZMS_LOOKUP_CACHE_NO_ADDR if the ID
+ * has not been written.
+ */
+static uint64_t zms_lookup_cache_get(struct zms_fs *fs, uint32_t id)
+{
+	const size_t set = zms_lookup_cache_pos(id);
+	const uint64_t *addr = &fs->lookup_cache[set * CONFIG_ZMS_LOOKUP_CACHE_WAYS];
+	const uint32_t *ids = &fs->lookup_cache_id[set * CONFIG_ZMS_LOOKUP_CACHE_WAYS];
+
+	for (size_t i = 0; i < CONFIG_ZMS_LOOKUP_CACHE_WAYS; i++) {
+		if (addr[i] == ZMS_LOOKUP_CACHE_NO_ADDR) {
+			break;
+		}
+		if (ids[i] == id) {
+			return addr[i];
+		}
+	}
+
+	return fs->lookup_cache_evicted[set];
+}
+
+/* Record ate_addr, which is the most recently written ATE, as the most recent ATE of id */
+static void zms_lookup_cache_set(struct zms_fs *fs, uint32_t id, uint64_t ate_addr)
+{
+	const size_t set = zms_lookup_cache_pos(id);
+	uint64_t *addr = &fs->lookup_cache[set * CONFIG_ZMS_LOOKUP_CACHE_WAYS];
+	uint32_t *ids = &fs->lookup_cache_id[set * CONFIG_ZMS_LOOKUP_CACHE_WAYS];
+	size_t i;
+
+	for (i = 0; i < CONFIG_ZMS_LOOKUP_CACHE_WAYS - 1; i++) {
+		if (addr[i] == ZMS_LOOKUP_CACHE_NO_ADDR || ids[i] == id) {
+			break;
+		}
+	}
+
+	if (addr[i] != ZMS_LOOKUP_CACHE_NO_ADDR && ids[i] != id) {
+		/* The set is full, evict its least recently written ID */
+		fs->lookup_cache_evicted[set] = addr[i];
+	}
+
+	/* Move the more recent IDs down one way to put id first */
+	memmove(&addr[1], &addr[0], i * sizeof(addr[0]));
+	memmove(&ids[1], &ids[0], i * sizeof(ids[0]));
+	addr[0] = ate_addr;
+	ids[0] = id;
+}
+
+static void zms_lookup_cache_clear(struct zms_fs *fs)
+{
+	memset(fs->lookup_cache, 0xff, sizeof(fs->lookup_cache));
+	memset(fs->lookup_cache_evicted, 0xff, sizeof(fs->lookup_cache_evicted));
+}
+
+/* The rebuild visits the ATEs from the most recent one: get where to store the address of an
+ * ATE of id, NULL if a more recent one is already known.
+ */
+static uint64_t *zms_lookup_cache_rebuild_entry(struct zms_fs *fs, uint32_t id)
+{
+	const size_t set = zms_lookup_cache_pos(id);
+	uint64_t *addr = &fs->lookup_cache[set * CONFIG_ZMS_LOOKUP_CACHE_WAYS];
+	uint32_t *ids = &fs->lookup_cache_id[set * CONFIG_ZMS_LOOKUP_CACHE_WAYS];
+
+	for (size_t i = 0; i < CONFIG_ZMS_LOOKUP_CACHE_WAYS; i++) {
+		if (addr[i] == ZMS_LOOKUP_CACHE_NO_ADDR) {
+			ids[i] = id;
+			return &addr[i];
+		}
+		if (ids[i] == id) {
+			return NULL;
+		}
+	}
+
+	/* The set is full, the first ID that does not fit is the most recent evicted one */
+	if (fs->lookup_cache_evicted[set] == ZMS_LOOKUP_CACHE_NO_ADDR) {
+		return &fs->lookup_cache_evicted[set];
+	}
+
+	return NULL;
 }
 
 static int zms_lookup_cache_rebuild(struct zms_fs *fs)
@@ -51,7 +142,7 @@ static int zms_lookup_cache_rebuild(struct zms_fs *fs)
 	uint8_t current_cycle;
 	struct zms_ate ate;
 
-	memset(fs->lookup_cache, 0xff, sizeof(fs->lookup_cache));
+	zms_lookup_cache_clear(fs);
 	addr = fs->ate_wra;
 
 	while (true) {
@@ -63,9 +154,12 @@ static int zms_lookup_cache_rebuild(struct zms_fs *fs)
 			return rc;
 		}
 
-		cache_entry = &fs->lookup_cache[zms_lookup_cache_pos(ate.id)];
+		cache_entry = NULL;
+		if (ate.id != ZMS_HEAD_ID) {
+			cache_entry = zms_lookup_cache_rebuild_entry(fs, ate.id);
+		}
 
-		if (ate.id != ZMS_HEAD_ID && *cache_entry == ZMS_LOOKUP_CACHE_NO_ADDR) {
+		if (cache_entry != NULL) {
 			/* read the ate cycle only when we change the sector
 			 * or if it is the first read
 			 */
@@ -95,12 +189,29 @@ static int zms_lookup_cache_rebuild(struct zms_fs *fs)
 
 static void zms_lookup_cache_invalidate(struct zms_fs *fs, uint32_t sector)
 {
-	uint64_t *cache_entry = fs->lookup_cache;
-	uint64_t *const cache_end = &fs->lookup_cache[CONFIG_ZMS_LOOKUP_CACHE_SIZE];
+	for (size_t set = 0; set < ZMS_LOOKUP_CACHE_SETS; set++) {
+		uint64_t *addr = &fs->lookup_cache[set * CONFIG_ZMS_LOOKUP_CACHE_WAYS];
+		uint32_t *ids = &fs->lookup_cache_id[set * CONFIG_ZMS_LOOKUP_CACHE_WAYS];
+		size_t kept = 0;
+
+		/* Drop the IDs written in the sector, keeping the others in order */
+		for (size_t i = 0; i < CONFIG_ZMS_LOOKUP_CACHE_WAYS; i++) {
+			if (addr[i] == ZMS_LOOKUP_CACHE_NO_ADDR) {
+				break;
+			}
+			if (SECTOR_NUM(addr[i]) != sector) {
+				addr[kept] = addr[i];
+				ids[kept] = ids[i];
+				kept++;
+			}
+		}
+		for (size_t i = kept; i < CONFIG_ZMS_LOOKUP_CACHE_WAYS; i++) {
+			addr[i] = ZMS_LOOKUP_CACHE_NO_ADDR;
+		}
 
-	for (; cache_entry < cache_end; ++cache_entry) {
-		if (SECTOR_NUM(*cache_entry) == sector) {
-			*cache_entry = ZMS_LOOKUP_CACHE_NO_ADDR;
+		/* All the evicted IDs were written in the sector or in older ones */
+		if (SECTOR_NUM(fs->lookup_cache_evicted[set]) == sector) {
+			fs->lookup_cache_evicted[set] = ZMS_LOOKUP_CACHE_NO_ADDR;
 		}
 	}
 }
@@ -212,7 +323,7 @@ static int zms_flash_ate_wrt(struct zms_fs *fs, const struct zms_ate *entry)
 #ifdef CONFIG_ZMS_LOOKUP_CACHE
 	/* 0xFFFFFFFF is a special-purpose identifier. Exclude it from the cache */
 	if (entry->id != ZMS_HEAD_ID) {
-		fs->lookup_cache[zms_lookup_cache_pos(entry->id)] = fs->ate_wra;
+		zms_lookup_cache_set(fs, entry->id, fs->ate_wra);
 	}
 #endif
 	fs->ate_wra -= zms_al_size(fs, sizeof(struct zms_ate));
@@ -952,7 +1063,7 @@ static int zms_gc(struct zms_fs *fs)
 		}
 
 #ifdef CONFIG_ZMS_LOOKUP_CACHE
-		wlk_addr = fs->lookup_cache[zms_lookup_cache_pos(gc_ate.id)];
+		wlk_addr = zms_lookup_cache_get(fs, gc_ate.id);
 
 		if (wlk_addr == ZMS_LOOKUP_CACHE_NO_ADDR) {
 			wlk_addr = fs->ate_wra;
@@ -1293,12 +1404,10 @@ static int zms_init(struct zms_fs *fs)
 #ifdef CONFIG_ZMS_LOOKUP_CACHE
 		/**
 		 * At this point, the lookup cache wasn't built but the gc function need to use it.
-		 * So, temporarily, we set the lookup cache to the end of the fs.
-		 * The cache will be rebuilt afterwards
+		 * So, temporarily, we empty the lookup cache to make gc search from the end of the
+		 * fs. The cache will be rebuilt afterwards
 		 **/
-		for (i = 0; i < CONFIG_ZMS_LOOKUP_CACHE_SIZE; i++) {
-			fs->lookup_cache[i] = fs->ate_wra;
-		}
+		zms_lookup_cache_clear(fs);
 #endif
 		rc = zms_gc(fs);
 		goto end;
@@ -1417,7 +1526,7 @@ ssize_t zms_write(struct zms_fs *fs, uint32_t id, const void *data, size_t len)
 
 	/* find latest entry with same id */
 #ifdef CONFIG_ZMS_LOOKUP_CACHE
-	wlk_addr = fs->lookup_cache[zms_lookup_cache_pos(id)];
+	wlk_addr = zms_lookup_cache_get(fs, id);
 
 	if (wlk_addr == ZMS_LOOKUP_CACHE_NO_ADDR) {
 		goto no_cached_entry;
@@ -1557,7 +1666,7 @@ ssize_t zms_read_hist(struct zms_fs *fs, uint32_t id, void *data, size_t len, ui
 	cnt_his = 0U;
 
 #ifdef CONFIG_ZMS_LOOKUP_CACHE
-	wlk_addr = fs->lookup_cache[zms_lookup_cache_pos(id)];
+	wlk_addr = zms_lookup_cache_get(fs, id);
 
 	if (wlk_addr == ZMS_LOOKUP_CACHE_NO_ADDR) {
 		rc = -ENOENT;
@@ -28,6 +28,7 @@
 #endif
 
 #define ZMS_LOOKUP_CACHE_NO_ADDR GENMASK64(63, 0)
+#define ZMS_LOOKUP_CACHE_SETS    (CONFIG_ZMS_LOOKUP_CACHE_SIZE / CONFIG_ZMS_LOOKUP_CACHE_WAYS)
 #define ZMS_HEAD_ID              GENMASK(31, 0)
 
 #define ZMS_VERSION_MASK        GENMASK(7, 0)
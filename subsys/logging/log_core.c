@@ -139,6 +139,28 @@ static const struct mpsc_pbuf_buffer_config mpsc_config = {
 };
 #endif
 
+#ifdef CONFIG_LOG_PERCPU_BUFFERS
+/* Each CPU gets an equal share of the log buffer. Messages are allocated from
+ * the buffer of the CPU which creates them, so the buffers are not shared
+ * between CPUs and their indexes and lock stay in the cache of that CPU.
+ */
+#define LOG_CPU_BUF_WLEN (ARRAY_SIZE(buf32) / CONFIG_MP_MAX_NUM_CPUS)
+
+BUILD_ASSERT(LOG_CPU_BUF_WLEN * sizeof(int) >= 128,
+	     "CONFIG_LOG_BUFFER_SIZE too small for the number of CPUs");
+
+/* Buffers of CPUs other than CPU 0 which uses log_buffer. */
+static struct mpsc_pbuf_buffer cpu_log_buffer[CONFIG_MP_MAX_NUM_CPUS - 1];
+
+/* Oldest message of each CPU buffer, claimed but not yet processed. */
+static union log_msg_generic *cpu_msg[CONFIG_MP_MAX_NUM_CPUS];
+
+static struct mpsc_pbuf_buffer *cpu_buffer(unsigned int cpu)
+{
+	return cpu == 0U ? &log_buffer : &cpu_log_buffer[cpu - 1U];
+}
+#endif
+
 /* Check that default tag can fit in tag buffer. */
 COND_CODE_0(CONFIG_LOG_TAG_MAX_LEN, (),
 	(BUILD_ASSERT(sizeof(CONFIG_LOG_TAG_DEFAULT) <= CONFIG_LOG_TAG_MAX_LEN + 1,
@@ -643,12 +665,52 @@ bool z_log_dropped_pending(void)
 
 void z_log_msg_init(void)
 {
-#ifdef CONFIG_MPSC_PBUF
+#ifdef CONFIG_LOG_PERCPU_BUFFERS
+	struct mpsc_pbuf_buffer_config config = mpsc_config;
+
+	for (unsigned int i = 0; i < CONFIG_MP_MAX_NUM_CPUS; i++) {
+		config.buf = &buf32[i * LOG_CPU_BUF_WLEN];
+		config.size = LOG_CPU_BUF_WLEN;
+		mpsc_pbuf_init(cpu_buffer(i), &config);
+		cpu_msg[i] = NULL;
+	}
+	curr_log_buffer = &log_buffer;
+#elif defined(CONFIG_MPSC_PBUF)
 	mpsc_pbuf_init(&log_buffer, &mpsc_config);
 	curr_log_buffer = &log_buffer;
 #endif
 }
 
+/* Buffer to which a new message of the current context is allocated. */
+static struct mpsc_pbuf_buffer *local_buffer_get(void)
+{
+#ifdef CONFIG_LOG_PERCPU_BUFFERS
+	/* The thread may migrate to another CPU right after the id is read.
+	 * This is harmless, buffers are still safe with multiple producers,
+	 * it only happens rarely.
+	 */
+	return cpu_buffer(arch_curr_cpu()->id);
+#else
+	return &log_buffer;
+#endif
+}
+
+/* Buffer from which a local message has been allocated. */
+static struct mpsc_pbuf_buffer *msg_buffer_get(const struct log_msg *msg)
+{
+#ifdef CONFIG_LOG_PERCPU_BUFFERS
+	size_t idx = ((const uint32_t *)msg - buf32) / LOG_CPU_BUF_WLEN;
+
+	__ASSERT_NO_MSG(idx < CONFIG_MP_MAX_NUM_CPUS);
+
+	return cpu_buffer(idx);
+#else
+	ARG_UNUSED(msg);
+
+	return &log_buffer;
+#endif
+}
+
 static struct log_msg *msg_alloc(struct mpsc_pbuf_buffer *buffer, uint32_t wlen)
 {
 	if (!IS_ENABLED(CONFIG_LOG_MODE_DEFERRED)) {
@@ -664,7 +726,7 @@ static struct log_msg *msg_alloc(struct mpsc_pbuf_buffer *buffer, uint32_t wlen)
 
 struct log_msg *z_log_msg_alloc(uint32_t wlen)
 {
-	return msg_alloc(&log_buffer, wlen);
+	return msg_alloc(local_buffer_get(), wlen);
 }
 
 static void msg_commit(struct mpsc_pbuf_buffer *buffer, struct log_msg *msg)
@@ -696,12 +758,49 @@ static void msg_commit(struct mpsc_pbuf_buffer *buffer, struct log_msg *msg)
 void z_log_msg_commit(struct log_msg *msg)
 {
 	msg->hdr.timestamp = timestamp_func();
-	msg_commit(&log_buffer, msg);
+	msg_commit(msg_buffer_get(msg), msg);
 }
 
+#ifdef CONFIG_LOG_PERCPU_BUFFERS
+/* Claim the oldest message (lowest timestamp) of all CPU buffers. */
+static union log_msg_generic *cpu_msg_claim_oldest(void)
+{
+	union log_msg_generic *msg;
+	log_timestamp_t t_min = 0;
+	int chosen = -1;
+
+	for (unsigned int i = 0; i < CONFIG_MP_MAX_NUM_CPUS; i++) {
+		if (cpu_msg[i] == NULL) {
+			cpu_msg[i] = (union log_msg_generic *)mpsc_pbuf_claim(cpu_buffer(i));
+		}
+
+		if (cpu_msg[i]) {
+			log_timestamp_t t = log_msg_get_timestamp(&cpu_msg[i]->log);
+
+			if ((chosen < 0) || (t < t_min)) {
+				t_min = t;
+				chosen = i;
+			}
+		}
+	}
+
+	if (chosen < 0) {
+		return NULL;
+	}
+
+	msg = cpu_msg[chosen];
+	cpu_msg[chosen] = NULL;
+	curr_log_buffer = cpu_buffer(chosen);
+
+	return msg;
+}
+#endif
+
 union log_msg_generic *z_log_msg_local_claim(void)
 {
-#ifdef CONFIG_MPSC_PBUF
+#ifdef CONFIG_LOG_PERCPU_BUFFERS
+	return cpu_msg_claim_oldest();
+#elif defined(CONFIG_MPSC_PBUF)
 	return (union log_msg_generic *)mpsc_pbuf_claim(&log_buffer);
 #else
 	return NULL;
@@ -811,6 +910,19 @@ static bool msg_pending(struct mpsc_pbuf_buffer *buffer)
 #endif
 }
 
+#ifdef CONFIG_LOG_PERCPU_BUFFERS
+static bool cpu_msg_pending(void)
+{
+	for (unsigned int i = 0; i < CONFIG_MP_MAX_NUM_CPUS; i++) {
+		if (cpu_msg[i] || msg_pending(cpu_buffer(i))) {
+			return true;
+		}
+	}
+
+	return false;
+}
+#endif
+
 bool z_log_msg_pending(void)
 {
 	size_t len;
@@ -818,6 +930,10 @@ bool z_log_msg_pending(void)
 
 	STRUCT_SECTION_COUNT(log_mpsc_pbuf, &len);
 
+#ifdef CONFIG_LOG_PERCPU_BUFFERS
+	return cpu_msg_pending();
+#endif
+
 	if (!IS_ENABLED(CONFIG_LOG_MULTIDOMAIN) || (len == 1)) {
 		return msg_pending(&log_buffer);
 	}
@@ -898,7 +1014,20 @@ int log_mem_get_usage(uint32_t *buf_size, uint32_t *usage)
 		return -EINVAL;
 	}
 
+#ifdef CONFIG_LOG_PERCPU_BUFFERS
+	*buf_size = 0;
+	*usage = 0;
+
+	for (unsigned int i = 0; i < CONFIG_MP_MAX_NUM_CPUS; i++) {
+		uint32_t size, now;
+
+		mpsc_pbuf_get_utilization(cpu_buffer(i), &size, &now);
+		*buf_size += size;
+		*usage += now;
+	}
+#else
 	mpsc_pbuf_get_utilization(&log_buffer, buf_size, usage);
+#endif
 
 	return 0;
 }
@@ -911,7 +1040,25 @@ int log_mem_get_max_usage(uint32_t *max)
 		return -EINVAL;
 	}
 
+#ifdef CONFIG_LOG_PERCPU_BUFFERS
+	/* Buffers peak at different times, the sum is an upper bound. */
+	*max = 0;
+
+	for (unsigned int i = 0; i < CONFIG_MP_MAX_NUM_CPUS; i++) {
+		uint32_t cpu_max;
+		int err = mpsc_pbuf_get_max_utilization(cpu_buffer(i), &cpu_max);
+
+		if (err < 0) {
+			return err;
+		}
+
+		*max += cpu_max;
+	}
+
+	return 0;
+#else
 	return mpsc_pbuf_get_max_utilization(&log_buffer, max);
+#endif
 }
 
 static void log_backend_notify_all(enum log_backend_evt event,
@@ -277,6 +277,55 @@ void z_impl_z_log_msg_simple_create_2(const void *source, uint32_t level,
 	z_log_msg_simple_create(source, level, data, ARRAY_SIZE(data));
 }
 
+void z_impl_z_log_msg_simple_create_3(const void *source, uint32_t level,
+				      const char *fmt, uint32_t arg0, uint32_t arg1,
+				      uint32_t arg2)
+{
+	/* There is no optimized frontend API for three arguments, so the frontend always
+	 * gets the generic call.
+	 */
+	if (IS_ENABLED(CONFIG_LOG_FRONTEND) && frontend_runtime_filtering(source, level)) {
+		uint32_t plen32 = CBPRINTF_DESC_SIZE32 + 4;
+		union cbprintf_package_hdr hdr = {
+			.desc = {
+				.len = plen32,
+				.ro_str_cnt =
+				   IS_ENABLED(CONFIG_LOG_MSG_APPEND_RO_STRING_LOC) ? 1 : 0
+			}
+		};
+		uint8_t package[sizeof(uint32_t) * (CBPRINTF_DESC_SIZE32 + 4) +
+			(IS_ENABLED(CONFIG_LOG_MSG_APPEND_RO_STRING_LOC) ? 1 : 0)]
+			__aligned(sizeof(uint32_t));
+		uint32_t *p32 = (uint32_t *)package;
+
+		*p32++ = (uint32_t)(uintptr_t)hdr.raw;
+		*p32++ = (uint32_t)(uintptr_t)fmt;
+		*p32++ = arg0;
+		*p32++ = arg1;
+		*p32++ = arg2;
+		if (IS_ENABLED(CONFIG_LOG_MSG_APPEND_RO_STRING_LOC)) {
+			/* fmt string located at index 1 */
+			*(uint8_t *)p32 = 1;
+		}
+
+		struct log_msg_desc desc = {
+			.level = level,
+			.package_len = sizeof(package),
+			.data_len = 0,
+		};
+
+		log_frontend_msg(source, desc, package, NULL);
+	}
+
+	if (!BACKENDS_IN_USE()) {
+		return;
+	}
+
+	uint32_t data[] = {(uint32_t)(uintptr_t)fmt, arg0, arg1, arg2};
+
+	z_log_msg_simple_create(source, level, data, ARRAY_SIZE(data));
+}
+
 void z_impl_z_log_msg_static_create(const void *source,
 			      const struct log_msg_desc desc,
 			      uint8_t *package, const void *data)
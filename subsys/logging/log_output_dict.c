@@ -12,12 +12,142 @@
 #include <zephyr/sys/__assert.h>
 #include <zephyr/sys/util.h>
 
+/* Longest LEB128 encoding of a 64 bit value. */
+#define VARINT_MAX_LEN 10
+
+/* Small staging buffer for the varint encoded fields of a compact message. */
+struct compact_out {
+	const struct log_output *output;
+	size_t len;
+	uint8_t buf[32];
+};
+
+static size_t varint_len(uint64_t val)
+{
+	size_t len = 1;
+
+	while (val > 0x7F) {
+		val >>= 7;
+		len++;
+	}
+
+	return len;
+}
+
+static void compact_flush(struct compact_out *out)
+{
+	if (out->len > 0U) {
+		log_output_write(out->output->func, out->buf, out->len,
+				 (void *)out->output->control_block->ctx);
+		out->len = 0U;
+	}
+}
+
+static void compact_put_byte(struct compact_out *out, uint8_t byte)
+{
+	if (out->len == sizeof(out->buf)) {
+		compact_flush(out);
+	}
+
+	out->buf[out->len++] = byte;
+}
+
+static void compact_put_varint(struct compact_out *out, uint64_t val)
+{
+	if (out->len + VARINT_MAX_LEN > sizeof(out->buf)) {
+		compact_flush(out);
+	}
+
+	while (val > 0x7F) {
+		out->buf[out->len++] = (uint8_t)(val | 0x80);
+		val >>= 7;
+	}
+
+	out->buf[out->len++] = (uint8_t)val;
+}
+
+static void compact_put_data(struct compact_out *out, uint8_t *data, size_t len)
+{
+	if (len > 0U) {
+		compact_flush(out);
+		log_output_write(out->output->func, data, len,
+				 (void *)out->output->control_block->ctx);
+	}
+}
+
+void log_dict_output_compact_msg_process(const struct log_output *output,
+					 struct log_msg *msg, uint32_t flags)
+{
+	struct log_output_control_block *ctrl = output->control_block;
+	struct compact_out out = { .output = output };
+	void *source = (void *)log_msg_get_source(msg);
+	log_timestamp_t timestamp = log_msg_get_timestamp(msg);
+	uintptr_t source_id = (source != NULL) ? log_source_id(source) : 0U;
+	uint8_t info = (msg->hdr.desc.level & 0x7) | ((msg->hdr.desc.domain & 0xF) << 3);
+	size_t pkg_len, data_len, frame_len, args_wlen;
+	uint8_t *package = log_msg_get_package(msg, &pkg_len);
+	uint8_t *data = log_msg_get_data(msg, &data_len);
+	uint64_t ts_field = timestamp;
+	uint32_t *args = (uint32_t *)package;
+
+	ARG_UNUSED(flags);
+
+	args_wlen = (pkg_len > 0U) ? ((union cbprintf_package_hdr *)package)->desc.len : 0U;
+	__ASSERT_NO_MSG(args_wlen * sizeof(uint32_t) <= pkg_len);
+
+	/* Timestamps usually grow by a small amount between messages. Going
+	 * back in time, the first message on this output and every
+	 * CONFIG_LOG_DICTIONARY_COMPACT_TS_SYNC_INTERVAL messages are sent
+	 * as is, so that the host recovers from lost messages.
+	 */
+	if ((ctrl->dict_timestamp == 0U) || (timestamp < ctrl->dict_timestamp) ||
+	    (ctrl->dict_ts_count >= CONFIG_LOG_DICTIONARY_COMPACT_TS_SYNC_INTERVAL)) {
+		info |= LOG_DICT_COMPACT_TS_ABSOLUTE;
+		ctrl->dict_ts_count = 0U;
+	} else {
+		ts_field = timestamp - ctrl->dict_timestamp;
+	}
+
+	ctrl->dict_timestamp = timestamp;
+	ctrl->dict_ts_count++;
+
+	frame_len = 1U + varint_len(source_id) + varint_len(ts_field) + varint_len(data_len) +
+		    (pkg_len - args_wlen * sizeof(uint32_t)) + data_len;
+	for (size_t i = 0; i < args_wlen; i++) {
+		frame_len += varint_len(args[i]);
+	}
+
+	compact_put_byte(&out, MSG_NORMAL_COMPACT);
+	compact_put_varint(&out, frame_len);
+	compact_put_byte(&out, info);
+	compact_put_varint(&out, source_id);
+	compact_put_varint(&out, ts_field);
+	compact_put_varint(&out, data_len);
+
+	/* Arguments are mostly small integers and the package header bytes. */
+	for (size_t i = 0; i < args_wlen; i++) {
+		compact_put_varint(&out, args[i]);
+	}
+
+	compact_put_data(&out, &package[args_wlen * sizeof(uint32_t)],
+			 pkg_len - args_wlen * sizeof(uint32_t));
+	compact_put_data(&out, data, data_len);
+	compact_flush(&out);
+
+	log_output_flush(output);
+}
+
 void log_dict_output_msg_process(const struct log_output *output,
 				 struct log_msg *msg, uint32_t flags)
 {
 	struct log_dict_output_normal_msg_hdr_t output_hdr;
 	void *source = (void *)log_msg_get_source(msg);
 
+	if (IS_ENABLED(CONFIG_LOG_DICTIONARY_COMPACT)) {
+		log_dict_output_compact_msg_process(output, msg, flags);
+		return;
+	}
+
 	/* Keep sync with header in struct log_msg */
 	output_hdr.type = MSG_NORMAL;
 	output_hdr.domain = msg->hdr.desc.domain;
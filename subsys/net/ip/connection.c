@@ -64,6 +64,19 @@ static struct net_conn conns[CONFIG_NET_MAX_CONN];
 static sys_slist_t conn_unused;
 static sys_slist_t conn_used;
 
+#if defined(CONFIG_NET_CONN_HASH)
+/** A fully specified connection has the highest possible rank */
+#define NET_CONN_FULL_SPEC		NET_CONN_RANK(0xff)
+
+/* TCP/UDP connections are also indexed for unicast lookups: fully
+ * specified ones on their whole tuple, the others on the local port,
+ * and the rest (no local port) in a wildcard list.
+ */
+static sys_slist_t conn_exact[CONFIG_NET_CONN_HASH_SIZE];
+static sys_slist_t conn_by_port[CONFIG_NET_CONN_HASH_SIZE];
+static sys_slist_t conn_wildcard;
+#endif /* CONFIG_NET_CONN_HASH */
+
 #if (CONFIG_NET_CONN_LOG_LEVEL >= LOG_LEVEL_DBG)
 static inline
 void conn_register_debug(struct net_conn *conn,
@@ -116,6 +129,77 @@ void conn_register_debug(struct net_conn *conn,
 
 static K_MUTEX_DEFINE(conn_lock);
 
+#if defined(CONFIG_NET_CONN_HASH)
+/* Ports are hashed in network byte order, as found in the packet */
+static uint32_t conn_hash(uint16_t proto, uint16_t local_port,
+			  uint16_t remote_port, const uint8_t *remote_addr,
+			  size_t addr_len)
+{
+	uint32_t hash = (((uint32_t)local_port << 16) | remote_port) ^ proto;
+
+	for (size_t i = 0; i < addr_len; i += sizeof(uint32_t)) {
+		hash = (hash ^ sys_get_be32(&remote_addr[i])) * 0x9e3779b1U;
+	}
+
+	hash *= 0x9e3779b1U;
+
+	return (hash ^ (hash >> 16)) % CONFIG_NET_CONN_HASH_SIZE;
+}
+
+static sys_slist_t *conn_index_list(struct net_conn *conn)
+{
+	uint16_t local_port = net_sin(&conn->local_addr)->sin_port;
+	struct sockaddr *remote = &conn->remote_addr;
+
+	if (conn->family != AF_INET && conn->family != AF_INET6 &&
+	    conn->family != AF_UNSPEC) {
+		/* Only ever matched by the full scan */
+		return NULL;
+	}
+
+	if ((conn->flags & NET_CONN_FULL_SPEC) == NET_CONN_FULL_SPEC) {
+		if (IS_ENABLED(CONFIG_NET_IPV6) && remote->sa_family == AF_INET6) {
+			return &conn_exact[conn_hash(conn->proto, local_port,
+						     net_sin6(remote)->sin6_port,
+						     net_sin6(remote)->sin6_addr.s6_addr,
+						     sizeof(struct in6_addr))];
+		} else if (IS_ENABLED(CONFIG_NET_IPV4) && remote->sa_family == AF_INET) {
+			return &conn_exact[conn_hash(conn->proto, local_port,
+						     net_sin(remote)->sin_port,
+						     net_sin(remote)->sin_addr.s4_addr,
+						     sizeof(struct in_addr))];
+		}
+	}
+
+	if (local_port != 0U) {
+		return &conn_by_port[conn_hash(conn->proto, local_port, 0, NULL, 0)];
+	}
+
+	return &conn_wildcard;
+}
+
+/* Must be called with conn_lock held */
+static void conn_index_add(struct net_conn *conn)
+{
+	conn->hash_list = conn_index_list(conn);
+	if (conn->hash_list != NULL) {
+		sys_slist_prepend(conn->hash_list, &conn->hash_node);
+	}
+}
+
+/* Must be called with conn_lock held */
+static void conn_index_remove(struct net_conn *conn)
+{
+	if (conn->hash_list != NULL) {
+		sys_slist_find_and_remove(conn->hash_list, &conn->hash_node);
+		conn->hash_list = NULL;
+	}
+}
+#else
+#define conn_index_add(...)
+#define conn_index_remove(...)
+#endif /* CONFIG_NET_CONN_HASH */
+
 static struct net_conn *conn_get_unused(void)
 {
 	sys_snode_t *node;
@@ -141,6 +225,7 @@ static void conn_set_used(struct net_conn *conn)
 
 	k_mutex_lock(&conn_lock, K_FOREVER);
 	sys_slist_prepend(&conn_used, &conn->node);
+	conn_index_add(conn);
 	k_mutex_unlock(&conn_lock);
 }
 
@@ -452,6 +537,7 @@ int net_conn_unregister(struct net_conn_handle *handle)
 
 	k_mutex_lock(&conn_lock, K_FOREVER);
 	sys_slist_find_and_remove(&conn_used, &conn->node);
+	conn_index_remove(conn);
 	k_mutex_unlock(&conn_lock);
 
 	conn_set_unused(conn);
@@ -478,7 +564,21 @@ int net_conn_update(struct net_conn_handle *handle,
 
 	net_conn_change_callback(conn, cb, user_data);
 
+#if defined(CONFIG_NET_CONN_HASH)
+	k_mutex_lock(&conn_lock, K_FOREVER);
+
+	ret = net_conn_change_remote(conn, remote_addr, remote_port);
+
+	/* The remote end might have moved the connection to another list */
+	if (conn_index_list(conn) != conn->hash_list) {
+		conn_index_remove(conn);
+		conn_index_add(conn);
+	}
+
+	k_mutex_unlock(&conn_lock);
+#else
 	ret = net_conn_change_remote(conn, remote_addr, remote_port);
+#endif
 
 	return ret;
 }
@@ -534,6 +634,53 @@ static bool conn_addr_cmp(struct net_pkt *pkt,
 	return true;
 }
 
+/* Is the TCP/UDP connection matching the packet's addresses and ports? */
+static bool conn_ip_match(struct net_conn *conn, struct net_pkt *pkt,
+			  union net_ip_header *ip_hdr,
+			  uint16_t src_port, uint16_t dst_port)
+{
+	uint8_t pkt_family = net_pkt_family(pkt);
+
+	if (net_sin(&conn->remote_addr)->sin_port &&
+	    net_sin(&conn->remote_addr)->sin_port != src_port) {
+		return false; /* wrong remote port */
+	}
+
+	if (net_sin(&conn->local_addr)->sin_port &&
+	    net_sin(&conn->local_addr)->sin_port != dst_port) {
+		return false; /* wrong local port */
+	}
+
+	if ((conn->flags & NET_CONN_REMOTE_ADDR_SET) &&
+	    !conn_addr_cmp(pkt, ip_hdr, &conn->remote_addr, true)) {
+		return false; /* wrong remote address */
+	}
+
+	if ((conn->flags & NET_CONN_LOCAL_ADDR_SET) &&
+	    !conn_addr_cmp(pkt, ip_hdr, &conn->local_addr, false)) {
+
+		/* Check if we could do a v4-mapping-to-v6 and the IPv6 socket
+		 * has no IPV6_V6ONLY option set and if the local IPV6 address
+		 * is unspecified, then we could accept a connection from IPv4
+		 * address by mapping it to IPv6 address.
+		 */
+		if (IS_ENABLED(CONFIG_NET_IPV4_MAPPING_TO_IPV6)) {
+			if (!(conn->family == AF_INET6 && pkt_family == AF_INET &&
+			      !conn->v6only &&
+			      net_ipv6_is_addr_unspecified(
+				      &net_sin6(&conn->local_addr)->sin6_addr))) {
+				return false; /* wrong local address */
+			}
+		} else {
+			return false; /* wrong local address */
+		}
+
+		/* We might have a match for v4-to-v6 mapping */
+	}
+
+	return true;
+}
+
 static inline void conn_send_icmp_error(struct net_pkt *pkt)
 {
 	if (IS_ENABLED(CONFIG_NET_DISABLE_ICMP_DESTINATION_UNREACHABLE)) {
@@ -634,6 +781,85 @@ static enum net_verdict conn_raw_socket(struct net_pkt *pkt,
 	return NET_OK;
 }
 
+#if defined(CONFIG_NET_CONN_HASH)
+/* Is the connection matching the packet's interface, family and protocol?
+ * Same checks as the full scan in net_conn_input() does for an IP packet.
+ */
+static bool conn_ip_candidate(struct net_conn *conn, struct net_pkt *pkt,
+			      uint8_t proto)
+{
+	uint8_t pkt_family = net_pkt_family(pkt);
+
+	if (conn->context != NULL &&
+	    net_context_is_bound_to_iface(conn->context) &&
+	    net_pkt_iface(pkt) != net_context_get_iface(conn->context)) {
+		return false; /* wrong interface */
+	}
+
+	if (conn->family != AF_UNSPEC && conn->family != pkt_family) {
+		if (!IS_ENABLED(CONFIG_NET_IPV4_MAPPING_TO_IPV6) ||
+		    !(conn->family == AF_INET6 && pkt_family == AF_INET &&
+		      !conn->v6only)) {
+			return false; /* wrong protocol family */
+		}
+	}
+
+	return conn->proto == proto;
+}
+
+/* Finds the connection the full scan would pick for a unicast TCP/UDP
+ * packet. A fully specified connection has the highest possible rank, so
+ * the first matching one wins outright. Otherwise the best ranked match
+ * is among the connections bound to the destination port or the wildcard
+ * ones; the two sets never share a rank since only the former have
+ * NET_CONN_LOCAL_PORT_SPEC. Within a list, newer connections come first
+ * as in conn_used, so ties are broken the same way.
+ */
+static struct net_conn *conn_index_lookup(struct net_pkt *pkt,
+					  union net_ip_header *ip_hdr,
+					  uint8_t proto,
+					  uint16_t src_port,
+					  uint16_t dst_port)
+{
+	struct net_conn *best_match = NULL;
+	int16_t best_rank = -1;
+	sys_slist_t *lists[2];
+	struct net_conn *conn;
+	uint32_t hash;
+
+	if (IS_ENABLED(CONFIG_NET_IPV6) && net_pkt_family(pkt) == AF_INET6) {
+		hash = conn_hash(proto, dst_port, src_port, ip_hdr->ipv6->src,
+				 sizeof(struct in6_addr));
+	} else {
+		hash = conn_hash(proto, dst_port, src_port, ip_hdr->ipv4->src,
+				 sizeof(struct in_addr));
+	}
+
+	SYS_SLIST_FOR_EACH_CONTAINER(&conn_exact[hash], conn, hash_node) {
+		if (conn_ip_candidate(conn, pkt, proto) &&
+		    conn_ip_match(conn, pkt, ip_hdr, src_port, dst_port)) {
+			return conn;
+		}
+	}
+
+	lists[0] = &conn_by_port[conn_hash(proto, dst_port, 0, NULL, 0)];
+	lists[1] = &conn_wildcard;
+
+	ARRAY_FOR_EACH(lists, i) {
+		SYS_SLIST_FOR_EACH_CONTAINER(lists[i], conn, hash_node) {
+			if (best_rank < NET_CONN_RANK(conn->flags) &&
+			    conn_ip_candidate(conn, pkt, proto) &&
+			    conn_ip_match(conn, pkt, ip_hdr, src_port, dst_port)) {
+				best_rank = NET_CONN_RANK(conn->flags);
+				best_match = conn;
+			}
+		}
+	}
+
+	return best_match;
+}
+#endif /* CONFIG_NET_CONN_HASH */
+
 enum net_verdict net_conn_input(struct net_pkt *pkt,
 				union net_ip_header *ip_hdr,
 				uint8_t proto,
@@ -710,6 +936,14 @@ enum net_verdict net_conn_input(struct net_pkt *pkt,
 
 	k_mutex_lock(&conn_lock, K_FOREVER);
 
+#if defined(CONFIG_NET_CONN_HASH)
+	/* Multicast packets go to every match, so they need the full scan */
+	if ((pkt_family == AF_INET || pkt_family == AF_INET6) && !is_mcast_pkt) {
+		best_match = conn_index_lookup(pkt, ip_hdr, proto, src_port, dst_port);
+		goto lookup_done;
+	}
+#endif
+
 	SYS_SLIST_FOR_EACH_CONTAINER(&conn_used, conn, node) {
 		/* Is the candidate connection matching the packet's interface? */
 		if (conn->context != NULL &&
@@ -798,43 +1032,8 @@ enum net_verdict net_conn_input(struct net_pkt *pkt,
 			/* Is the candidate connection matching the packet's TCP/UDP
 			 * address and port?
 			 */
-			if (net_sin(&conn->remote_addr)->sin_port &&
-			    net_sin(&conn->remote_addr)->sin_port != src_port) {
-				continue; /* wrong remote port */
-			}
-
-			if (net_sin(&conn->local_addr)->sin_port &&
-			    net_sin(&conn->local_addr)->sin_port != dst_port) {
-				continue; /* wrong local port */
-			}
-
-			if ((conn->flags & NET_CONN_REMOTE_ADDR_SET) &&
-			    !conn_addr_cmp(pkt, ip_hdr, &conn->remote_addr, true)) {
-				continue; /* wrong remote address */
-			}
-
-			if ((conn->flags & NET_CONN_LOCAL_ADDR_SET) &&
-			    !conn_addr_cmp(pkt, ip_hdr, &conn->local_addr, false)) {
-
-				/* Check if we could do a v4-mapping-to-v6 and the IPv6 socket
-				 * has no IPV6_V6ONLY option set and if the local IPV6 address
-				 * is unspecified, then we could accept a connection from IPv4
-				 * address by mapping it to IPv6 address.
-				 */
-				if (IS_ENABLED(CONFIG_NET_IPV4_MAPPING_TO_IPV6)) {
-					if (!(conn->family == AF_INET6 && pkt_family == AF_INET &&
-					      !conn->v6only &&
-					      net_ipv6_is_addr_unspecified(
-						      &net_sin6(&conn->local_addr)->sin6_addr))) {
-						continue; /* wrong local address */
-					}
-				} else {
-					continue; /* wrong local address */
-				}
-
-				/* We might have a match for v4-to-v6 mapping,
-				 * continue with rank checking.
-				 */
+			if (!conn_ip_match(conn, pkt, ip_hdr, src_port, dst_port)) {
+				continue;
 			}
 
 			if (best_rank < NET_CONN_RANK(conn->flags)) {
@@ -878,6 +1077,9 @@ enum net_verdict net_conn_input(struct net_pkt *pkt,
 		}
 	} /* loop end */
 
+#if defined(CONFIG_NET_CONN_HASH)
+lookup_done:
+#endif
 	if (best_match) {
 		cb = best_match->cb;
 		user_data = best_match->user_data;
@@ -965,6 +1167,14 @@ void net_conn_init(void)
 	sys_slist_init(&conn_unused);
 	sys_slist_init(&conn_used);
 
+#if defined(CONFIG_NET_CONN_HASH)
+	ARRAY_FOR_EACH(conn_exact, j) {
+		sys_slist_init(&conn_exact[j]);
+		sys_slist_init(&conn_by_port[j]);
+	}
+	sys_slist_init(&conn_wildcard);
+#endif
+
 	for (i = 0; i < CONFIG_NET_MAX_CONN; i++) {
 		sys_slist_prepend(&conn_unused, &conns[i].node);
 	}
@@ -54,6 +54,14 @@ struct net_conn {
 	/** Internal slist node */
 	sys_snode_t node;
 
+#if defined(CONFIG_NET_CONN_HASH)
+	/** Node in the lookup index */
+	sys_snode_t hash_node;
+
+	/** Index list the connection is on, NULL if not indexed */
+	sys_slist_t *hash_list;
+#endif
+
 	/** Remote socket address */
 	struct sockaddr remote_addr;
 
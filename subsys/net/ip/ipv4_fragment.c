@@ -624,9 +624,10 @@ enum net_verdict net_ipv4_prepare_for_send_fragment(struct net_pkt *pkt)
 	}
 
 	/* If we have already fragmented the packet, the ID field will contain a non-zero value
-	 * and we can skip other checks.
+	 * and we can skip other checks. TCP GSO packets are split into segments fitting the MTU
+	 * later on, so they are not fragmented either.
 	 */
-	if (ip_hdr->id[0] == 0 && ip_hdr->id[1] == 0) {
+	if (ip_hdr->id[0] == 0 && ip_hdr->id[1] == 0 && net_pkt_gso_size(pkt) == 0U) {
 		size_t pkt_len = net_pkt_get_len(pkt);
 		uint16_t mtu;
 
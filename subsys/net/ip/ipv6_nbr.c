@@ -793,9 +793,11 @@ enum net_verdict net_ipv6_prepare_for_send(struct net_pkt *pkt)
 
 #if defined(CONFIG_NET_IPV6_FRAGMENT)
 	/* If we have already fragmented the packet, the fragment id will
-	 * contain a proper value and we can skip other checks.
+	 * contain a proper value and we can skip other checks. TCP GSO
+	 * packets are split into segments fitting the MTU later on, so
+	 * they are not fragmented either.
 	 */
-	if (net_pkt_ipv6_fragment_id(pkt) == 0U) {
+	if (net_pkt_ipv6_fragment_id(pkt) == 0U && net_pkt_gso_size(pkt) == 0U) {
 		size_t pkt_len = net_pkt_get_len(pkt);
 		uint16_t mtu;
 
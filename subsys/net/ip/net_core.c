@@ -133,6 +133,14 @@ static inline enum net_verdict process_data(struct net_pkt *pkt,
 			return ret;
 		}
 
+		if (IS_ENABLED(CONFIG_NET_TCP_GRO) && !is_loopback &&
+		    !locally_routed) {
+			ret = net_tcp_gro_receive(pkt);
+			if (ret != NET_CONTINUE) {
+				return ret;
+			}
+		}
+
 		/* IP version and header length. */
 		uint8_t vtc_vhl = NET_IPV6_HDR(pkt)->vtc & 0xf0;
 
@@ -363,6 +371,20 @@ drop:
 	return ret;
 }
 
+#if defined(CONFIG_NET_TCP_GSO)
+/* Segment sink of net_tcp_gso_send() for packets destined back to us */
+static int loopback_segment(struct net_if *iface, struct net_pkt *pkt)
+{
+	size_t len = net_pkt_get_len(pkt);
+
+	ARG_UNUSED(iface);
+
+	processing_data(pkt, true);
+
+	return len;
+}
+#endif
+
 /* Called when data needs to be sent to network */
 int net_send_data(struct net_pkt *pkt)
 {
@@ -402,6 +424,24 @@ int net_send_data(struct net_pkt *pkt)
 		 * to RX processing.
 		 */
 		NET_DBG("Loopback pkt %p back to us", pkt);
+
+#if defined(CONFIG_NET_TCP_GSO)
+		/* GSO packets are otherwise only split by net_if_tx(),
+		 * which is skipped here, and the receive path expects
+		 * segments with a valid checksum.
+		 */
+		if (net_pkt_gso_size(pkt) > 0U) {
+			ret = net_tcp_gso_send(net_pkt_iface(pkt), pkt,
+					       loopback_segment);
+			if (ret < 0) {
+				goto err;
+			}
+
+			ret = 0;
+			goto err;
+		}
+#endif
+
 		processing_data(pkt, true);
 		ret = 0;
 		goto err;
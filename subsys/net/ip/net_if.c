@@ -37,6 +37,7 @@ LOG_MODULE_REGISTER(net_if, CONFIG_NET_IF_LOG_LEVEL);
 #include "ipv6.h"
 
 #include "net_stats.h"
+#include "tcp_internal.h"
 
 #define REACHABLE_TIME (MSEC_PER_SEC * 30) /* in ms */
 /*
@@ -213,6 +214,31 @@ static void update_txtime_stats_detail(struct net_pkt *pkt,
 	}
 }
 
+static bool need_tx_segmentation(struct net_if *iface)
+{
+#if defined(CONFIG_NET_L2_ETHERNET)
+	if (net_if_l2(iface) != &NET_L2_GET_NAME(ETHERNET)) {
+		/* VLAN interfaces pass the packet to the main Ethernet
+		 * interface as is, so it decides.
+		 */
+		if (IS_ENABLED(CONFIG_NET_VLAN) && net_eth_is_vlan_interface(iface)) {
+			iface = net_eth_get_vlan_main(iface);
+			if (iface == NULL) {
+				return true;
+			}
+		} else {
+			return true;
+		}
+	}
+
+	return !(net_eth_get_hw_capabilities(iface) & ETHERNET_HW_TX_TSO);
+#else
+	ARG_UNUSED(iface);
+
+	return true;
+#endif
+}
+
 static bool net_if_tx(struct net_if *iface, struct net_pkt *pkt)
 {
 	struct net_linkaddr ll_dst = {
@@ -264,7 +290,13 @@ static bool net_if_tx(struct net_if *iface, struct net_pkt *pkt)
 		}
 
 		net_if_tx_lock(iface);
-		status = net_if_l2(iface)->send(iface, pkt);
+		if (IS_ENABLED(CONFIG_NET_TCP_GSO) && net_pkt_gso_size(pkt) > 0U &&
+		    need_tx_segmentation(iface)) {
+			status = net_tcp_gso_send(iface, pkt,
+						  net_if_l2(iface)->send);
+		} else {
+			status = net_if_l2(iface)->send(iface, pkt);
+		}
 		net_if_tx_unlock(iface);
 
 		if (IS_ENABLED(CONFIG_NET_PKT_TXTIME_STATS) ||
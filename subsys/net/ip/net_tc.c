@@ -17,6 +17,7 @@ LOG_MODULE_REGISTER(net_tc, CONFIG_NET_TC_LOG_LEVEL);
 #include "net_private.h"
 #include "net_stats.h"
 #include "net_tc_mapping.h"
+#include "tcp_internal.h"
 
 #define TC_RX_PSEUDO_QUEUE (COND_CODE_1(CONFIG_NET_TC_RX_SKIP_FOR_HIGH_PRIO, (1), (0)))
 #define NET_TC_RX_EFFECTIVE_COUNT (NET_TC_RX_COUNT + TC_RX_PSEUDO_QUEUE)
@@ -286,19 +287,47 @@ static void net_tc_rx_stats_priority_setup(struct net_if *iface,
 #endif
 
 #if NET_TC_RX_COUNT > 0
-static void tc_rx_handler(void *p1, void *p2, void *p3)
+#if defined(CONFIG_NET_TCP_GRO)
+int net_tc_rx_current(void)
 {
-	ARG_UNUSED(p3);
+	k_tid_t tid = k_current_get();
+
+	for (int i = 0; i < NET_TC_RX_COUNT; i++) {
+		if (tid == &rx_classes[i].handler) {
+			return i;
+		}
+	}
 
+	return -1;
+}
+#endif
+
+static void tc_rx_handler(void *p1, void *p2, void *p3)
+{
 	struct k_fifo *fifo = p1;
 #if NET_TC_RX_EFFECTIVE_COUNT > 1
 	struct k_sem *fifo_slot = p2;
 #else
 	ARG_UNUSED(p2);
 #endif
+	int tc = POINTER_TO_INT(p3);
 	struct net_pkt *pkt;
+#if defined(CONFIG_NET_TCP_GRO)
+	unsigned int batch = 0U;
+#endif
 
 	while (1) {
+#if defined(CONFIG_NET_TCP_GRO)
+		/* Pass on the coalesced TCP segments at the end of each batch,
+		 * before going idle or after CONFIG_NET_TCP_GRO_BATCH packets,
+		 * so that a held segment never waits for more than one batch.
+		 */
+		if (k_fifo_is_empty(fifo) || batch >= CONFIG_NET_TCP_GRO_BATCH) {
+			net_tcp_gro_flush(tc);
+			batch = 0U;
+		}
+#endif
+
 		pkt = k_fifo_get(fifo, K_FOREVER);
 		if (pkt == NULL) {
 			continue;
@@ -309,6 +338,9 @@ static void tc_rx_handler(void *p1, void *p2, void *p3)
 #endif
 
 		net_process_rx_packet(pkt);
+#if defined(CONFIG_NET_TCP_GRO)
+		batch++;
+#endif
 	}
 }
 #endif
@@ -461,7 +493,7 @@ void net_tc_rx_init(void)
 #else
 				      NULL,
 #endif
-				      NULL,
+				      INT_TO_POINTER(i),
 				      priority, 0, K_FOREVER);
 		if (!tid) {
 			NET_ERR("Cannot create TC handler thread %d", i);
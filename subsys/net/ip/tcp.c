@@ -76,6 +76,31 @@ static K_MUTEX_DEFINE(tcp_lock);
 K_MEM_SLAB_DEFINE_STATIC(tcp_conns_slab, sizeof(struct tcp),
 				CONFIG_NET_MAX_CONTEXTS, 4);
 
+#if defined(CONFIG_NET_TCP_ZEROCOPY_TX)
+static void tcp_view_destroy(struct net_buf *buf);
+static void tcp_zc_buf_destroy(struct net_buf *buf);
+
+/* Views into the send queue buffers, holding a reference to the viewed buffer */
+NET_BUF_POOL_FIXED_DEFINE(tcp_view_pool, CONFIG_NET_TCP_ZEROCOPY_TX_VIEWS, 0,
+			  sizeof(struct net_buf *), tcp_view_destroy);
+
+/* Release callback of one net_tcp_queue_zc() call, called once all of the
+ * buffers queued by the call are destroyed, in whatever order that happens.
+ */
+struct tcp_zc_completion {
+	atomic_t pending;
+	net_tcp_zc_cb_t cb;
+	void *user_data;
+};
+
+K_MEM_SLAB_DEFINE_STATIC(tcp_zc_completion_slab, sizeof(struct tcp_zc_completion),
+			 CONFIG_NET_TCP_ZEROCOPY_TX_BUFS, 4);
+
+/* Application owned data queued with net_tcp_queue_zc() */
+NET_BUF_POOL_FIXED_DEFINE(tcp_zc_buf_pool, CONFIG_NET_TCP_ZEROCOPY_TX_BUFS, 0,
+			  sizeof(struct tcp_zc_completion *), tcp_zc_buf_destroy);
+#endif /* CONFIG_NET_TCP_ZEROCOPY_TX */
+
 static struct k_work_q tcp_work_q;
 static K_KERNEL_STACK_DEFINE(work_q_stack, CONFIG_NET_TCP_WORKQ_STACK_SIZE);
 
@@ -1559,6 +1584,7 @@ static int tcp_out_ext(struct tcp *conn, uint8_t flags, struct net_pkt *data,
 		/* Append the data buffer to the pkt */
 		net_pkt_append_buffer(pkt, data->buffer);
 		data->buffer = NULL;
+		net_pkt_set_gso_size(pkt, net_pkt_gso_size(data));
 	}
 
 	ret = ip_header_add(conn, pkt);
@@ -1649,6 +1675,109 @@ static int tcp_pkt_peek(struct net_pkt *to, struct net_pkt *from, size_t pos,
 	return net_pkt_copy(to, from, len);
 }
 
+#if defined(CONFIG_NET_TCP_ZEROCOPY_TX)
+static void tcp_view_destroy(struct net_buf *buf)
+{
+	struct net_buf *parent = *(struct net_buf **)net_buf_user_data(buf);
+
+	net_buf_destroy(buf);
+	net_buf_unref(parent);
+}
+
+static void tcp_zc_completion_put(struct tcp_zc_completion *comp, bool notify)
+{
+	if (atomic_dec(&comp->pending) != 1) {
+		return;
+	}
+
+	if (notify && comp->cb != NULL) {
+		comp->cb(comp->user_data);
+	}
+
+	k_mem_slab_free(&tcp_zc_completion_slab, comp);
+}
+
+static void tcp_zc_buf_destroy(struct net_buf *buf)
+{
+	struct tcp_zc_completion *comp = *(struct tcp_zc_completion **)net_buf_user_data(buf);
+
+	net_buf_destroy(buf);
+	tcp_zc_completion_put(comp, true);
+}
+
+/* Same as tcp_pkt_peek(), but the data is referenced by views instead of
+ * being copied.
+ */
+static int tcp_pkt_slice(struct net_pkt *to, struct net_pkt *from, size_t pos,
+			 size_t len)
+{
+	struct net_buf *buf = from->buffer;
+	struct net_buf *last = NULL;
+
+	while (buf != NULL && pos >= buf->len) {
+		pos -= buf->len;
+		buf = buf->frags;
+	}
+
+	while (buf != NULL && len > 0) {
+		size_t view_len = MIN(len, buf->len - pos);
+		struct net_buf *view;
+
+		view = net_buf_alloc_with_data(&tcp_view_pool, buf->data + pos,
+					       view_len, K_NO_WAIT);
+		if (view == NULL) {
+			return -ENOBUFS;
+		}
+
+		*(struct net_buf **)net_buf_user_data(view) = net_buf_ref(buf);
+
+		if (last == NULL) {
+			net_pkt_append_buffer(to, view);
+		} else {
+			net_buf_frag_insert(last, view);
+		}
+
+		last = view;
+		len -= view_len;
+		pos = 0;
+		buf = buf->frags;
+	}
+
+	return len == 0 ? 0 : -EINVAL;
+}
+#endif /* CONFIG_NET_TCP_ZEROCOPY_TX */
+
+/* Remove the acknowledged data from the head of the send queue */
+static int tcp_send_data_pull(struct net_pkt *pkt, size_t len)
+{
+#if defined(CONFIG_NET_TCP_ZEROCOPY_TX)
+	/* Segments may still refer to the queued data, so it is not moved
+	 * like tcp_pkt_pull() does, the buffers are only advanced.
+	 */
+	if (len > net_pkt_get_len(pkt)) {
+		return -EINVAL;
+	}
+
+	while (len > 0) {
+		struct net_buf *buf = pkt->buffer;
+		size_t pull_len = MIN(len, buf->len);
+
+		(void)net_buf_pull(buf, pull_len);
+		len -= pull_len;
+
+		if (buf->len == 0U) {
+			pkt->buffer = net_buf_frag_del(NULL, buf);
+		}
+	}
+
+	net_pkt_cursor_init(pkt);
+
+	return 0;
+#else
+	return tcp_pkt_pull(pkt, len);
+#endif /* CONFIG_NET_TCP_ZEROCOPY_TX */
+}
+
 static int tcp_pkt_append(struct net_pkt *pkt, const uint8_t *data, size_t len)
 {
 	size_t alloc_len = len;
@@ -1736,13 +1865,37 @@ static int tcp_unsent_len(struct tcp *conn)
 	return unsent_len;
 }
 
+#if defined(CONFIG_NET_TCP_GSO)
+/* Leave room for the largest IP and TCP headers in the IP length field */
+#define TCP_GSO_MAX_LEN (UINT16_MAX - 120)
+
+/* Maximum amount of data sent as one packet */
+static int tcp_send_len_max(struct tcp *conn)
+{
+	int mss = conn_mss(conn);
+
+	/* Retransmit one segment at a time, and leave the 6lo technologies
+	 * alone as they compress and fragment the packets on their own.
+	 */
+	if (conn->data_mode == TCP_DATA_MODE_RESEND ||
+	    (IS_ENABLED(CONFIG_NET_L2_IEEE802154) &&
+	     net_if_l2(conn->iface) == &NET_L2_GET_NAME(IEEE802154))) {
+		return mss;
+	}
+
+	return MIN(mss * CONFIG_NET_TCP_GSO_MAX_SEGS, TCP_GSO_MAX_LEN);
+}
+#else
+#define tcp_send_len_max(conn) conn_mss(conn)
+#endif /* CONFIG_NET_TCP_GSO */
+
 static int tcp_send_data(struct tcp *conn)
 {
 	int ret = 0;
 	int len;
 	struct net_pkt *pkt;
 
-	len = MIN(tcp_unsent_len(conn), conn_mss(conn));
+	len = MIN(tcp_unsent_len(conn), tcp_send_len_max(conn));
 	if (len < 0) {
 		ret = len;
 		goto out;
@@ -1753,20 +1906,33 @@ static int tcp_send_data(struct tcp *conn)
 		goto out;
 	}
 
+#if defined(CONFIG_NET_TCP_ZEROCOPY_TX)
+	/* The data buffers are views into the send queue */
+	pkt = tcp_pkt_alloc(conn, 0);
+#else
 	pkt = tcp_pkt_alloc(conn, len);
+#endif
 	if (!pkt) {
 		NET_ERR("conn: %p packet allocation failed, len=%d", conn, len);
 		ret = -ENOBUFS;
 		goto out;
 	}
 
+#if defined(CONFIG_NET_TCP_ZEROCOPY_TX)
+	ret = tcp_pkt_slice(pkt, conn->send_data, conn->unacked_len, len);
+#else
 	ret = tcp_pkt_peek(pkt, conn->send_data, conn->unacked_len, len);
+#endif
 	if (ret < 0) {
 		tcp_pkt_unref(pkt);
 		ret = -ENOBUFS;
 		goto out;
 	}
 
+	if (len > conn_mss(conn)) {
+		net_pkt_set_gso_size(pkt, conn_mss(conn));
+	}
+
 	ret = tcp_out_ext(conn, PSH | ACK, pkt, conn->seq + conn->unacked_len);
 	if (ret == 0) {
 		conn->unacked_len += len;
@@ -3184,8 +3350,8 @@ next_state:
 			NET_DBG("conn: %p len_acked=%u", conn, len_acked);
 
 			if ((conn->send_data_total < len_acked) ||
-					(tcp_pkt_pull(conn->send_data,
-						      len_acked) < 0)) {
+					(tcp_send_data_pull(conn->send_data,
+							    len_acked) < 0)) {
 				NET_ERR("conn: %p, Invalid len_acked=%u "
 					"(total=%zu)", conn, len_acked,
 					conn->send_data_total);
@@ -3802,6 +3968,104 @@ out:
 	return ret;
 }
 
+#if defined(CONFIG_NET_TCP_ZEROCOPY_TX)
+int net_tcp_queue_zc(struct net_context *context, const struct msghdr *msg,
+		     net_tcp_zc_cb_t cb, void *user_data)
+{
+	struct tcp *conn = context->tcp;
+	struct tcp_zc_completion *comp;
+	struct net_buf *head = NULL;
+	struct net_buf *last = NULL;
+	size_t queued_len = 0;
+	size_t len = 0;
+	int ret = 0;
+
+	if (!conn || conn->state != TCP_ESTABLISHED) {
+		return -ENOTCONN;
+	}
+
+	k_mutex_lock(&conn->lock, K_FOREVER);
+
+	if (tcp_window_full(conn)) {
+		ret = -EAGAIN;
+		goto out;
+	}
+
+	if (k_mem_slab_alloc(&tcp_zc_completion_slab, (void **)&comp, K_NO_WAIT) < 0) {
+		ret = -ENOBUFS;
+		goto out;
+	}
+
+	/* Held until all the buffers are queued, so that the callback can't
+	 * run before the last one is.
+	 */
+	atomic_set(&comp->pending, 1);
+	comp->cb = cb;
+	comp->user_data = user_data;
+
+	for (int i = 0; i < msg->msg_iovlen; i++) {
+		len += msg->msg_iov[i].iov_len;
+	}
+
+	len = MIN(conn->send_win - conn->send_data_total, len);
+
+	for (int i = 0; i < msg->msg_iovlen && len > 0; i++) {
+		size_t iovlen = MIN(msg->msg_iov[i].iov_len, len);
+		struct net_buf *buf;
+
+		if (iovlen == 0) {
+			continue;
+		}
+
+		buf = net_buf_alloc_with_data(&tcp_zc_buf_pool,
+					      msg->msg_iov[i].iov_base,
+					      iovlen, K_NO_WAIT);
+		if (buf == NULL) {
+			break;
+		}
+
+		atomic_inc(&comp->pending);
+		*(struct tcp_zc_completion **)net_buf_user_data(buf) = comp;
+
+		if (head == NULL) {
+			head = buf;
+		} else {
+			net_buf_frag_insert(last, buf);
+		}
+
+		last = buf;
+		queued_len += iovlen;
+		len -= iovlen;
+	}
+
+	if (head == NULL) {
+		tcp_zc_completion_put(comp, false);
+		ret = len > 0 ? -ENOBUFS : 0;
+		goto out;
+	}
+
+	net_pkt_append_buffer(conn->send_data, head);
+	conn->send_data_total += queued_len;
+
+	ret = tcp_send_queued_data(conn);
+	if (ret < 0 && ret != -ENOBUFS) {
+		/* The buffers are released with the connection, so they still
+		 * count as queued. The error is reported by the next call.
+		 */
+		tcp_conn_close(conn, ret);
+	} else if (tcp_window_full(conn)) {
+		(void)k_sem_take(&conn->tx_sem, K_NO_WAIT);
+	}
+
+	tcp_zc_completion_put(comp, true);
+	ret = queued_len;
+out:
+	k_mutex_unlock(&conn->lock);
+
+	return ret;
+}
+#endif /* CONFIG_NET_TCP_ZEROCOPY_TX */
+
 /* net context is about to send out queued data - inform caller only */
 int net_tcp_send_data(struct net_context *context, net_context_send_cb_t cb,
 		      void *user_data)
@@ -4093,6 +4357,11 @@ int net_tcp_finalize(struct net_pkt *pkt, bool force_chksum)
 
 	tcp_hdr->chksum = 0U;
 
+	/* The segments of a GSO packet get their checksum when it is split */
+	if (net_pkt_gso_size(pkt) > 0U) {
+		return net_pkt_set_data(pkt, &tcp_access);
+	}
+
 	if (net_if_need_calc_tx_checksum(net_pkt_iface(pkt), type) || force_chksum) {
 		tcp_hdr->chksum = net_calc_chksum_tcp(pkt);
 		net_pkt_set_chksum_done(pkt, true);
@@ -4101,6 +4370,123 @@ int net_tcp_finalize(struct net_pkt *pkt, bool force_chksum)
 	return net_pkt_set_data(pkt, &tcp_access);
 }
 
+#if defined(CONFIG_NET_TCP_GSO)
+/* Largest IP header with options plus the largest TCP header */
+#define TCP_GSO_HDR_MAX_LEN 120
+
+int net_tcp_gso_send(struct net_if *iface, struct net_pkt *pkt,
+		     int (*send)(struct net_if *iface, struct net_pkt *pkt))
+{
+	size_t ip_len = net_pkt_ip_hdr_len(pkt) + net_pkt_ip_opts_len(pkt);
+	uint16_t seg_size = net_pkt_gso_size(pkt);
+	uint8_t hdr[TCP_GSO_HDR_MAX_LEN];
+	struct net_tcp_hdr *tcp_hdr;
+	size_t hdr_len, data_len;
+	size_t offset = 0;
+	uint8_t flags;
+	uint32_t seq;
+	int sent = 0;
+	int ret;
+
+	if (ip_len + sizeof(struct net_tcp_hdr) > sizeof(hdr)) {
+		return -EINVAL;
+	}
+
+	/* Read the headers once, they are the template of every segment */
+	net_pkt_cursor_init(pkt);
+	net_pkt_set_overwrite(pkt, true);
+
+	if (net_pkt_read(pkt, hdr, ip_len + sizeof(struct net_tcp_hdr))) {
+		return -ENOBUFS;
+	}
+
+	tcp_hdr = (struct net_tcp_hdr *)&hdr[ip_len];
+	hdr_len = ip_len + (tcp_hdr->offset >> 4) * 4U;
+	if (hdr_len > sizeof(hdr) || hdr_len > net_pkt_get_len(pkt)) {
+		return -EINVAL;
+	}
+
+	if (net_pkt_read(pkt, &hdr[ip_len + sizeof(struct net_tcp_hdr)],
+			 hdr_len - ip_len - sizeof(struct net_tcp_hdr))) {
+		return -ENOBUFS;
+	}
+
+	/* The header checksum is computed over this field too */
+	if (IS_ENABLED(CONFIG_NET_IPV4) && net_pkt_family(pkt) == AF_INET) {
+		((struct net_ipv4_hdr *)hdr)->chksum = 0U;
+	}
+
+	data_len = net_pkt_get_len(pkt) - hdr_len;
+	seq = sys_get_be32(tcp_hdr->seq);
+	flags = tcp_hdr->flags;
+
+	while (offset < data_len) {
+		size_t len = MIN(seg_size, data_len - offset);
+		struct net_pkt *seg;
+
+		seg = tcp_pkt_alloc_no_conn(net_pkt_iface(pkt),
+					    net_pkt_family(pkt), hdr_len + len);
+		if (seg == NULL) {
+			ret = -ENOBUFS;
+			goto out;
+		}
+
+		/* Only the last segment keeps the PSH and FIN flags */
+		sys_put_be32(seq + offset, tcp_hdr->seq);
+		if (offset + len < data_len) {
+			tcp_hdr->flags = flags & ~(PSH | FIN);
+		} else {
+			tcp_hdr->flags = flags;
+		}
+
+		if (net_pkt_write(seg, hdr, hdr_len) ||
+		    net_pkt_copy(seg, pkt, len)) {
+			tcp_pkt_unref(seg);
+			ret = -ENOBUFS;
+			goto out;
+		}
+
+		memcpy(net_pkt_lladdr_src(seg), net_pkt_lladdr_src(pkt),
+		       sizeof(struct net_linkaddr));
+		memcpy(net_pkt_lladdr_dst(seg), net_pkt_lladdr_dst(pkt),
+		       sizeof(struct net_linkaddr));
+		net_pkt_set_ip_hdr_len(seg, net_pkt_ip_hdr_len(pkt));
+		net_pkt_set_priority(seg, net_pkt_priority(pkt));
+		net_pkt_set_vlan_tag(seg, net_pkt_vlan_tag(pkt));
+
+		if (IS_ENABLED(CONFIG_NET_IPV4) && net_pkt_family(pkt) == AF_INET) {
+			net_pkt_set_ipv4_opts_len(seg, net_pkt_ipv4_opts_len(pkt));
+		} else if (IS_ENABLED(CONFIG_NET_IPV6)) {
+			net_pkt_set_ipv6_ext_len(seg, net_pkt_ipv6_ext_len(pkt));
+			net_pkt_set_ipv6_next_hdr(seg, net_pkt_ipv6_next_hdr(pkt));
+		}
+
+		ret = tcp_finalize_pkt(seg);
+		if (ret < 0) {
+			tcp_pkt_unref(seg);
+			goto out;
+		}
+
+		net_pkt_cursor_init(seg);
+
+		ret = send(iface, seg);
+		if (ret < 0) {
+			tcp_pkt_unref(seg);
+			goto out;
+		}
+
+		sent += ret;
+		offset += len;
+	}
+
+	/* Like a driver would do after sending the packet */
+	tcp_pkt_unref(pkt);
+	ret = sent;
+out:
+	return ret;
+}
+#endif /* CONFIG_NET_TCP_GSO */
+
 struct net_tcp_hdr *net_tcp_input(struct net_pkt *pkt,
 				  struct net_pkt_data_access *tcp_access)
 {
@@ -4108,7 +4494,7 @@ struct net_tcp_hdr *net_tcp_input(struct net_pkt *pkt,
 	enum net_if_checksum_type type = net_pkt_family(pkt) == AF_INET6 ?
 		NET_IF_CHECKSUM_IPV6_TCP : NET_IF_CHECKSUM_IPV4_TCP;
 
-	if (IS_ENABLED(CONFIG_NET_TCP_CHECKSUM) &&
+	if (IS_ENABLED(CONFIG_NET_TCP_CHECKSUM) && !net_pkt_is_tcp_gro(pkt) &&
 	    (net_if_need_calc_rx_checksum(net_pkt_iface(pkt), type) ||
 	     net_pkt_is_ip_reassembled(pkt)) &&
 	    net_calc_chksum_tcp(pkt) != 0U) {
@@ -0,0 +1,455 @@
+/** @file
+ * @brief TCP generic receive offload
+ *
+ * Consecutive segments of a TCP connection received in a burst are
+ * coalesced into one packet before the IP and TCP input processing.
+ */
+
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(net_tcp, CONFIG_NET_TCP_LOG_LEVEL);
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/byteorder.h>
+#include <zephyr/net/net_core.h>
+#include <zephyr/net/net_if.h>
+#include <zephyr/net/net_pkt.h>
+
+#include "net_private.h"
+#include "ipv4.h"
+#include "tcp_internal.h"
+
+/* Segments of one connection being coalesced */
+struct tcp_gro_flow {
+	/* First segment, the data of the others is appended to it */
+	struct net_pkt *pkt;
+	/* Sequence number the next segment has to start with */
+	uint32_t next_seq;
+	/* Length of the coalesced IP packet */
+	uint32_t total_len;
+	/* Length of the IP header */
+	uint16_t ip_len;
+	/* Number of coalesced segments */
+	uint8_t segs;
+};
+
+struct tcp_gro_ctx {
+	struct tcp_gro_flow flows[CONFIG_NET_TCP_GRO_MAX_FLOWS];
+	/* Flow to make room in when all of them are in use */
+	uint8_t evict;
+};
+
+/* One context per RX traffic class thread, so no locking is needed */
+static struct tcp_gro_ctx gro_ctx[NET_TC_RX_COUNT];
+
+/* Header information of a received segment */
+struct tcp_gro_seg {
+	struct net_tcp_hdr *tcp_hdr;
+	uint32_t total_len;
+	uint16_t ip_len;
+	uint16_t hdr_len;
+	bool mergeable;
+};
+
+enum tcp_gro_type {
+	TCP_GRO_OTHER,   /* Not a TCP packet */
+	TCP_GRO_UNKNOWN, /* Cannot tell, might be a TCP packet */
+	TCP_GRO_SEGMENT, /* TCP segment */
+};
+
+static bool tcp_gro_is_ipv4(struct net_pkt *pkt)
+{
+	return IS_ENABLED(CONFIG_NET_IPV4) &&
+	       (pkt->buffer->data[0] & 0xf0) == 0x40;
+}
+
+static uint16_t tcp_gro_chksum_ipv4(struct net_pkt *pkt)
+{
+#if defined(CONFIG_NET_IPV4)
+	return net_calc_chksum_ipv4(pkt);
+#else
+	ARG_UNUSED(pkt);
+
+	return 0U;
+#endif
+}
+
+static enum tcp_gro_type tcp_gro_parse(struct net_pkt *pkt,
+				       struct tcp_gro_seg *seg)
+{
+	struct net_buf *buf = pkt->buffer;
+	uint16_t tcp_len;
+
+	if (buf->len > 0 && tcp_gro_is_ipv4(pkt)) {
+		struct net_ipv4_hdr *hdr = (struct net_ipv4_hdr *)buf->data;
+
+		if (buf->len < sizeof(struct net_ipv4_hdr)) {
+			return TCP_GRO_UNKNOWN;
+		}
+
+		if (hdr->proto != IPPROTO_TCP) {
+			return TCP_GRO_OTHER;
+		}
+
+		/* Fragments are reassembled by the IP layer first */
+		if (sys_get_be16(hdr->offset) &
+		    (NET_IPV4_MORE_FRAG_MASK | NET_IPV4_FRAGH_OFFSET_MASK)) {
+			return TCP_GRO_UNKNOWN;
+		}
+
+		seg->ip_len = (hdr->vhl & NET_IPV4_IHL_MASK) * 4U;
+		seg->total_len = ntohs(hdr->len);
+	} else if (IS_ENABLED(CONFIG_NET_IPV6) && buf->len > 0) {
+		struct net_ipv6_hdr *hdr = (struct net_ipv6_hdr *)buf->data;
+
+		if (buf->len < sizeof(struct net_ipv6_hdr) ||
+		    (hdr->vtc & 0xf0) != 0x60) {
+			return TCP_GRO_UNKNOWN;
+		}
+
+		if (hdr->nexthdr == IPPROTO_UDP ||
+		    hdr->nexthdr == IPPROTO_ICMPV6) {
+			return TCP_GRO_OTHER;
+		}
+
+		/* Extension headers are left to the IP layer */
+		if (hdr->nexthdr != IPPROTO_TCP) {
+			return TCP_GRO_UNKNOWN;
+		}
+
+		seg->ip_len = sizeof(struct net_ipv6_hdr);
+		seg->total_len = ntohs(hdr->len) + sizeof(struct net_ipv6_hdr);
+	} else {
+		return TCP_GRO_UNKNOWN;
+	}
+
+	/* Only segments with all the headers in the first buffer are
+	 * looked into.
+	 */
+	if (buf->len < seg->ip_len + sizeof(struct net_tcp_hdr)) {
+		return TCP_GRO_UNKNOWN;
+	}
+
+	seg->tcp_hdr = (struct net_tcp_hdr *)(buf->data + seg->ip_len);
+	tcp_len = (seg->tcp_hdr->offset >> 4) * 4U;
+	seg->hdr_len = seg->ip_len + tcp_len;
+
+	if (tcp_len < sizeof(struct net_tcp_hdr) || buf->len < seg->hdr_len ||
+	    seg->total_len < seg->hdr_len ||
+	    seg->total_len > net_pkt_get_len(pkt)) {
+		return TCP_GRO_UNKNOWN;
+	}
+
+	/* Plain data segments without IPv4 options */
+	seg->mergeable = seg->total_len > seg->hdr_len &&
+			 (seg->tcp_hdr->flags & ~PSH) == ACK &&
+			 (!tcp_gro_is_ipv4(pkt) ||
+			  seg->ip_len == sizeof(struct net_ipv4_hdr));
+
+	return TCP_GRO_SEGMENT;
+}
+
+/* Only segments for this host are coalesced. A forwarded or routed packet
+ * would leave with the size of the coalesced packet, not the one it was
+ * sent with.
+ */
+static bool tcp_gro_is_local(struct net_pkt *pkt)
+{
+	uint8_t *data = pkt->buffer->data;
+
+	if (net_pkt_forwarding(pkt)) {
+		return false;
+	}
+
+	if (tcp_gro_is_ipv4(pkt)) {
+#if defined(CONFIG_NET_IPV4)
+		return net_if_ipv4_addr_lookup(
+			(struct in_addr *)((struct net_ipv4_hdr *)data)->dst,
+			NULL) != NULL;
+#endif
+	} else {
+#if defined(CONFIG_NET_IPV6)
+		return net_if_ipv6_addr_lookup_by_iface(
+			net_pkt_iface(pkt),
+			(struct in6_addr *)((struct net_ipv6_hdr *)data)->dst) != NULL;
+#endif
+	}
+
+	return false;
+}
+
+static bool tcp_gro_same_flow(struct tcp_gro_flow *flow, struct net_pkt *pkt,
+			      struct tcp_gro_seg *seg)
+{
+	uint8_t *a = flow->pkt->buffer->data;
+	uint8_t *b = pkt->buffer->data;
+
+	if (net_pkt_iface(flow->pkt) != net_pkt_iface(pkt) ||
+	    flow->ip_len != seg->ip_len || (a[0] & 0xf0) != (b[0] & 0xf0)) {
+		return false;
+	}
+
+	/* Addresses, then ports */
+	if (tcp_gro_is_ipv4(pkt)) {
+		if (memcmp(a + offsetof(struct net_ipv4_hdr, src),
+			   b + offsetof(struct net_ipv4_hdr, src),
+			   2 * NET_IPV4_ADDR_SIZE) != 0) {
+			return false;
+		}
+	} else if (memcmp(a + offsetof(struct net_ipv6_hdr, src),
+			  b + offsetof(struct net_ipv6_hdr, src),
+			  2 * NET_IPV6_ADDR_SIZE) != 0) {
+		return false;
+	}
+
+	return memcmp(a + flow->ip_len, b + seg->ip_len,
+		      2 * sizeof(uint16_t)) == 0;
+}
+
+static bool tcp_gro_can_merge(struct tcp_gro_flow *flow, struct net_pkt *pkt,
+			      struct tcp_gro_seg *seg)
+{
+	uint8_t *a = flow->pkt->buffer->data;
+	uint8_t *b = pkt->buffer->data;
+	struct net_tcp_hdr *tcp_hdr = (struct net_tcp_hdr *)(a + flow->ip_len);
+	uint16_t hdr_len = flow->ip_len + (tcp_hdr->offset >> 4) * 4U;
+
+	if (flow->segs >= CONFIG_NET_TCP_GRO_MAX_SEGS ||
+	    flow->total_len + seg->total_len - seg->hdr_len > UINT16_MAX ||
+	    sys_get_be32(seg->tcp_hdr->seq) != flow->next_seq ||
+	    memcmp(tcp_hdr->ack, seg->tcp_hdr->ack, sizeof(tcp_hdr->ack)) != 0) {
+		return false;
+	}
+
+	/* Same TCP options, and same traffic class */
+	if (hdr_len != seg->hdr_len ||
+	    memcmp(a + flow->ip_len + sizeof(struct net_tcp_hdr),
+		   b + seg->ip_len + sizeof(struct net_tcp_hdr),
+		   hdr_len - flow->ip_len - sizeof(struct net_tcp_hdr)) != 0) {
+		return false;
+	}
+
+	if (tcp_gro_is_ipv4(pkt)) {
+		return ((struct net_ipv4_hdr *)a)->tos ==
+		       ((struct net_ipv4_hdr *)b)->tos;
+	}
+
+	return memcmp(a, b, offsetof(struct net_ipv6_hdr, len)) == 0;
+}
+
+static bool tcp_gro_chksum_ok(struct net_pkt *pkt, struct tcp_gro_seg *seg)
+{
+	struct net_if *iface = net_pkt_iface(pkt);
+	enum net_if_checksum_type type;
+
+	/* Set up what the checksum calculation needs, the IP layer sets
+	 * the same values again.
+	 */
+	net_pkt_set_ip_hdr_len(pkt, seg->ip_len);
+
+	if (tcp_gro_is_ipv4(pkt)) {
+		net_pkt_set_family(pkt, AF_INET);
+		net_pkt_set_ipv4_opts_len(pkt, 0);
+		type = NET_IF_CHECKSUM_IPV4_TCP;
+
+		if (net_if_need_calc_rx_checksum(iface, NET_IF_CHECKSUM_IPV4_HEADER) &&
+		    tcp_gro_chksum_ipv4(pkt) != 0U) {
+			return false;
+		}
+	} else {
+		net_pkt_set_family(pkt, AF_INET6);
+		net_pkt_set_ipv6_ext_len(pkt, 0);
+		type = NET_IF_CHECKSUM_IPV6_TCP;
+	}
+
+	if (IS_ENABLED(CONFIG_NET_TCP_CHECKSUM) &&
+	    net_if_need_calc_rx_checksum(iface, type) &&
+	    net_calc_chksum_tcp(pkt) != 0U) {
+		return false;
+	}
+
+	net_pkt_set_tcp_gro(pkt, true);
+
+	return true;
+}
+
+static void tcp_gro_hold(struct tcp_gro_flow *flow, struct net_pkt *pkt,
+			 struct tcp_gro_seg *seg)
+{
+	flow->pkt = pkt;
+	flow->next_seq = sys_get_be32(seg->tcp_hdr->seq) +
+			 seg->total_len - seg->hdr_len;
+	flow->total_len = seg->total_len;
+	flow->ip_len = seg->ip_len;
+	flow->segs = 1U;
+}
+
+static void tcp_gro_merge(struct tcp_gro_flow *flow, struct net_pkt *pkt,
+			  struct tcp_gro_seg *seg)
+{
+	struct net_tcp_hdr *tcp_hdr =
+		(struct net_tcp_hdr *)(flow->pkt->buffer->data + flow->ip_len);
+	uint32_t len = seg->total_len - seg->hdr_len;
+
+	/* The coalesced packet carries the latest window and PSH */
+	memcpy(tcp_hdr->wnd, seg->tcp_hdr->wnd, sizeof(tcp_hdr->wnd));
+	tcp_hdr->flags |= seg->tcp_hdr->flags & PSH;
+
+	/* Only the data of the segment is kept */
+	net_buf_pull(pkt->buffer, seg->hdr_len);
+	if (pkt->buffer->len == 0U) {
+		pkt->buffer = net_buf_frag_del(NULL, pkt->buffer);
+	}
+
+	net_buf_frag_add(flow->pkt->buffer, pkt->buffer);
+	pkt->buffer = NULL;
+	net_pkt_unref(pkt);
+
+	flow->next_seq += len;
+	flow->total_len += len;
+	flow->segs++;
+}
+
+static void tcp_gro_flush_flow(struct tcp_gro_flow *flow)
+{
+	struct net_pkt *pkt = flow->pkt;
+	enum net_verdict verdict;
+
+	if (pkt == NULL) {
+		return;
+	}
+
+	flow->pkt = NULL;
+
+	if (flow->segs > 1U) {
+		if (tcp_gro_is_ipv4(pkt)) {
+			struct net_ipv4_hdr *hdr =
+				(struct net_ipv4_hdr *)pkt->buffer->data;
+
+			hdr->len = htons(flow->total_len);
+			hdr->chksum = 0U;
+			hdr->chksum = tcp_gro_chksum_ipv4(pkt);
+		} else {
+			struct net_ipv6_hdr *hdr =
+				(struct net_ipv6_hdr *)pkt->buffer->data;
+
+			hdr->len = htons(flow->total_len -
+					 sizeof(struct net_ipv6_hdr));
+		}
+	}
+
+	NET_DBG("pkt %p: %u segments, %u bytes", pkt, flow->segs,
+		flow->total_len);
+
+	net_pkt_cursor_init(pkt);
+
+	if (tcp_gro_is_ipv4(pkt)) {
+		verdict = net_ipv4_input(pkt, false);
+	} else {
+		verdict = net_ipv6_input(pkt, false);
+	}
+
+	if (verdict != NET_OK) {
+		net_pkt_unref(pkt);
+	}
+}
+
+static void tcp_gro_flush_all(struct tcp_gro_ctx *ctx)
+{
+	ARRAY_FOR_EACH_PTR(ctx->flows, flow) {
+		tcp_gro_flush_flow(flow);
+	}
+}
+
+enum net_verdict net_tcp_gro_receive(struct net_pkt *pkt)
+{
+	struct tcp_gro_flow *flow = NULL;
+	struct tcp_gro_flow *free_flow = NULL;
+	struct tcp_gro_seg seg;
+	struct tcp_gro_ctx *ctx;
+	int tc;
+
+	tc = net_tc_rx_current();
+	if (tc < 0) {
+		return NET_CONTINUE;
+	}
+
+	ctx = &gro_ctx[tc];
+
+	switch (tcp_gro_parse(pkt, &seg)) {
+	case TCP_GRO_OTHER:
+		return NET_CONTINUE;
+	case TCP_GRO_UNKNOWN:
+		/* Keep the order in case this belongs to a held flow */
+		tcp_gro_flush_all(ctx);
+		return NET_CONTINUE;
+	case TCP_GRO_SEGMENT:
+		break;
+	}
+
+	ARRAY_FOR_EACH_PTR(ctx->flows, iter) {
+		if (iter->pkt == NULL) {
+			free_flow = iter;
+		} else if (tcp_gro_same_flow(iter, pkt, &seg)) {
+			flow = iter;
+			break;
+		}
+	}
+
+	if (!seg.mergeable) {
+		if (flow != NULL) {
+			tcp_gro_flush_flow(flow);
+		}
+
+		return NET_CONTINUE;
+	}
+
+	/* A held flow has already been checked, its segments all have the
+	 * same destination.
+	 */
+	if (flow == NULL && !tcp_gro_is_local(pkt)) {
+		return NET_CONTINUE;
+	}
+
+	/* The padding of short frames would end up in the middle of the
+	 * coalesced data.
+	 */
+	if (net_pkt_get_len(pkt) > seg.total_len) {
+		net_pkt_update_length(pkt, seg.total_len);
+	}
+
+	/* Let the TCP layer drop a corrupted segment */
+	if (!tcp_gro_chksum_ok(pkt, &seg)) {
+		return NET_CONTINUE;
+	}
+
+	if (flow != NULL) {
+		if (tcp_gro_can_merge(flow, pkt, &seg)) {
+			tcp_gro_merge(flow, pkt, &seg);
+			return NET_OK;
+		}
+
+		tcp_gro_flush_flow(flow);
+		free_flow = flow;
+	}
+
+	if (free_flow == NULL) {
+		free_flow = &ctx->flows[ctx->evict];
+		ctx->evict = (ctx->evict + 1U) % ARRAY_SIZE(ctx->flows);
+		tcp_gro_flush_flow(free_flow);
+	}
+
+	tcp_gro_hold(free_flow, pkt, &seg);
+
+	return NET_OK;
+}
+
+void net_tcp_gro_flush(int tc)
+{
+	tcp_gro_flush_all(&gro_ctx[tc]);
+}
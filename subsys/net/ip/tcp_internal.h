@@ -263,6 +263,74 @@ static inline int net_tcp_finalize(struct net_pkt *pkt, bool force_chksum)
 }
 #endif
 
+/**
+ * @brief Split a TCP GSO packet into segments and send them
+ *
+ * @details The packet is split into segments of net_pkt_gso_size() bytes,
+ * which are finalized and passed to @p send one by one. The packet is
+ * released if all the segments were sent.
+ *
+ * @param iface Network interface the segments are sent to
+ * @param pkt TCP packet with a non-zero GSO size
+ * @param send L2 send function
+ *
+ * @return Number of bytes sent, negative errno otherwise.
+ */
+#if defined(CONFIG_NET_TCP_GSO)
+int net_tcp_gso_send(struct net_if *iface, struct net_pkt *pkt,
+		     int (*send)(struct net_if *iface, struct net_pkt *pkt));
+#else
+static inline int net_tcp_gso_send(struct net_if *iface, struct net_pkt *pkt,
+				   int (*send)(struct net_if *iface,
+					       struct net_pkt *pkt))
+{
+	ARG_UNUSED(iface);
+	ARG_UNUSED(pkt);
+	ARG_UNUSED(send);
+
+	return -ENOTSUP;
+}
+#endif
+
+/**
+ * @brief Coalesce a received TCP segment with the held segments of its
+ * connection.
+ *
+ * Called by the RX traffic class thread after L2 processing. Only segments
+ * addressed to this host are held. Held segments are passed to the IP layer
+ * when they cannot be coalesced further, or when net_tcp_gro_flush() is
+ * called at the end of an RX batch.
+ *
+ * @param pkt Network packet, the IP header at the start of the first buffer
+ *
+ * @return NET_OK if the packet was held or coalesced, NET_CONTINUE if it
+ * should be passed to the IP layer as is.
+ */
+#if defined(CONFIG_NET_TCP_GRO)
+enum net_verdict net_tcp_gro_receive(struct net_pkt *pkt);
+#else
+static inline enum net_verdict net_tcp_gro_receive(struct net_pkt *pkt)
+{
+	ARG_UNUSED(pkt);
+
+	return NET_CONTINUE;
+}
+#endif
+
+/**
+ * @brief Pass all the held segments of an RX traffic class to the IP layer.
+ *
+ * @param tc RX traffic class
+ */
+#if defined(CONFIG_NET_TCP_GRO)
+void net_tcp_gro_flush(int tc);
+#else
+static inline void net_tcp_gro_flush(int tc)
+{
+	ARG_UNUSED(tc);
+}
+#endif
+
 /**
  * @brief Get pointer to TCP header in net_pkt
  *
@@ -312,6 +380,43 @@ static inline int net_tcp_queue(struct net_context *context, const void *data,
 }
 #endif
 
+/** Callback telling that the buffers given to net_tcp_queue_zc() are released */
+typedef void (*net_tcp_zc_cb_t)(void *user_data);
+
+/**
+ * @brief Enqueue application owned buffers for transmission without copying
+ *
+ * @details The iovecs of @p msg are attached to the send queue as they are.
+ * They must stay valid and unmodified until @p cb is called, which happens
+ * once all of their data queued by this call has been acknowledged and is no
+ * longer referenced by any segment, or when the connection is released.
+ * @p cb is called once if some data was queued, and never if 0 or an error
+ * is returned.
+ *
+ * @param context	Network context
+ * @param msg		Data to queue
+ * @param cb		Release callback, called from the network stack
+ * @param user_data	User data passed to @p cb
+ *
+ * @return Number of bytes queued if ok, < 0 if error
+ */
+#if defined(CONFIG_NET_TCP_ZEROCOPY_TX)
+int net_tcp_queue_zc(struct net_context *context, const struct msghdr *msg,
+		     net_tcp_zc_cb_t cb, void *user_data);
+#else
+static inline int net_tcp_queue_zc(struct net_context *context,
+				   const struct msghdr *msg,
+				   net_tcp_zc_cb_t cb, void *user_data)
+{
+	ARG_UNUSED(context);
+	ARG_UNUSED(msg);
+	ARG_UNUSED(cb);
+	ARG_UNUSED(user_data);
+
+	return -EPROTONOSUPPORT;
+}
+#endif
+
 /**
  * @brief Update TCP receive window
  *
@@ -0,0 +1,732 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(net_sock_epoll, CONFIG_NET_SOCKETS_LOG_LEVEL);
+
+#include <zephyr/kernel.h>
+#include <zephyr/net/net_context.h>
+#include <zephyr/net/socket.h>
+#include <zephyr/net/socket_epoll.h>
+#include <zephyr/sys/bitarray.h>
+#include <zephyr/sys/dlist.h>
+#include <zephyr/sys/fdtable.h>
+
+#include "sockets_internal.h"
+
+extern const struct socket_op_vtable sock_fd_op_vtable;
+
+#define EPOLL_EVENTS (ZSOCK_EPOLLIN | ZSOCK_EPOLLPRI | ZSOCK_EPOLLOUT | \
+		      ZSOCK_EPOLLERR | ZSOCK_EPOLLHUP)
+
+#define EPOLL_POLLED_MAX CONFIG_NET_SOCKETS_EPOLL_POLLED_MAX
+
+/* The epoll instance itself takes one zsock_poll() entry while waiting */
+BUILD_ASSERT(EPOLL_POLLED_MAX < CONFIG_ZVFS_POLL_MAX,
+	     "CONFIG_NET_SOCKETS_EPOLL_POLLED_MAX must be less than CONFIG_ZVFS_POLL_MAX");
+
+/*
+ * An entry is either watched or polled. Watched entries are native sockets
+ * which put themselves on the ready list of the instance from the network
+ * stack callbacks. Polled entries are every other file descriptor, they
+ * are handed to zsock_poll() on each wait.
+ *
+ * All list linkage is protected by epoll_lock, as the network stack
+ * notifies and closes sockets without taking the instance mutex. The
+ * instance mutex serializes everything that may free an entry.
+ */
+struct epoll_entry {
+	/* In the watched or polled list of the instance */
+	sys_dnode_t node;
+	/* In the ready list of the instance while the fd may be ready */
+	sys_dnode_t ready_node;
+	/* In the watch list of the socket, for watched entries */
+	sys_snode_t watch_node;
+	struct zsock_epoll *ep;
+	/* Socket reporting its readiness, NULL for polled entries */
+	struct net_context *ctx;
+	/* Object behind fd, NULL once a watched socket has been closed */
+	void *obj;
+	int fd;
+	uint32_t events;
+	union zsock_epoll_data data;
+};
+
+struct zsock_epoll {
+	struct k_mutex lock;
+	/* Raised when an entry is put on the ready list */
+	struct k_poll_signal signal;
+	sys_dlist_t watched;
+	sys_dlist_t polled;
+	sys_dlist_t ready;
+	/* Entries of watched sockets closed behind our back */
+	sys_dlist_t closed;
+	int num_polled;
+};
+
+static struct k_spinlock epoll_lock;
+
+SYS_BITARRAY_DEFINE_STATIC(epoll_bitarray, CONFIG_NET_SOCKETS_EPOLL_MAX);
+static struct zsock_epoll epolls[CONFIG_NET_SOCKETS_EPOLL_MAX];
+
+K_MEM_SLAB_DEFINE_STATIC(epoll_entry_slab, sizeof(struct epoll_entry),
+			 CONFIG_NET_SOCKETS_EPOLL_ENTRIES, sizeof(void *));
+
+static const struct fd_op_vtable epoll_fd_op_vtable;
+
+/* Must be called with epoll_lock held */
+static void epoll_mark_ready(struct epoll_entry *entry)
+{
+	if (!sys_dnode_is_linked(&entry->ready_node)) {
+		sys_dlist_append(&entry->ep->ready, &entry->ready_node);
+	}
+
+	k_poll_signal_raise(&entry->ep->signal, 0);
+}
+
+void zsock_epoll_notify(struct net_context *ctx)
+{
+	struct epoll_entry *entry;
+	k_spinlock_key_t key;
+
+	key = k_spin_lock(&epoll_lock);
+
+	SYS_SLIST_FOR_EACH_CONTAINER(&ctx->epoll_watch, entry, watch_node) {
+		epoll_mark_ready(entry);
+	}
+
+	k_spin_unlock(&epoll_lock, key);
+}
+
+void zsock_epoll_forget(struct net_context *ctx)
+{
+	struct epoll_entry *entry;
+	k_spinlock_key_t key;
+	sys_snode_t *node;
+
+	key = k_spin_lock(&epoll_lock);
+
+	while ((node = sys_slist_get(&ctx->epoll_watch)) != NULL) {
+		entry = CONTAINER_OF(node, struct epoll_entry, watch_node);
+
+		if (sys_dnode_is_linked(&entry->ready_node)) {
+			sys_dlist_remove(&entry->ready_node);
+		}
+
+		/* The instance mutex may be held by a waiter, so the entry
+		 * is only parked here and freed by the instance later on.
+		 */
+		sys_dlist_remove(&entry->node);
+		sys_dlist_append(&entry->ep->closed, &entry->node);
+		entry->ctx = NULL;
+		entry->obj = NULL;
+	}
+
+	k_spin_unlock(&epoll_lock, key);
+}
+
+/* Must be called with the instance mutex held */
+static void epoll_reclaim(struct zsock_epoll *ep)
+{
+	k_spinlock_key_t key;
+	sys_dnode_t *node;
+
+	key = k_spin_lock(&epoll_lock);
+
+	while ((node = sys_dlist_get(&ep->closed)) != NULL) {
+		k_spin_unlock(&epoll_lock, key);
+		k_mem_slab_free(&epoll_entry_slab, CONTAINER_OF(node, struct epoll_entry, node));
+		key = k_spin_lock(&epoll_lock);
+	}
+
+	k_spin_unlock(&epoll_lock, key);
+}
+
+/* Must be called with the instance mutex held */
+static void epoll_attach(struct zsock_epoll *ep, struct epoll_entry *entry)
+{
+	k_spinlock_key_t key;
+
+	key = k_spin_lock(&epoll_lock);
+
+	if (entry->ctx != NULL) {
+		sys_slist_append(&entry->ctx->epoll_watch, &entry->watch_node);
+		sys_dlist_append(&ep->watched, &entry->node);
+
+		/* Report whatever the socket has queued already */
+		epoll_mark_ready(entry);
+	} else {
+		sys_dlist_append(&ep->polled, &entry->node);
+		ep->num_polled++;
+	}
+
+	k_spin_unlock(&epoll_lock, key);
+}
+
+/* Must be called with the instance mutex held. Returns false if the
+ * socket was closed meanwhile, in which case epoll_reclaim() frees the
+ * entry.
+ */
+static bool epoll_detach(struct epoll_entry *entry)
+{
+	k_spinlock_key_t key;
+
+	key = k_spin_lock(&epoll_lock);
+
+	if (entry->obj == NULL) {
+		k_spin_unlock(&epoll_lock, key);
+		return false;
+	}
+
+	if (entry->ctx != NULL) {
+		(void)sys_slist_find_and_remove(&entry->ctx->epoll_watch, &entry->watch_node);
+	} else {
+		entry->ep->num_polled--;
+	}
+
+	if (sys_dnode_is_linked(&entry->ready_node)) {
+		sys_dlist_remove(&entry->ready_node);
+	}
+
+	sys_dlist_remove(&entry->node);
+
+	k_spin_unlock(&epoll_lock, key);
+
+	return true;
+}
+
+static void epoll_detach_all(struct zsock_epoll *ep, sys_dlist_t *list)
+{
+	struct epoll_entry *entry;
+	k_spinlock_key_t key;
+	sys_dnode_t *node;
+
+	while (true) {
+		key = k_spin_lock(&epoll_lock);
+		node = sys_dlist_peek_head(list);
+		k_spin_unlock(&epoll_lock, key);
+
+		if (node == NULL) {
+			break;
+		}
+
+		entry = CONTAINER_OF(node, struct epoll_entry, node);
+		if (epoll_detach(entry)) {
+			k_mem_slab_free(&epoll_entry_slab, entry);
+		}
+	}
+
+	epoll_reclaim(ep);
+}
+
+/* Must be called with the instance mutex held */
+static struct epoll_entry *epoll_find(struct zsock_epoll *ep, int fd, void *obj,
+				      struct net_context *ctx)
+{
+	struct epoll_entry *entry;
+	k_spinlock_key_t key;
+
+	if (ctx != NULL) {
+		key = k_spin_lock(&epoll_lock);
+
+		SYS_SLIST_FOR_EACH_CONTAINER(&ctx->epoll_watch, entry, watch_node) {
+			if (entry->ep == ep) {
+				k_spin_unlock(&epoll_lock, key);
+				return entry;
+			}
+		}
+
+		k_spin_unlock(&epoll_lock, key);
+	}
+
+	SYS_DLIST_FOR_EACH_CONTAINER(&ep->polled, entry, node) {
+		if (entry->fd == fd && entry->obj == obj) {
+			return entry;
+		}
+	}
+
+	return NULL;
+}
+
+/* Must be called with the instance mutex held */
+static int epoll_add(struct zsock_epoll *ep, int fd, void *obj, struct net_context *ctx,
+		     const struct zsock_epoll_event *event)
+{
+	struct epoll_entry *entry;
+
+	/* TCP writability depends on the send window, which does not notify
+	 * the socket layer, so such entries are polled.
+	 */
+	if (ctx != NULL && (event->events & ZSOCK_EPOLLOUT) != 0 &&
+	    net_context_get_type(ctx) == SOCK_STREAM) {
+		ctx = NULL;
+	}
+
+	if (ctx == NULL && ep->num_polled >= EPOLL_POLLED_MAX) {
+		NET_DBG("No room for polled fd %d (max %d)", fd, EPOLL_POLLED_MAX);
+		return -ENOSPC;
+	}
+
+	if (k_mem_slab_alloc(&epoll_entry_slab, (void **)&entry, K_NO_WAIT) < 0) {
+		return -ENOMEM;
+	}
+
+	*entry = (struct epoll_entry) {
+		.ep = ep,
+		.ctx = ctx,
+		.obj = obj,
+		.fd = fd,
+		.events = event->events,
+		.data = event->data,
+	};
+
+	sys_dnode_init(&entry->node);
+	sys_dnode_init(&entry->ready_node);
+
+	epoll_attach(ep, entry);
+
+	return 0;
+}
+
+/* Checks the entries of the ready list and reports those which are still
+ * ready. Reported entries stay on the ready list, so they are checked
+ * again on the next wait. Must be called with the instance mutex held.
+ */
+static int epoll_scan_ready(struct zsock_epoll *ep, struct zsock_epoll_event *events,
+			    int maxevents)
+{
+	struct zsock_pollfd pfd;
+	struct epoll_entry *entry;
+	k_spinlock_key_t key;
+	sys_dlist_t pending;
+	sys_dnode_t *node;
+	int n = 0;
+
+	sys_dlist_init(&pending);
+
+	key = k_spin_lock(&epoll_lock);
+
+	k_poll_signal_reset(&ep->signal);
+
+	while ((node = sys_dlist_get(&ep->ready)) != NULL) {
+		sys_dlist_append(&pending, node);
+	}
+
+	while (n < maxevents) {
+		node = sys_dlist_get(&pending);
+		if (node == NULL) {
+			break;
+		}
+
+		entry = CONTAINER_OF(node, struct epoll_entry, ready_node);
+
+		pfd.fd = entry->fd;
+		pfd.events = entry->events;
+		pfd.revents = 0;
+
+		k_spin_unlock(&epoll_lock, key);
+
+		(void)zsock_poll(&pfd, 1, 0);
+
+		key = k_spin_lock(&epoll_lock);
+
+		/* Socket closed meanwhile */
+		if (entry->obj == NULL) {
+			continue;
+		}
+
+		if ((pfd.revents & ~ZSOCK_POLLNVAL) == 0) {
+			continue;
+		}
+
+		events[n].events = pfd.revents;
+		events[n].data = entry->data;
+		n++;
+
+		if (!sys_dnode_is_linked(&entry->ready_node)) {
+			sys_dlist_append(&ep->ready, &entry->ready_node);
+		}
+	}
+
+	/* Out of room, the unchecked entries go first on the next wait */
+	while ((node = sys_dlist_peek_tail(&pending)) != NULL) {
+		sys_dlist_remove(node);
+		sys_dlist_prepend(&ep->ready, node);
+	}
+
+	k_spin_unlock(&epoll_lock, key);
+
+	return n;
+}
+
+/* Fills pfds[1..] with the polled entries, pfds[0] is left for the
+ * instance itself. Must be called with the instance mutex held.
+ */
+static int epoll_prepare_polled(struct zsock_epoll *ep, struct zsock_pollfd *pfds,
+				union zsock_epoll_data *data)
+{
+	const struct fd_op_vtable *vtable;
+	struct epoll_entry *entry;
+	struct epoll_entry *next;
+	int npfds = 1;
+
+	SYS_DLIST_FOR_EACH_CONTAINER_SAFE(&ep->polled, entry, next, node) {
+		/* Drop entries whose fd was closed without removing it */
+		if (zvfs_get_fd_obj_and_vtable(entry->fd, &vtable, NULL) != entry->obj) {
+			NET_DBG("Dropping stale fd %d", entry->fd);
+
+			if (epoll_detach(entry)) {
+				k_mem_slab_free(&epoll_entry_slab, entry);
+			}
+
+			continue;
+		}
+
+		pfds[npfds].fd = entry->fd;
+		pfds[npfds].events = entry->events;
+		pfds[npfds].revents = 0;
+		data[npfds] = entry->data;
+		npfds++;
+	}
+
+	return npfds;
+}
+
+static int epoll_poll_prepare(struct zsock_epoll *ep, struct zsock_pollfd *pfd,
+			      struct k_poll_event **pev, struct k_poll_event *pev_end)
+{
+	k_spinlock_key_t key;
+	bool ready;
+
+	if ((pfd->events & ZSOCK_POLLIN) == 0) {
+		return 0;
+	}
+
+	if (*pev == pev_end) {
+		return -ENOMEM;
+	}
+
+	(*pev)->obj = &ep->signal;
+	(*pev)->type = K_POLL_TYPE_SIGNAL;
+	(*pev)->mode = K_POLL_MODE_NOTIFY_ONLY;
+	(*pev)->state = K_POLL_STATE_NOT_READY;
+	(*pev)++;
+
+	key = k_spin_lock(&epoll_lock);
+	ready = !sys_dlist_is_empty(&ep->ready);
+	k_spin_unlock(&epoll_lock, key);
+
+	return ready ? -EALREADY : 0;
+}
+
+static int epoll_poll_update(struct zsock_epoll *ep, struct zsock_pollfd *pfd,
+			     struct k_poll_event **pev)
+{
+	k_spinlock_key_t key;
+
+	if ((pfd->events & ZSOCK_POLLIN) == 0) {
+		return 0;
+	}
+
+	key = k_spin_lock(&epoll_lock);
+
+	if ((*pev)->state != K_POLL_STATE_NOT_READY || !sys_dlist_is_empty(&ep->ready)) {
+		pfd->revents |= ZSOCK_POLLIN;
+	}
+
+	k_spin_unlock(&epoll_lock, key);
+
+	(*pev)++;
+
+	return 0;
+}
+
+static ssize_t epoll_read_vmeth(void *obj, void *buffer, size_t count)
+{
+	ARG_UNUSED(obj);
+	ARG_UNUSED(buffer);
+	ARG_UNUSED(count);
+
+	errno = EINVAL;
+	return -1;
+}
+
+static ssize_t epoll_write_vmeth(void *obj, const void *buffer, size_t count)
+{
+	ARG_UNUSED(obj);
+	ARG_UNUSED(buffer);
+	ARG_UNUSED(count);
+
+	errno = EINVAL;
+	return -1;
+}
+
+static int epoll_close_vmeth(void *obj)
+{
+	struct zsock_epoll *ep = obj;
+	int ret;
+
+	(void)k_mutex_lock(&ep->lock, K_FOREVER);
+
+	epoll_detach_all(ep, &ep->watched);
+	epoll_detach_all(ep, &ep->polled);
+
+	k_mutex_unlock(&ep->lock);
+
+	ret = sys_bitarray_free(&epoll_bitarray, 1, ep - epolls);
+	__ASSERT(ret == 0, "sys_bitarray_free() failed: %d", ret);
+
+	return 0;
+}
+
+static int epoll_ioctl_vmeth(void *obj, unsigned int request, va_list args)
+{
+	struct zsock_epoll *ep = obj;
+
+	switch (request) {
+	case ZFD_IOCTL_POLL_PREPARE: {
+		struct zsock_pollfd *pfd;
+		struct k_poll_event **pev;
+		struct k_poll_event *pev_end;
+
+		pfd = va_arg(args, struct zsock_pollfd *);
+		pev = va_arg(args, struct k_poll_event **);
+		pev_end = va_arg(args, struct k_poll_event *);
+
+		return epoll_poll_prepare(ep, pfd, pev, pev_end);
+	}
+
+	case ZFD_IOCTL_POLL_UPDATE: {
+		struct zsock_pollfd *pfd;
+		struct k_poll_event **pev;
+
+		pfd = va_arg(args, struct zsock_pollfd *);
+		pev = va_arg(args, struct k_poll_event **);
+
+		return epoll_poll_update(ep, pfd, pev);
+	}
+
+	default:
+		errno = EOPNOTSUPP;
+		return -1;
+	}
+}
+
+static const struct fd_op_vtable epoll_fd_op_vtable = {
+	.read = epoll_read_vmeth,
+	.write = epoll_write_vmeth,
+	.close = epoll_close_vmeth,
+	.ioctl = epoll_ioctl_vmeth,
+};
+
+int zsock_epoll_create(int flags)
+{
+	struct zsock_epoll *ep;
+	size_t offset;
+	int fd;
+
+	if (flags != 0) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	if (sys_bitarray_alloc(&epoll_bitarray, 1, &offset) < 0) {
+		errno = ENOMEM;
+		return -1;
+	}
+
+	fd = zvfs_reserve_fd();
+	if (fd < 0) {
+		(void)sys_bitarray_free(&epoll_bitarray, 1, offset);
+		return -1;
+	}
+
+	ep = &epolls[offset];
+
+	k_mutex_init(&ep->lock);
+	k_poll_signal_init(&ep->signal);
+	sys_dlist_init(&ep->watched);
+	sys_dlist_init(&ep->polled);
+	sys_dlist_init(&ep->ready);
+	sys_dlist_init(&ep->closed);
+	ep->num_polled = 0;
+
+	zvfs_finalize_fd(fd, ep, &epoll_fd_op_vtable);
+
+	NET_DBG("epoll: ep=%p, fd=%d", ep, fd);
+
+	return fd;
+}
+
+int zsock_epoll_ctl(int epfd, int op, int fd, struct zsock_epoll_event *event)
+{
+	const struct fd_op_vtable *vtable;
+	struct net_context *ctx = NULL;
+	struct epoll_entry *entry;
+	struct zsock_epoll *ep;
+	void *obj;
+	int ret;
+
+	ep = zvfs_get_fd_obj(epfd, &epoll_fd_op_vtable, EBADF);
+	if (ep == NULL) {
+		return -1;
+	}
+
+	obj = zvfs_get_fd_obj_and_vtable(fd, &vtable, NULL);
+	if (obj == NULL) {
+		return -1;
+	}
+
+	if (obj == ep) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	if (op != ZSOCK_EPOLL_CTL_DEL) {
+		if (event == NULL) {
+			errno = EFAULT;
+			return -1;
+		}
+
+		/* Only level-triggered notification is supported */
+		if ((event->events & ~EPOLL_EVENTS) != 0) {
+			errno = EINVAL;
+			return -1;
+		}
+	}
+
+	if (vtable == &sock_fd_op_vtable.fd_vtable) {
+		ctx = obj;
+	}
+
+	(void)k_mutex_lock(&ep->lock, K_FOREVER);
+
+	epoll_reclaim(ep);
+
+	entry = epoll_find(ep, fd, obj, ctx);
+
+	switch (op) {
+	case ZSOCK_EPOLL_CTL_ADD:
+		if (entry != NULL) {
+			ret = -EEXIST;
+			break;
+		}
+
+		ret = epoll_add(ep, fd, obj, ctx, event);
+		break;
+
+	case ZSOCK_EPOLL_CTL_MOD:
+		if (entry == NULL) {
+			ret = -ENOENT;
+			break;
+		}
+
+		/* The entry may move between the watched and polled lists */
+		if (epoll_detach(entry)) {
+			k_mem_slab_free(&epoll_entry_slab, entry);
+		}
+
+		ret = epoll_add(ep, fd, obj, ctx, event);
+		break;
+
+	case ZSOCK_EPOLL_CTL_DEL:
+		if (entry == NULL) {
+			ret = -ENOENT;
+			break;
+		}
+
+		if (epoll_detach(entry)) {
+			k_mem_slab_free(&epoll_entry_slab, entry);
+		}
+
+		ret = 0;
+		break;
+
+	default:
+		ret = -EINVAL;
+		break;
+	}
+
+	k_mutex_unlock(&ep->lock);
+
+	if (ret < 0) {
+		errno = -ret;
+		return -1;
+	}
+
+	return 0;
+}
+
+int zsock_epoll_wait(int epfd, struct zsock_epoll_event *events, int maxevents, int timeout)
+{
+	struct zsock_pollfd pfds[1 + EPOLL_POLLED_MAX];
+	union zsock_epoll_data data[1 + EPOLL_POLLED_MAX];
+	struct zsock_epoll *ep;
+	k_timepoint_t end;
+	int n;
+
+	ep = zvfs_get_fd_obj(epfd, &epoll_fd_op_vtable, EBADF);
+	if (ep == NULL) {
+		return -1;
+	}
+
+	if (events == NULL || maxevents <= 0) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	end = sys_timepoint_calc(timeout < 0 ? K_FOREVER : K_MSEC(timeout));
+
+	do {
+		k_timeout_t left;
+		int poll_timeout;
+		int npfds;
+		int ret;
+
+		(void)k_mutex_lock(&ep->lock, K_FOREVER);
+
+		epoll_reclaim(ep);
+		n = epoll_scan_ready(ep, events, maxevents);
+		npfds = epoll_prepare_polled(ep, pfds, data);
+
+		k_mutex_unlock(&ep->lock);
+
+		/* Sleep on the instance itself while nothing is ready, which
+		 * wakes up when a watched socket reports its readiness.
+		 */
+		pfds[0].fd = epfd;
+		pfds[0].events = ZSOCK_POLLIN;
+		pfds[0].revents = 0;
+
+		if (n > 0) {
+			poll_timeout = 0;
+		} else {
+			left = sys_timepoint_timeout(end);
+			if (K_TIMEOUT_EQ(left, K_FOREVER)) {
+				poll_timeout = SYS_FOREVER_MS;
+			} else {
+				poll_timeout = k_ticks_to_ms_ceil32(left.ticks);
+			}
+		}
+
+		ret = zsock_poll(pfds, npfds, poll_timeout);
+		if (ret < 0) {
+			return -1;
+		}
+
+		for (int i = 1; i < npfds && n < maxevents; i++) {
+			if ((pfds[i].revents & ~ZSOCK_POLLNVAL) == 0) {
+				continue;
+			}
+
+			events[n].events = pfds[i].revents;
+			events[n].data = data[i];
+			n++;
+		}
+	} while (n == 0 && !sys_timepoint_expired(end));
+
+	return n;
+}
@@ -80,6 +80,8 @@ static void zsock_flush_queue(struct net_context *ctx)
 
 	/* Wake reader if it was sleeping */
 	(void)k_condvar_signal(&ctx->cond.recv);
+
+	zsock_epoll_notify(ctx);
 }
 
 static int zsock_socket_internal(int family, int type, int proto)
@@ -123,6 +125,8 @@ static int zsock_socket_internal(int family, int type, int proto)
 	 */
 	k_condvar_init(&ctx->cond.recv);
 
+	zsock_epoll_init_ctx(ctx);
+
 	/* TCP context is effectively owned by both application
 	 * and the stack: stack may detect that peer closed/aborted
 	 * connection, but it must not dispose of the context behind
@@ -164,6 +168,9 @@ int zsock_close_ctx(struct net_context *ctx, int sock)
 	ctx->user_data = INT_TO_POINTER(EINTR);
 	sock_set_error(ctx);
 
+	/* Closing a socket removes it from all epoll interest sets */
+	zsock_epoll_forget(ctx);
+
 	zsock_flush_queue(ctx);
 
 	ret = net_context_put(ctx);
@@ -195,6 +202,7 @@ static void zsock_accepted_cb(struct net_context *new_ctx,
 				       NULL);
 		k_fifo_init(&new_ctx->recv_q);
 		k_condvar_init(&new_ctx->cond.recv);
+		zsock_epoll_init_ctx(new_ctx);
 
 		k_fifo_put(&parent->accept_q, new_ctx);
 
@@ -208,6 +216,8 @@ static void zsock_accepted_cb(struct net_context *new_ctx,
 		net_context_ref(new_ctx);
 
 		(void)k_condvar_signal(&parent->cond.recv);
+
+		zsock_epoll_notify(parent);
 	}
 
 }
@@ -262,6 +272,8 @@ unlock:
 	/* Wake reader if it was sleeping */
 	(void)k_condvar_signal(&ctx->cond.recv);
 
+	zsock_epoll_notify(ctx);
+
 	if (ctx->cond.lock) {
 		(void)k_mutex_unlock(ctx->cond.lock);
 	}
@@ -694,6 +706,89 @@ ssize_t zsock_sendmsg_ctx(struct net_context *ctx, const struct msghdr *msg,
 	return status;
 }
 
+#if defined(CONFIG_NET_SOCKETS_ZEROCOPY_TX)
+static ssize_t zsock_sendmsg_zc_ctx(struct net_context *ctx,
+				    const struct msghdr *msg, int flags,
+				    zsock_send_zc_cb_t cb, void *user_data)
+{
+	k_timeout_t timeout = K_FOREVER;
+	uint32_t retry_timeout = WAIT_BUFS_INITIAL_MS;
+	k_timepoint_t buf_timeout, end;
+	int status;
+
+	if (net_context_get_type(ctx) != SOCK_STREAM ||
+	    net_if_is_ip_offloaded(net_context_get_iface(ctx))) {
+		errno = EOPNOTSUPP;
+		return -1;
+	}
+
+	if ((flags & ZSOCK_MSG_DONTWAIT) || sock_is_nonblock(ctx)) {
+		timeout = K_NO_WAIT;
+		buf_timeout = sys_timepoint_calc(K_NO_WAIT);
+	} else {
+		net_context_get_option(ctx, NET_OPT_SNDTIMEO, &timeout, NULL);
+		buf_timeout = sys_timepoint_calc(MAX_WAIT_BUFS);
+	}
+	end = sys_timepoint_calc(timeout);
+
+	while (1) {
+		(void)k_mutex_lock(&ctx->lock, K_FOREVER);
+		status = net_tcp_queue_zc(ctx, msg, cb, user_data);
+		k_mutex_unlock(&ctx->lock);
+
+		if (status < 0) {
+			status = send_check_and_wait(ctx, status,
+						     buf_timeout,
+						     timeout, &retry_timeout);
+			if (status < 0) {
+				return status;
+			}
+
+			/* Update the timeout value in case loop is repeated. */
+			timeout = sys_timepoint_timeout(end);
+
+			continue;
+		}
+
+		break;
+	}
+
+	return status;
+}
+
+ssize_t zsock_sendmsg_zc(int sock, const struct msghdr *msg, int flags,
+			 zsock_send_zc_cb_t cb, void *user_data)
+{
+	const struct fd_op_vtable *vtable;
+	struct net_context *ctx;
+	struct k_mutex *lock;
+	ssize_t ret;
+
+	if (msg == NULL || (msg->msg_iovlen > 0 && msg->msg_iov == NULL)) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	ctx = zvfs_get_fd_obj_and_vtable(sock, &vtable, &lock);
+	if (ctx == NULL) {
+		return -1;
+	}
+
+	if (vtable != &sock_fd_op_vtable.fd_vtable) {
+		errno = EOPNOTSUPP;
+		return -1;
+	}
+
+	(void)k_mutex_lock(lock, K_FOREVER);
+
+	ret = zsock_sendmsg_zc_ctx(ctx, msg, flags, cb, user_data);
+
+	k_mutex_unlock(lock);
+
+	return ret;
+}
+#endif /* CONFIG_NET_SOCKETS_ZEROCOPY_TX */
+
 static int sock_get_pkt_src_addr(struct net_pkt *pkt,
 				 enum net_ip_protocol proto,
 				 struct sockaddr *addr,
@@ -1052,6 +1147,42 @@ static int update_msg_controllen(struct msghdr *msg)
 	return 0;
 }
 
+static int sock_fill_src_addr(struct net_context *ctx, struct net_pkt *pkt,
+			      struct sockaddr *src_addr, socklen_t *addrlen)
+{
+	int ret;
+
+	if (IS_ENABLED(CONFIG_NET_OFFLOAD) &&
+	    net_if_is_ip_offloaded(net_context_get_iface(ctx))) {
+		ret = sock_get_offload_pkt_src_addr(pkt, ctx, src_addr,
+						    *addrlen);
+		if (ret < 0) {
+			NET_DBG("sock_get_offload_pkt_src_addr %d", ret);
+			return ret;
+		}
+	} else {
+		ret = sock_get_pkt_src_addr(pkt, net_context_get_proto(ctx),
+					    src_addr, *addrlen);
+		if (ret < 0) {
+			NET_DBG("sock_get_pkt_src_addr %d", ret);
+			return ret;
+		}
+	}
+
+	/* addrlen is a value-result argument, set to actual
+	 * size of source address
+	 */
+	if (src_addr->sa_family == AF_INET) {
+		*addrlen = sizeof(struct sockaddr_in);
+	} else if (src_addr->sa_family == AF_INET6) {
+		*addrlen = sizeof(struct sockaddr_in6);
+	} else {
+		return -ENOTSUP;
+	}
+
+	return 0;
+}
+
 static ssize_t zsock_recv_dgram(struct net_context *ctx,
 				struct msghdr *msg,
 				void *buf,
@@ -1103,38 +1234,11 @@ static ssize_t zsock_recv_dgram(struct net_context *ctx,
 	net_pkt_cursor_backup(pkt, &backup);
 
 	if (src_addr && addrlen) {
-		if (IS_ENABLED(CONFIG_NET_OFFLOAD) &&
-		    net_if_is_ip_offloaded(net_context_get_iface(ctx))) {
-			int ret;
-
-			ret  = sock_get_offload_pkt_src_addr(pkt, ctx, src_addr,
-								*addrlen);
-			if (ret < 0) {
-				errno = -ret;
-				NET_DBG("sock_get_offload_pkt_src_addr %d", ret);
-				goto fail;
-			}
-		} else {
-			int ret;
-
-			ret = sock_get_pkt_src_addr(pkt, net_context_get_proto(ctx),
-						   src_addr, *addrlen);
-			if (ret < 0) {
-				errno = -ret;
-				NET_DBG("sock_get_pkt_src_addr %d", ret);
-				goto fail;
-			}
-		}
+		int ret;
 
-		/* addrlen is a value-result argument, set to actual
-		 * size of source address
-		 */
-		if (src_addr->sa_family == AF_INET) {
-			*addrlen = sizeof(struct sockaddr_in);
-		} else if (src_addr->sa_family == AF_INET6) {
-			*addrlen = sizeof(struct sockaddr_in6);
-		} else {
-			errno = ENOTSUP;
+		ret = sock_fill_src_addr(ctx, pkt, src_addr, addrlen);
+		if (ret < 0) {
+			errno = -ret;
 			goto fail;
 		}
 	}
@@ -1506,6 +1610,211 @@ ssize_t zsock_recvmsg_ctx(struct net_context *ctx, struct msghdr *msg,
 	return -1;
 }
 
+#if defined(CONFIG_NET_SOCKETS_ZEROCOPY_RX)
+/* Detach the unread data of a packet from it and release the packet */
+static struct net_buf *zsock_pkt_detach_data(struct net_pkt *pkt)
+{
+	struct net_buf *frags = pkt->buffer;
+
+	pkt->buffer = NULL;
+
+	/* Drop the fragments holding headers or data which was already read */
+	while (frags != NULL && frags != pkt->cursor.buf) {
+		frags = net_buf_frag_del(NULL, frags);
+	}
+
+	if (frags != NULL) {
+		(void)net_buf_pull(frags, pkt->cursor.pos - frags->data);
+	}
+
+	while (frags != NULL && frags->len == 0U) {
+		frags = net_buf_frag_del(NULL, frags);
+	}
+
+	net_pkt_unref(pkt);
+
+	return frags;
+}
+
+/* The first lent fragment records the context the data was received on,
+ * which holds a reference until the fragments are released.
+ */
+BUILD_ASSERT(sizeof(struct net_context *) <=
+	     ROUND_UP(CONFIG_NET_PKT_BUF_USER_DATA_SIZE, __alignof__(struct net_buf)),
+	     "Network buffer user data cannot hold the owning context");
+
+static void zsock_zc_set_owner(struct net_buf *frags, struct net_context *ctx)
+{
+	*(struct net_context **)net_buf_user_data(frags) = ctx;
+}
+
+static struct net_context *zsock_zc_get_owner(struct net_buf *frags)
+{
+	return *(struct net_context **)net_buf_user_data(frags);
+}
+
+static ssize_t zsock_recv_zc_ctx(struct net_context *ctx, struct net_buf **frags,
+				 int flags, struct sockaddr *src_addr,
+				 socklen_t *addrlen)
+{
+	enum net_sock_type sock_type = net_context_get_type(ctx);
+	k_timeout_t timeout = K_FOREVER;
+	struct net_pkt *pkt;
+	struct net_buf *buf;
+	ssize_t len = 0;
+	int ret;
+
+	if (sock_type != SOCK_DGRAM && sock_type != SOCK_STREAM) {
+		errno = EOPNOTSUPP;
+		return -1;
+	}
+
+	if (sock_type == SOCK_STREAM) {
+		if (net_context_get_state(ctx) != NET_CONTEXT_CONNECTED) {
+			errno = ENOTCONN;
+			return -1;
+		}
+
+		if (sock_is_error(ctx)) {
+			errno = POINTER_TO_INT(ctx->user_data);
+			return -1;
+		}
+
+		if (sock_is_eof(ctx)) {
+			return 0;
+		}
+	}
+
+	if (atomic_get(&ctx->zc_lent) >= CONFIG_NET_SOCKETS_ZEROCOPY_RX_MAX_BUFS) {
+		errno = ENOBUFS;
+		return -1;
+	}
+
+	if ((flags & ZSOCK_MSG_DONTWAIT) || sock_is_nonblock(ctx)) {
+		timeout = K_NO_WAIT;
+	} else {
+		net_context_get_option(ctx, NET_OPT_RCVTIMEO, &timeout, NULL);
+
+		ret = zsock_wait_data(ctx, &timeout);
+		if (ret < 0) {
+			errno = -ret;
+			return -1;
+		}
+	}
+
+	/* The fd lock is held, so nothing can be queued while waiting here */
+	pkt = k_fifo_get(&ctx->recv_q, K_NO_WAIT);
+	if (pkt == NULL) {
+		if (sock_type == SOCK_STREAM && sock_is_eof(ctx)) {
+			return 0;
+		}
+
+		errno = EAGAIN;
+		return -1;
+	}
+
+	if (sock_type == SOCK_STREAM && net_pkt_eof(pkt)) {
+		sock_set_eof(ctx);
+	}
+
+	if (src_addr && addrlen) {
+		ret = sock_fill_src_addr(ctx, pkt, src_addr, addrlen);
+		if (ret < 0) {
+			errno = -ret;
+			net_pkt_unref(pkt);
+			return -1;
+		}
+	}
+
+	if (IS_ENABLED(CONFIG_NET_PKT_RXTIME_STATS) ||
+	    IS_ENABLED(CONFIG_TRACING_NET_CORE)) {
+		net_socket_update_tc_rx_time(pkt, k_cycle_get_32());
+	}
+
+	*frags = zsock_pkt_detach_data(pkt);
+	if (*frags == NULL) {
+		return 0;
+	}
+
+	for (buf = *frags; buf != NULL; buf = buf->frags) {
+		len += buf->len;
+		atomic_inc(&ctx->zc_lent);
+	}
+
+	net_context_ref(ctx);
+	zsock_zc_set_owner(*frags, ctx);
+
+	return len;
+}
+
+ssize_t zsock_recv_zc(int sock, struct net_buf **frags, int flags,
+		      struct sockaddr *src_addr, socklen_t *addrlen)
+{
+	const struct fd_op_vtable *vtable;
+	struct net_context *ctx;
+	struct k_mutex *lock;
+	ssize_t ret;
+
+	if (frags == NULL) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	*frags = NULL;
+
+	ctx = zvfs_get_fd_obj_and_vtable(sock, &vtable, &lock);
+	if (ctx == NULL) {
+		return -1;
+	}
+
+	if (vtable != &sock_fd_op_vtable.fd_vtable) {
+		errno = EOPNOTSUPP;
+		return -1;
+	}
+
+	(void)k_mutex_lock(lock, K_FOREVER);
+
+	ret = zsock_recv_zc_ctx(ctx, frags, flags, src_addr, addrlen);
+
+	k_mutex_unlock(lock);
+
+	return ret;
+}
+
+int zsock_recv_zc_release(struct net_buf *frags)
+{
+	struct net_context *ctx;
+	struct net_buf *buf;
+	size_t len = 0;
+	int count = 0;
+
+	if (frags == NULL) {
+		return 0;
+	}
+
+	ctx = zsock_zc_get_owner(frags);
+
+	for (buf = frags; buf != NULL; buf = buf->frags) {
+		len += buf->len;
+		count++;
+	}
+
+	net_buf_unref(frags);
+
+	atomic_sub(&ctx->zc_lent, count);
+
+	/* Data held by the application was kept out of the window */
+	if (net_context_get_type(ctx) == SOCK_STREAM && len > 0 &&
+	    net_context_get_state(ctx) == NET_CONTEXT_CONNECTED) {
+		net_context_update_recv_wnd(ctx, len);
+	}
+
+	net_context_unref(ctx);
+
+	return 0;
+}
+#endif /* CONFIG_NET_SOCKETS_ZEROCOPY_RX */
+
 static int zsock_poll_prepare_ctx(struct net_context *ctx,
 				  struct zsock_pollfd *pfd,
 				  struct k_poll_event **pev,
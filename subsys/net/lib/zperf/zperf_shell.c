@@ -72,6 +72,9 @@ static struct in6_addr shell_ipv6;
 
 static struct in_addr shell_ipv4;
 
+static bool udp_download_zerocopy;
+static bool tcp_download_zerocopy;
+
 #define DEVICE_NAME "zperf shell"
 
 const uint32_t TIME_US[] = { 60 * 1000 * 1000, 1000 * 1000, 1000, 0 };
@@ -355,6 +358,9 @@ static void udp_session_cb(enum zperf_status status,
 		print_number(sh, rate_in_kbps, KBPS, KBPS_UNIT);
 		shell_fprintf(sh, SHELL_NORMAL, "\n");
 
+		shell_fprintf(sh, SHELL_NORMAL, " receive:\t\t%s\n",
+			      udp_download_zerocopy ? "zero-copy" : "copy");
+
 		break;
 	}
 
@@ -404,6 +410,18 @@ static int shell_cmd_download(const struct shell *sh, size_t argc,
 			opt_cnt += 2;
 			break;
 
+		case 'z':
+			if (!IS_ENABLED(CONFIG_NET_ZPERF_ZEROCOPY_RX)) {
+				shell_fprintf(sh, SHELL_WARNING,
+					      "Zero-copy receive not enabled "
+					      "(CONFIG_NET_ZPERF_ZEROCOPY_RX)\n");
+				return -ENOEXEC;
+			}
+
+			param->zerocopy = true;
+			opt_cnt += 1;
+			break;
+
 		default:
 			shell_fprintf(sh, SHELL_WARNING,
 				      "Unrecognized argument: %s\n", argv[i]);
@@ -453,6 +471,8 @@ static int cmd_udp_download(const struct shell *sh, size_t argc,
 			return -ENOEXEC;
 		}
 
+		udp_download_zerocopy = param.zerocopy;
+
 		ret = zperf_udp_download(&param, udp_session_cb, (void *)sh);
 		if (ret == -EALREADY) {
 			shell_fprintf(sh, SHELL_WARNING,
@@ -1322,6 +1342,9 @@ static void tcp_session_cb(enum zperf_status status,
 		print_number(sh, rate_in_kbps, KBPS, KBPS_UNIT);
 		shell_fprintf(sh, SHELL_NORMAL, "\n");
 
+		shell_fprintf(sh, SHELL_NORMAL, " receive:\t\t%s\n",
+			      tcp_download_zerocopy ? "zero-copy" : "copy");
+
 		break;
 	}
 
@@ -1373,6 +1396,8 @@ static int cmd_tcp_download(const struct shell *sh, size_t argc,
 			return -ENOEXEC;
 		}
 
+		tcp_download_zerocopy = param.zerocopy;
+
 		ret = zperf_tcp_download(&param, tcp_session_cb, (void *)sh);
 		if (ret == -EALREADY) {
 			shell_fprintf(sh, SHELL_WARNING,
@@ -1509,8 +1534,11 @@ SHELL_STATIC_SUBCMD_SET_CREATE(zperf_cmd_tcp,
 		  ,
 		  cmd_tcp_upload2),
 	SHELL_CMD(download, &zperf_cmd_tcp_download,
+		  "[<options>] command options (optional): [-z]\n"
 		  "[<port>]:  Server port to listen on/connect to\n"
 		  "[<host>]:  Bind to <host>, an interface address\n"
+		  "Available options:\n"
+		  "-z: Receive without copying the data (zero-copy)\n"
 		  "Example: tcp download 5001 192.168.0.1\n",
 		  cmd_tcp_download),
 	SHELL_SUBCMD_SET_END
@@ -1576,11 +1604,12 @@ SHELL_STATIC_SUBCMD_SET_CREATE(zperf_cmd_udp,
 		  ,
 		  cmd_udp_upload2),
 	SHELL_CMD(download, &zperf_cmd_udp_download,
-		  "[<options>] command options (optional): [-I eth0]\n"
+		  "[<options>] command options (optional): [-I eth0 -z]\n"
 		  "[<port>]:  Server port to listen on/connect to\n"
 		  "[<host>]:  Bind to <host>, an interface address\n"
 		  "Available options:\n"
 		  "-I <interface name>: Specify host interface name\n"
+		  "-z: Receive without copying the data (zero-copy)\n"
 		  "Example: udp download 5001 192.168.0.1\n",
 		  cmd_udp_download),
 	SHELL_SUBCMD_SET_END
@@ -33,6 +33,7 @@ LOG_MODULE_DECLARE(net_zperf, CONFIG_NET_ZPERF_LOG_LEVEL);
 static zperf_callback tcp_session_cb;
 static void *tcp_user_data;
 static bool tcp_server_running;
+static bool tcp_server_zerocopy;
 static uint16_t tcp_server_port;
 static struct sockaddr tcp_server_addr;
 
@@ -121,6 +122,21 @@ static void tcp_receiver_cleanup(void)
 	zperf_session_reset(SESSION_TCP);
 }
 
+/* Returns -1 with errno set on error, like zsock_recv() */
+static ssize_t tcp_recv_zerocopy(int sock)
+{
+	struct net_buf *frags;
+	ssize_t len;
+
+	len = zsock_recv_zc(sock, &frags, 0, NULL, NULL);
+	if (len > 0) {
+		/* As with the copying receiver, the data is not inspected */
+		(void)zsock_recv_zc_release(frags);
+	}
+
+	return len;
+}
+
 static int tcp_recv_data(struct net_socket_service_event *pev)
 {
 	static uint8_t buf[TCP_RECEIVER_BUF_SIZE];
@@ -189,7 +205,12 @@ static int tcp_recv_data(struct net_socket_service_event *pev)
 		}
 
 	} else {
-		ret = zsock_recv(pev->event.fd, buf, sizeof(buf), 0);
+		if (IS_ENABLED(CONFIG_NET_ZPERF_ZEROCOPY_RX) && tcp_server_zerocopy) {
+			ret = tcp_recv_zerocopy(pev->event.fd);
+		} else {
+			ret = zsock_recv(pev->event.fd, buf, sizeof(buf), 0);
+		}
+
 		if (ret < 0) {
 			(void)zsock_getsockopt(pev->event.fd, SOL_SOCKET,
 					       SO_DOMAIN, &family, &optlen);
@@ -403,9 +424,14 @@ int zperf_tcp_download(const struct zperf_download_params *param,
 		return -EALREADY;
 	}
 
+	if (param->zerocopy && !IS_ENABLED(CONFIG_NET_ZPERF_ZEROCOPY_RX)) {
+		return -ENOTSUP;
+	}
+
 	tcp_session_cb = callback;
 	tcp_user_data = user_data;
 	tcp_server_port = param->port;
+	tcp_server_zerocopy = param->zerocopy;
 	memcpy(&tcp_server_addr, &param->addr, sizeof(struct sockaddr));
 
 	ret = zperf_tcp_receiver_init();
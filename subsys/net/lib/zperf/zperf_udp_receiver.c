@@ -11,6 +11,7 @@ LOG_MODULE_DECLARE(net_zperf, CONFIG_NET_ZPERF_LOG_LEVEL);
 #include <zephyr/toolchain.h>
 
 #include <zephyr/kernel.h>
+#include <zephyr/net_buf.h>
 
 #include <zephyr/net/mld.h>
 #include <zephyr/net/socket.h>
@@ -41,6 +42,7 @@ static struct sockaddr_in *in4_addr_my;
 static zperf_callback udp_session_cb;
 static void *udp_user_data;
 static bool udp_server_running;
+static bool udp_server_zerocopy;
 static uint16_t udp_server_port;
 static struct sockaddr udp_server_addr;
 
@@ -312,6 +314,35 @@ static void udp_receiver_cleanup(void)
 	zperf_session_reset(SESSION_UDP);
 }
 
+/* Returns -1 with errno set on error, like zsock_recvfrom() */
+static ssize_t udp_recv_zerocopy(int sock, struct sockaddr *addr,
+				 socklen_t *addrlen)
+{
+	struct zperf_udp_datagram hdr;
+	struct net_buf *frags;
+	uint8_t *data = NULL;
+	ssize_t len;
+
+	len = zsock_recv_zc(sock, &frags, 0, addr, addrlen);
+	if (len < 0) {
+		return len;
+	}
+
+	if (frags != NULL && frags->len >= sizeof(hdr)) {
+		data = frags->data;
+	} else if (frags != NULL) {
+		/* Only the iperf header is needed, copy it if it is split */
+		(void)net_buf_linearize(&hdr, sizeof(hdr), frags, 0, sizeof(hdr));
+		data = (uint8_t *)&hdr;
+	}
+
+	udp_received(sock, addr, data, len);
+
+	(void)zsock_recv_zc_release(frags);
+
+	return len;
+}
+
 static int udp_recv_data(struct net_socket_service_event *pev)
 {
 	static uint8_t buf[UDP_RECEIVER_BUF_SIZE];
@@ -341,8 +372,16 @@ static int udp_recv_data(struct net_socket_service_event *pev)
 		return 0;
 	}
 
-	ret = zsock_recvfrom(pev->event.fd, buf, sizeof(buf), 0,
-			     &addr, &addrlen);
+	if (IS_ENABLED(CONFIG_NET_ZPERF_ZEROCOPY_RX) && udp_server_zerocopy) {
+		ret = udp_recv_zerocopy(pev->event.fd, &addr, &addrlen);
+	} else {
+		ret = zsock_recvfrom(pev->event.fd, buf, sizeof(buf), 0,
+				     &addr, &addrlen);
+		if (ret >= 0) {
+			udp_received(pev->event.fd, &addr, buf, ret);
+		}
+	}
+
 	if (ret < 0) {
 		ret = -errno;
 		(void)zsock_getsockopt(pev->event.fd, SOL_SOCKET,
@@ -352,8 +391,6 @@ static int udp_recv_data(struct net_socket_service_event *pev)
 		goto error;
 	}
 
-	udp_received(pev->event.fd, &addr, buf, ret);
-
 	return ret;
 
 error:
@@ -522,9 +559,14 @@ int zperf_udp_download(const struct zperf_download_params *param,
 		return -EALREADY;
 	}
 
+	if (param->zerocopy && !IS_ENABLED(CONFIG_NET_ZPERF_ZEROCOPY_RX)) {
+		return -ENOTSUP;
+	}
+
 	udp_session_cb = callback;
 	udp_user_data  = user_data;
 	udp_server_port = param->port;
+	udp_server_zerocopy = param->zerocopy;
 	memcpy(&udp_server_addr, &param->addr, sizeof(struct sockaddr));
 
 	if (param->if_name[0]) {
@@ -48,6 +48,13 @@ static inline void rtio_iodev_submit(struct rtio_iodev_sqe *iodev_sqe)
 		return;
 	}
 
+#ifdef CONFIG_RTIO_WORKER
+	if (iodev_sqe->sqe.iodev->worker != NULL) {
+		rtio_iodev_worker_submit(iodev_sqe->sqe.iodev->worker, iodev_sqe);
+		return;
+	}
+#endif
+
 	iodev_sqe->sqe.iodev->api->submit(iodev_sqe);
 }
 
@@ -139,11 +146,34 @@ static inline void rtio_executor_handle_multishot(struct rtio *r, struct rtio_io
 	}
 }
 
+/**
+ * @brief Produce a completion of a submission to iodev
+ *
+ * Completions made on the thread of the iodev's worker are notified by the
+ * worker once it has no more submissions to give to its iodevs.
+ */
+static inline void rtio_executor_cqe_submit(const struct rtio_iodev *iodev, struct rtio *r,
+					    int result, void *userdata, uint32_t flags)
+{
+#ifdef CONFIG_RTIO_WORKER
+	if (iodev != NULL && iodev->worker != NULL && !k_is_in_isr() &&
+	    k_current_get() == iodev->worker->thread) {
+		rtio_iodev_worker_cqe_submit(iodev->worker, r, result, userdata, flags);
+		return;
+	}
+#else
+	ARG_UNUSED(iodev);
+#endif
+
+	rtio_cqe_submit(r, result, userdata, flags);
+}
+
 static inline void rtio_executor_done(struct rtio_iodev_sqe *iodev_sqe, int result, bool is_ok)
 {
 	const bool is_multishot = FIELD_GET(RTIO_SQE_MULTISHOT, iodev_sqe->sqe.flags) == 1;
 	const bool is_canceled = FIELD_GET(RTIO_SQE_CANCELED, iodev_sqe->sqe.flags) == 1;
 	struct rtio *r = iodev_sqe->r;
+	const struct rtio_iodev *iodev = iodev_sqe->sqe.iodev;
 	struct rtio_iodev_sqe *curr = iodev_sqe, *next;
 	void *userdata;
 	uint32_t sqe_flags, cqe_flags;
@@ -163,7 +193,7 @@ static inline void rtio_executor_done(struct rtio_iodev_sqe *iodev_sqe, int resu
 		}
 		if (!is_canceled && FIELD_GET(RTIO_SQE_NO_RESPONSE, sqe_flags) == 0) {
 			/* Request was not canceled, generate a CQE */
-			rtio_cqe_submit(r, result, userdata, cqe_flags);
+			rtio_executor_cqe_submit(iodev, r, result, userdata, cqe_flags);
 		}
 		curr = next;
 		if (!is_ok) {
@@ -0,0 +1,105 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/rtio/rtio.h>
+#include <zephyr/kernel.h>
+
+void rtio_iodev_worker_submit(struct rtio_iodev_worker *worker,
+			      struct rtio_iodev_sqe *iodev_sqe)
+{
+	mpsc_push(&worker->sq, &iodev_sqe->q);
+	k_sem_give(worker->sem);
+}
+
+/**
+ * @brief Notify the completions of the current batch
+ */
+static void rtio_iodev_worker_notify(struct rtio_iodev_worker *worker)
+{
+	if (worker->cq_count == 0) {
+		return;
+	}
+
+	/* Waiters of the whole batch are rescheduled once */
+	k_sched_lock();
+	for (int i = 0; i < ARRAY_SIZE(worker->cq_ctx); i++) {
+		if (worker->cq_ctx[i] != NULL) {
+			rtio_cqe_notify(worker->cq_ctx[i], worker->cq_pending[i]);
+			worker->cq_ctx[i] = NULL;
+			worker->cq_pending[i] = 0;
+		}
+	}
+	k_sched_unlock();
+
+	worker->cq_count = 0;
+}
+
+void rtio_iodev_worker_cqe_submit(struct rtio_iodev_worker *worker, struct rtio *r,
+				  int result, void *userdata, uint32_t flags)
+{
+	int slot = -1;
+	int i;
+
+	rtio_cqe_queue(r, result, userdata, flags);
+
+	for (i = 0; i < ARRAY_SIZE(worker->cq_ctx); i++) {
+		if (worker->cq_ctx[i] == r) {
+			break;
+		}
+		if (worker->cq_ctx[i] == NULL && slot < 0) {
+			slot = i;
+		}
+	}
+
+	if (i == ARRAY_SIZE(worker->cq_ctx)) {
+		/* Completing for more contexts than a batch can track */
+		if (slot < 0) {
+			rtio_iodev_worker_notify(worker);
+			slot = 0;
+		}
+		i = slot;
+		worker->cq_ctx[i] = r;
+	}
+
+	worker->cq_pending[i]++;
+	worker->cq_count++;
+
+	if (worker->cq_count >= CONFIG_RTIO_WORKER_BATCH_SIZE) {
+		rtio_iodev_worker_notify(worker);
+	}
+}
+
+void rtio_iodev_worker_thread(void *p1, void *p2, void *p3)
+{
+	struct rtio_iodev_worker *worker = p1;
+	struct rtio_iodev_sqe *iodev_sqe;
+	struct mpsc_node *node;
+
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	worker->thread = k_current_get();
+
+	while (true) {
+		k_sem_take(worker->sem, K_FOREVER);
+
+		/* Submissions made meanwhile, including the chained ones, join the batch */
+		node = mpsc_pop(&worker->sq);
+		while (node != NULL) {
+			iodev_sqe = CONTAINER_OF(node, struct rtio_iodev_sqe, q);
+
+			/* Canceled while waiting in the queue */
+			if (FIELD_GET(RTIO_SQE_CANCELED, iodev_sqe->sqe.flags)) {
+				rtio_iodev_sqe_err(iodev_sqe, -ECANCELED);
+			} else {
+				iodev_sqe->sqe.iodev->api->submit(iodev_sqe);
+			}
+			node = mpsc_pop(&worker->sq);
+		}
+
+		rtio_iodev_worker_notify(worker);
+	}
+}
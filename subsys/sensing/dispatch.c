@@ -4,6 +4,7 @@
  * SPDX-License-Identifier: Apache-2.0
  */
 #include <zephyr/sys/__assert.h>
+#include <zephyr/sys/barrier.h>
 #include <zephyr/logging/log.h>
 #include <zephyr/rtio/rtio.h>
 #include <zephyr/sensing/sensing_sensor.h>
@@ -11,6 +12,98 @@
 
 LOG_MODULE_DECLARE(sensing, CONFIG_SENSING_LOG_LEVEL);
 
+#ifdef CONFIG_SENSING_SHARED_RING
+BUILD_ASSERT(IS_POWER_OF_TWO(CONFIG_SENSING_SHARED_RING_SIZE),
+	     "CONFIG_SENSING_SHARED_RING_SIZE must be a power of two");
+
+#define RING_MASK (CONFIG_SENSING_SHARED_RING_SIZE - 1)
+
+/* Write a sample once for all the clients reading the ring.  The slot is
+ * tagged with the sequence number of the sample before it is overwritten, so
+ * that a reader copying the previous sample out of it notices.
+ */
+static void shared_ring_put(struct sensing_sensor *sensor, uint32_t seq, const void *data,
+			    uint32_t len)
+{
+	uint32_t slot = seq & RING_MASK;
+
+	atomic_set(&sensor->ring_tag[slot], (atomic_val_t)seq);
+	barrier_dmem_fence_full();
+	memcpy(sensor->ring[slot], data, len);
+	sensor->ring_len[slot] = len;
+}
+
+int read_sample(struct sensing_connection *conn, void *buf, size_t size)
+{
+	struct sensing_sensor *sensor = conn->source;
+	uint32_t decimation = MAX(conn->decimation, 1);
+
+	if (conn->callback_list->on_data_event != NULL) {
+		/* the dispatch thread consumes its samples */
+		return -ENOTSUP;
+	}
+
+	while (true) {
+		/* the sample is published once ring_seq moves past it */
+		uint32_t seq = (uint32_t)atomic_get(&sensor->ring_seq);
+		int32_t pending = (int32_t)(seq - conn->next_seq);
+		uint32_t slot = conn->next_seq & RING_MASK;
+		uint32_t len;
+
+		if (pending <= 0) {
+			return -ENODATA;
+		}
+
+		if (pending > CONFIG_SENSING_SHARED_RING_SIZE) {
+			/* skip to the oldest sample left, in step with the decimation */
+			uint32_t lost = ROUND_UP(pending - CONFIG_SENSING_SHARED_RING_SIZE,
+						 decimation);
+
+			LOG_DBG("sensor:%s conn:%p lost %u samples", sensor->dev->name, conn,
+				lost);
+			conn->next_seq += lost;
+			continue;
+		}
+
+		if ((uint32_t)atomic_get(&sensor->ring_tag[slot]) != conn->next_seq) {
+			/* too large for the ring, or written while nobody read it */
+			conn->next_seq += decimation;
+			continue;
+		}
+
+		len = sensor->ring_len[slot];
+		if (len > size) {
+			return -ENOSPC;
+		}
+
+		memcpy(buf, sensor->ring[slot], len);
+		barrier_dmem_fence_full();
+
+		if ((uint32_t)atomic_get(&sensor->ring_tag[slot]) != conn->next_seq) {
+			/* lapped by the writer while copying, retry with a newer sample */
+			continue;
+		}
+
+		conn->next_seq += decimation;
+
+		return len;
+	}
+}
+
+/* Consumption is derived from the sample sequence number, the same counter
+ * read_sample() follows, so both give a client the same samples.
+ */
+static inline bool sensor_test_consume_sample(struct sensing_connection *conn, uint32_t seq)
+{
+	if ((int32_t)(seq - conn->next_seq) < 0) {
+		return false;
+	}
+
+	conn->next_seq = seq + MAX(conn->decimation, 1);
+
+	return true;
+}
+#else
 /* check whether it is right time for client to consume this sample */
 static inline bool sensor_test_consume_time(struct sensing_sensor *sensor,
 				     struct sensing_connection *conn,
@@ -33,13 +126,19 @@ static void update_client_consume_time(struct sensing_sensor *sensor,
 
 	conn->next_consume_time += interval;
 }
+#endif
 
-/* send data to clients based on interval and sensitivity */
-static int send_data_to_clients(struct sensing_sensor *sensor,
-				void *data)
+/* send data to clients based on interval and sensitivity, returns whether
+ * a client reads the samples through the shared ring instead
+ */
+static bool send_data_to_clients(struct sensing_sensor *sensor,
+				 void *data, uint32_t seq)
 {
 	struct sensing_sensor *client;
 	struct sensing_connection *conn;
+	bool ring_reader = false;
+
+	ARG_UNUSED(seq);
 
 	for_each_client_conn(sensor, conn) {
 		client = conn->sink;
@@ -49,6 +148,17 @@ static int send_data_to_clients(struct sensing_sensor *sensor,
 			continue;
 		}
 
+#ifdef CONFIG_SENSING_SHARED_RING
+		if (!conn->callback_list->on_data_event) {
+			/* decimated by read_sample() */
+			ring_reader = true;
+			continue;
+		}
+
+		if (!sensor_test_consume_sample(conn, seq)) {
+			continue;
+		}
+#else
 		/* sensor_test_consume_time(), check whether time is ready or not:
 		 * true: it's time for client consuming the data
 		 * false: client time not arrived yet, not consume the data
@@ -58,6 +168,7 @@ static int send_data_to_clients(struct sensing_sensor *sensor,
 		}
 
 		update_client_consume_time(sensor, conn);
+#endif
 
 		if (!conn->callback_list->on_data_event) {
 			LOG_WRN("sensor:%s event callback not registered",
@@ -68,7 +179,7 @@ static int send_data_to_clients(struct sensing_sensor *sensor,
 				conn->callback_list->context);
 	}
 
-	return 0;
+	return ring_reader;
 }
 
 STRUCT_SECTION_START_EXTERN(sensing_sensor);
@@ -113,7 +224,22 @@ static void dispatch_task(void *a, void *b, void *c)
 		    (uintptr_t)cqe.userdata < (uintptr_t)STRUCT_SECTION_END(sensing_sensor)) {
 			struct sensing_sensor *sensor = cqe.userdata;
 
-			send_data_to_clients(sensor, data);
+#ifdef CONFIG_SENSING_SHARED_RING
+			uint32_t seq = (uint32_t)atomic_get(&sensor->ring_seq);
+
+			/* the callbacks get the RTIO buffer, the ring is only
+			 * written for the clients reading it
+			 */
+			if (send_data_to_clients(sensor, data, seq) &&
+			    data_len <= CONFIG_SENSING_SHARED_RING_SAMPLE_SIZE) {
+				shared_ring_put(sensor, seq, data, data_len);
+			}
+
+			/* publish the sample */
+			atomic_set(&sensor->ring_seq, (atomic_val_t)(seq + 1));
+#else
+			send_data_to_clients(sensor, data, 0);
+#endif
 		}
 
 		rtio_release_buffer(&sensing_rtio_ctx, data, data_len);
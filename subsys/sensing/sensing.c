@@ -155,3 +155,14 @@ const struct sensing_sensor_info *sensing_get_sensor_info(sensing_sensor_handle_
 {
 	return get_sensor_info(handle);
 }
+
+#ifdef CONFIG_SENSING_SHARED_RING
+int sensing_read_sample(sensing_sensor_handle_t handle, void *buf, size_t size)
+{
+	if (handle == NULL || buf == NULL) {
+		return -ENODEV;
+	}
+
+	return read_sample(handle, buf, size);
+}
+#endif
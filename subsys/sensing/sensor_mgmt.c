@@ -73,6 +73,25 @@ static uint32_t arbitrate_interval(struct sensing_sensor *sensor)
 	return interval;
 }
 
+#ifdef CONFIG_SENSING_SHARED_RING
+/* clients get every Nth sample, at least as often as their interval asks for */
+static void update_decimation(struct sensing_sensor *sensor, uint32_t interval)
+{
+	struct sensing_connection *conn;
+
+	for_each_client_conn(sensor, conn) {
+		if (!is_client_request_data(conn) || interval == 0) {
+			conn->decimation = 1;
+		} else {
+			conn->decimation = CLAMP(conn->interval / interval, 1, UINT16_MAX);
+		}
+
+		LOG_DBG("sensor:%s conn:%p decimation:%d", sensor->dev->name, conn,
+			conn->decimation);
+	}
+}
+#endif
+
 static int set_arbitrate_interval(struct sensing_sensor *sensor, uint32_t interval)
 {
 	struct sensing_submit_config *config = sensor->iodev->data;
@@ -116,6 +135,10 @@ static int set_arbitrate_interval(struct sensing_sensor *sensor, uint32_t interv
 
 	sensor->interval = interval;
 
+#ifdef CONFIG_SENSING_SHARED_RING
+	update_decimation(sensor, interval);
+#endif
+
 	return ret;
 }
 
@@ -275,6 +298,11 @@ static void init_connection(struct sensing_connection *conn,
 
 	conn->interval = 0;
 	memset(conn->sensitivity, 0x00, sizeof(conn->sensitivity));
+#ifdef CONFIG_SENSING_SHARED_RING
+	/* start with the next sample of the source */
+	conn->next_seq = (uint32_t)atomic_get(&conn->source->ring_seq);
+	conn->decimation = 1;
+#endif
 	/* link connection to its reporter's client_list */
 	sys_slist_append(&conn->source->client_list, &conn->snode);
 }
@@ -299,6 +327,13 @@ static int init_sensor(struct sensing_sensor *sensor)
 	k_timer_init(&sensor->timer, sensing_sensor_polling_timer, NULL);
 	sys_slist_init(&sensor->client_list);
 
+#ifdef CONFIG_SENSING_SHARED_RING
+	/* no slot holds a sample yet, the first one has sequence number 0 */
+	for (i = 0; i < CONFIG_SENSING_SHARED_RING_SIZE; i++) {
+		atomic_set(&sensor->ring_tag[i], (atomic_val_t)(i - CONFIG_SENSING_SHARED_RING_SIZE));
+	}
+#endif
+
 	for (i = 0; i < sensor->reporter_num; i++) {
 		conn = &sensor->conns[i];
 
@@ -54,6 +54,213 @@ __weak int settings_fcb_get_flash_area(void)
 	return SETTINGS_PARTITION;
 }
 
+#ifdef CONFIG_SETTINGS_LINE_INDEX
+/* Index locations hold the sector number above the offset within the sector */
+#define SETTINGS_FCB_INDEX_OFF_BITS	24
+#define SETTINGS_FCB_INDEX_OFF_MASK	BIT_MASK(SETTINGS_FCB_INDEX_OFF_BITS)
+
+static int settings_fcb_index_name_read(void *ctx,
+					const struct settings_line_index_entry *entry,
+					char *name, size_t len_req, size_t *len_read);
+
+static struct settings_line_index_entry
+	settings_fcb_index_entries[CONFIG_SETTINGS_LINE_INDEX_SIZE];
+
+static struct settings_line_index settings_fcb_index = {
+	.entries = settings_fcb_index_entries,
+	.size = CONFIG_SETTINGS_LINE_INDEX_SIZE,
+	.name_read = settings_fcb_index_name_read,
+};
+
+static uint32_t settings_fcb_index_loc(struct settings_fcb *cf,
+				       const struct fcb_entry *loc)
+{
+	return ((uint32_t)(loc->fe_sector - cf->cf_fcb.f_sectors) <<
+		SETTINGS_FCB_INDEX_OFF_BITS) | loc->fe_data_off;
+}
+
+static void settings_fcb_index_entry_ctx(struct settings_fcb *cf,
+					 const struct settings_line_index_entry *entry,
+					 struct fcb_entry_ctx *entry_ctx)
+{
+	entry_ctx->fap = cf->cf_fcb.fap;
+	entry_ctx->loc.fe_sector =
+		&cf->cf_fcb.f_sectors[entry->loc >> SETTINGS_FCB_INDEX_OFF_BITS];
+	entry_ctx->loc.fe_elem_off = 0U;
+	entry_ctx->loc.fe_data_off = entry->loc & SETTINGS_FCB_INDEX_OFF_MASK;
+	entry_ctx->loc.fe_data_len = entry->len;
+}
+
+static int settings_fcb_index_name_read(void *ctx,
+					const struct settings_line_index_entry *entry,
+					char *name, size_t len_req, size_t *len_read)
+{
+	struct fcb_entry_ctx entry_ctx;
+
+	settings_fcb_index_entry_ctx(ctx, entry, &entry_ctx);
+
+	return settings_line_name_read(name, len_req, len_read, &entry_ctx);
+}
+
+static void settings_fcb_index_update(struct settings_fcb *cf, const char *name,
+				      const struct fcb_entry *loc)
+{
+	if (!settings_line_index_ready(&settings_fcb_index, cf)) {
+		return;
+	}
+
+	if (loc->fe_data_off > SETTINGS_FCB_INDEX_OFF_MASK ||
+	    loc->fe_data_len > UINT16_MAX) {
+		settings_fcb_index.full = true;
+		return;
+	}
+
+	(void)settings_line_index_set(&settings_fcb_index, name,
+				      settings_fcb_index_loc(cf, loc),
+				      loc->fe_data_len, cf);
+}
+
+static void settings_fcb_index_build(struct settings_fcb *cf)
+{
+	struct fcb_entry_ctx entry_ctx = {
+		{.fe_sector = NULL, .fe_elem_off = 0},
+		.fap = cf->cf_fcb.fap
+	};
+
+	settings_line_index_reset(&settings_fcb_index, cf);
+
+	while (fcb_getnext(&cf->cf_fcb, &entry_ctx.loc) == 0 &&
+	       !settings_fcb_index.full) {
+		char name[SETTINGS_MAX_NAME_LEN + SETTINGS_EXTRA_LEN + 1];
+		size_t name_len;
+
+		if (settings_line_name_read(name, sizeof(name), &name_len,
+					    &entry_ctx)) {
+			continue;
+		}
+		name[name_len] = '\0';
+
+		settings_fcb_index_update(cf, name, &entry_ctx.loc);
+	}
+}
+
+/* Build the index on first use, returns whether it can be used */
+static bool settings_fcb_index_get(struct settings_fcb *cf)
+{
+	if (settings_fcb_index.owner != cf) {
+		settings_fcb_index_build(cf);
+	}
+
+	return settings_line_index_ready(&settings_fcb_index, cf);
+}
+
+/*
+ * Returns 1 if the record at loc is the newest one of name, 0 if it is not,
+ * -ENOTSUP if the index can't tell.
+ */
+static int settings_fcb_index_is_newest(struct settings_fcb *cf,
+					const struct fcb_entry *loc,
+					const char *name)
+{
+	struct settings_line_index_entry *entry;
+
+	if (!settings_line_index_ready(&settings_fcb_index, cf)) {
+		return -ENOTSUP;
+	}
+
+	entry = settings_line_index_find(&settings_fcb_index, name, cf);
+
+	return entry != NULL && entry->loc == settings_fcb_index_loc(cf, loc);
+}
+
+/* Forget name if its newest record is the one at loc, which is going away */
+static void settings_fcb_index_forget(struct settings_fcb *cf,
+				      const struct fcb_entry *loc,
+				      const char *name)
+{
+	struct settings_line_index_entry *entry;
+
+	if (!settings_line_index_ready(&settings_fcb_index, cf)) {
+		return;
+	}
+
+	entry = settings_line_index_find(&settings_fcb_index, name, cf);
+	if (entry != NULL && entry->loc == settings_fcb_index_loc(cf, loc)) {
+		settings_line_index_remove(&settings_fcb_index, entry);
+	}
+}
+
+static int settings_fcb_index_dup_check(struct settings_fcb *cf,
+					struct settings_line_dup_check_arg *cdca)
+{
+	struct settings_line_index_entry *entry;
+	struct fcb_entry_ctx entry_ctx;
+
+	if (!settings_fcb_index_get(cf)) {
+		return -ENOTSUP;
+	}
+
+	entry = settings_line_index_find(&settings_fcb_index, cdca->name, cf);
+	if (entry != NULL) {
+		settings_fcb_index_entry_ctx(cf, entry, &entry_ctx);
+		settings_line_dup_check_cb(cdca->name, &entry_ctx,
+					   strlen(cdca->name) + 1, cdca);
+	}
+
+	return 0;
+}
+
+static void settings_fcb_index_invalidate(void)
+{
+	settings_line_index_invalidate(&settings_fcb_index);
+}
+
+static void settings_fcb_index_compressed(struct settings_fcb *cf)
+{
+	/* Names which did not fit might do so after the compression */
+	if (settings_fcb_index.owner == cf && settings_fcb_index.full) {
+		settings_fcb_index_invalidate();
+	}
+}
+#else
+static inline void settings_fcb_index_build(struct settings_fcb *cf)
+{
+}
+
+static inline void settings_fcb_index_update(struct settings_fcb *cf,
+					     const char *name,
+					     const struct fcb_entry *loc)
+{
+}
+
+static inline int settings_fcb_index_is_newest(struct settings_fcb *cf,
+					       const struct fcb_entry *loc,
+					       const char *name)
+{
+	return -ENOTSUP;
+}
+
+static inline void settings_fcb_index_forget(struct settings_fcb *cf,
+					     const struct fcb_entry *loc,
+					     const char *name)
+{
+}
+
+static inline int settings_fcb_index_dup_check(struct settings_fcb *cf,
+					       struct settings_line_dup_check_arg *cdca)
+{
+	return -ENOTSUP;
+}
+
+static inline void settings_fcb_index_invalidate(void)
+{
+}
+
+static inline void settings_fcb_index_compressed(struct settings_fcb *cf)
+{
+}
+#endif /* CONFIG_SETTINGS_LINE_INDEX */
+
 int settings_fcb_src(struct settings_fcb *cf)
 {
 	int rc;
@@ -86,6 +293,9 @@ int settings_fcb_src(struct settings_fcb *cf)
 		}
 	}
 
+	/* The storage might have changed since the index was built */
+	settings_fcb_index_invalidate();
+
 	cf->cf_store.cs_itf = &settings_fcb_itf;
 	settings_src_register(&cf->cf_store);
 
@@ -94,6 +304,8 @@ int settings_fcb_src(struct settings_fcb *cf)
 
 int settings_fcb_dst(struct settings_fcb *cf)
 {
+	settings_fcb_index_invalidate();
+
 	cf->cf_store.cs_itf = &settings_fcb_itf;
 	settings_dst_register(&cf->cf_store);
 
@@ -104,6 +316,8 @@ int settings_fcb_dst(struct settings_fcb *cf)
  * @brief Check if there is any duplicate of the current setting
  *
  * This function checks if there is any duplicated data further in the buffer.
+ * With CONFIG_SETTINGS_LINE_INDEX this is a lookup of the newest record of
+ * the name instead of a scan of the remaining records.
  *
  * @param cf        FCB handler
  * @param entry_ctx Current entry context
@@ -117,6 +331,12 @@ static bool settings_fcb_check_duplicate(struct settings_fcb *cf,
 					const char * const name)
 {
 	struct fcb_entry_ctx entry2_ctx = *entry_ctx;
+	int rc;
+
+	rc = settings_fcb_index_is_newest(cf, &entry_ctx->loc, name);
+	if (rc >= 0) {
+		return rc == 0;
+	}
 
 	while (fcb_getnext(&cf->cf_fcb, &entry2_ctx.loc) == 0) {
 		char name2[SETTINGS_MAX_NAME_LEN + SETTINGS_EXTRA_LEN + 1];
@@ -155,6 +375,11 @@ static int settings_fcb_load_priv(struct settings_store *cs,
 	};
 	int rc;
 
+	if (filter_duplicates) {
+		/* Loading resynchronizes the index with the storage */
+		settings_fcb_index_build(cf);
+	}
+
 	while ((rc = fcb_getnext(&cf->cf_fcb, &entry_ctx.loc)) == 0) {
 		char name[SETTINGS_MAX_NAME_LEN + SETTINGS_EXTRA_LEN + 1];
 		size_t name_len;
@@ -219,9 +444,7 @@ static void settings_fcb_compress(struct settings_fcb *cf)
 	int rc;
 	struct fcb_entry_ctx loc1;
 	struct fcb_entry_ctx loc2;
-	char name1[SETTINGS_MAX_NAME_LEN + SETTINGS_EXTRA_LEN];
-	char name2[SETTINGS_MAX_NAME_LEN + SETTINGS_EXTRA_LEN];
-	int copy;
+	char name1[SETTINGS_MAX_NAME_LEN + SETTINGS_EXTRA_LEN + 1];
 	uint8_t rbs;
 
 	rc = fcb_append_to_scratch(&cf->cf_fcb);
@@ -243,38 +466,22 @@ static void settings_fcb_compress(struct settings_fcb *cf)
 
 		size_t val1_off;
 
-		rc = settings_line_name_read(name1, sizeof(name1), &val1_off,
-					     &loc1);
+		rc = settings_line_name_read(name1, sizeof(name1) - 1,
+					     &val1_off, &loc1);
 		if (rc) {
 			continue;
 		}
+		name1[val1_off] = '\0';
 
 		if (val1_off + 1 == loc1.loc.fe_data_len) {
 			/* Lack of a value so the record is a deletion-record */
 			/* No sense to copy empty entry from */
 			/* the oldest sector */
+			settings_fcb_index_forget(cf, &loc1.loc, name1);
 			continue;
 		}
 
-		loc2 = loc1;
-		copy = 1;
-
-		while (fcb_getnext(&cf->cf_fcb, &loc2.loc) == 0) {
-			size_t val2_off;
-
-			rc = settings_line_name_read(name2, sizeof(name2),
-						     &val2_off, &loc2);
-			if (rc) {
-				continue;
-			}
-
-			if ((val1_off == val2_off) &&
-			    !memcmp(name1, name2, val1_off)) {
-				copy = 0;
-				break;
-			}
-		}
-		if (!copy) {
+		if (settings_fcb_check_duplicate(cf, &loc1, name1)) {
 			continue;
 		}
 
@@ -283,25 +490,34 @@ static void settings_fcb_compress(struct settings_fcb *cf)
 		 */
 		rc = fcb_append(&cf->cf_fcb, loc1.loc.fe_data_len, &loc2.loc);
 		if (rc) {
+			settings_fcb_index_invalidate();
 			continue;
 		}
 
 		rc = settings_line_entry_copy(&loc2, 0, &loc1, 0,
 					      loc1.loc.fe_data_len);
 		if (rc) {
+			settings_fcb_index_invalidate();
 			continue;
 		}
 		rc = fcb_append_finish(&cf->cf_fcb, &loc2.loc);
 
 		if (rc != 0) {
 			LOG_ERR("Failed to finish fcb_append (%d)", rc);
+			settings_fcb_index_invalidate();
+			continue;
 		}
+
+		settings_fcb_index_update(cf, name1, &loc2.loc);
 	}
 	rc = fcb_rotate(&cf->cf_fcb);
 
 	if (rc != 0) {
 		LOG_ERR("Failed to fcb rotate (%d)", rc);
+		settings_fcb_index_invalidate();
 	}
+
+	settings_fcb_index_compressed(cf);
 }
 
 static size_t get_len_cb(void *ctx)
@@ -361,6 +577,13 @@ static int settings_fcb_save_priv(struct settings_store *cs, const char *name,
 			rc = i;
 		}
 	}
+
+	if (rc) {
+		settings_fcb_index_invalidate();
+	} else {
+		settings_fcb_index_update(cf, name, &loc.loc);
+	}
+
 	return rc;
 }
 
@@ -380,7 +603,11 @@ static int settings_fcb_save(struct settings_store *cs, const char *name,
 	cdca.val = (char *)value;
 	cdca.is_dup = 0;
 	cdca.val_len = val_len;
-	settings_fcb_load_priv(cs, settings_line_dup_check_cb, &cdca, false);
+	if (settings_fcb_index_dup_check(CONTAINER_OF(cs, struct settings_fcb, cf_store),
+					 &cdca)) {
+		settings_fcb_load_priv(cs, settings_line_dup_check_cb, &cdca,
+				       false);
+	}
 	if (cdca.is_dup == 1) {
 		return 0;
 	}
@@ -36,6 +36,183 @@ static const struct settings_store_itf settings_file_itf = {
 	.csi_storage_get = settings_file_storage_get
 };
 
+#ifdef CONFIG_SETTINGS_LINE_INDEX
+/*
+ * Index locations are the file offsets of the records, the index is used
+ * with the file opened by the caller.
+ */
+static int settings_file_index_name_read(void *ctx,
+					 const struct settings_line_index_entry *entry,
+					 char *name, size_t len_req, size_t *len_read)
+{
+	struct line_entry_ctx entry_ctx = {
+		.stor_ctx = ctx,
+		.seek = entry->loc,
+		.len = entry->len
+	};
+
+	return settings_line_name_read(name, len_req, len_read, &entry_ctx);
+}
+
+static struct settings_line_index_entry
+	settings_file_index_entries[CONFIG_SETTINGS_LINE_INDEX_SIZE];
+
+static struct settings_line_index settings_file_index = {
+	.entries = settings_file_index_entries,
+	.size = CONFIG_SETTINGS_LINE_INDEX_SIZE,
+	.name_read = settings_file_index_name_read,
+};
+
+static void settings_file_index_update(struct settings_file *cf,
+				       const char *name,
+				       const struct line_entry_ctx *entry_ctx)
+{
+	if (!settings_line_index_ready(&settings_file_index, cf)) {
+		return;
+	}
+
+	if (entry_ctx->len > UINT16_MAX) {
+		settings_file_index.full = true;
+		return;
+	}
+
+	(void)settings_line_index_set(&settings_file_index, name,
+				      entry_ctx->seek, entry_ctx->len,
+				      entry_ctx->stor_ctx);
+}
+
+static void settings_file_index_build(struct settings_file *cf,
+				      struct fs_file_t *file)
+{
+	struct line_entry_ctx entry_ctx = {
+		.stor_ctx = (void *)file,
+		.seek = 0,
+		.len = 0 /* unknown length */
+	};
+	int lines = 0;
+
+	settings_line_index_reset(&settings_file_index, cf);
+
+	while (settings_next_line_ctx(&entry_ctx) == 0 && entry_ctx.len != 0) {
+		char name[SETTINGS_MAX_NAME_LEN + SETTINGS_EXTRA_LEN + 1];
+		size_t name_len;
+
+		if (settings_line_name_read(name, sizeof(name), &name_len,
+					    &entry_ctx) || name_len == 0) {
+			break;
+		}
+		name[name_len] = '\0';
+
+		settings_file_index_update(cf, name, &entry_ctx);
+		lines++;
+	}
+
+	cf->cf_lines = lines;
+}
+
+/* Build the index on first use, returns whether it can be used */
+static bool settings_file_index_get(struct settings_file *cf,
+				    struct fs_file_t *file)
+{
+	if (settings_file_index.owner != cf) {
+		settings_file_index_build(cf, file);
+	}
+
+	return settings_line_index_ready(&settings_file_index, cf);
+}
+
+/*
+ * Returns 1 if the record at entry_ctx is the newest one of name, 0 if it is
+ * not, -ENOTSUP if the index can't tell.
+ */
+static int settings_file_index_is_newest(struct settings_file *cf,
+					 const struct line_entry_ctx *entry_ctx,
+					 const char *name)
+{
+	struct settings_line_index_entry *entry;
+
+	if (!settings_line_index_ready(&settings_file_index, cf)) {
+		return -ENOTSUP;
+	}
+
+	entry = settings_line_index_find(&settings_file_index, name,
+					 entry_ctx->stor_ctx);
+
+	return entry != NULL && entry->loc == entry_ctx->seek;
+}
+
+static int settings_file_index_dup_check(struct settings_file *cf,
+					 struct settings_line_dup_check_arg *cdca)
+{
+	struct settings_line_index_entry *entry;
+	struct line_entry_ctx entry_ctx;
+	struct fs_file_t file;
+	int rc;
+
+	fs_file_t_init(&file);
+
+	rc = fs_open(&file, cf->cf_name, FS_O_READ);
+	if (rc == -ENOENT) {
+		/* Nothing stored yet */
+		settings_line_index_reset(&settings_file_index, cf);
+		cf->cf_lines = 0;
+		return 0;
+	} else if (rc != 0) {
+		return rc;
+	}
+
+	if (!settings_file_index_get(cf, &file)) {
+		(void)fs_close(&file);
+		return -ENOTSUP;
+	}
+
+	entry = settings_line_index_find(&settings_file_index, cdca->name,
+					 &file);
+	if (entry != NULL) {
+		entry_ctx.stor_ctx = &file;
+		entry_ctx.seek = entry->loc;
+		entry_ctx.len = entry->len;
+		settings_line_dup_check_cb(cdca->name, &entry_ctx,
+					   strlen(cdca->name) + 1, cdca);
+	}
+
+	return fs_close(&file);
+}
+
+static void settings_file_index_invalidate(void)
+{
+	settings_line_index_invalidate(&settings_file_index);
+}
+#else
+static inline void settings_file_index_build(struct settings_file *cf,
+					     struct fs_file_t *file)
+{
+}
+
+static inline void settings_file_index_update(struct settings_file *cf,
+					      const char *name,
+					      const struct line_entry_ctx *entry_ctx)
+{
+}
+
+static inline int settings_file_index_is_newest(struct settings_file *cf,
+						const struct line_entry_ctx *entry_ctx,
+						const char *name)
+{
+	return -ENOTSUP;
+}
+
+static inline int settings_file_index_dup_check(struct settings_file *cf,
+						struct settings_line_dup_check_arg *cdca)
+{
+	return -ENOTSUP;
+}
+
+static inline void settings_file_index_invalidate(void)
+{
+}
+#endif /* CONFIG_SETTINGS_LINE_INDEX */
+
 /*
  * Register a file to be a source of configuration.
  */
@@ -44,6 +221,9 @@ int settings_file_src(struct settings_file *cf)
 	if (!cf->cf_name) {
 		return -EINVAL;
 	}
+	/* The file might have changed since the index was built */
+	settings_file_index_invalidate();
+
 	cf->cf_store.cs_itf = &settings_file_itf;
 	settings_src_register(&cf->cf_store);
 
@@ -58,6 +238,8 @@ int settings_file_dst(struct settings_file *cf)
 	if (!cf->cf_name) {
 		return -EINVAL;
 	}
+	settings_file_index_invalidate();
+
 	cf->cf_store.cs_itf = &settings_file_itf;
 	settings_dst_register(&cf->cf_store);
 
@@ -68,7 +250,10 @@ int settings_file_dst(struct settings_file *cf)
  * @brief Check if there is any duplicate of the current setting
  *
  * This function checks if there is any duplicated data further in the buffer.
+ * With CONFIG_SETTINGS_LINE_INDEX this is a lookup of the newest record of
+ * the name instead of a scan of the remaining lines.
  *
+ * @param cf        File handler
  * @param entry_ctx Current entry context
  * @param name      The name of the current entry
  *
@@ -76,10 +261,17 @@ int settings_file_dst(struct settings_file *cf)
  * @retval true  Duplicate found
  */
 static bool settings_file_check_duplicate(
+				  struct settings_file *cf,
 				  const struct line_entry_ctx *entry_ctx,
 				  const char * const name)
 {
 	struct line_entry_ctx entry2_ctx = *entry_ctx;
+	int rc;
+
+	rc = settings_file_index_is_newest(cf, entry_ctx, name);
+	if (rc >= 0) {
+		return rc == 0;
+	}
 
 	/* Searching the duplicates */
 	while (settings_next_line_ctx(&entry2_ctx) == 0) {
@@ -138,6 +330,11 @@ static int settings_file_load_priv(struct settings_store *cs, line_load_cb cb,
 		return -EINVAL;
 	}
 
+	if (filter_duplicates) {
+		/* Loading resynchronizes the index with the storage */
+		settings_file_index_build(cf, &file);
+	}
+
 	while (1) {
 		char name[SETTINGS_MAX_NAME_LEN + SETTINGS_EXTRA_LEN + 1];
 		size_t name_len;
@@ -158,7 +355,7 @@ static int settings_file_load_priv(struct settings_store *cs, line_load_cb cb,
 
 		if (filter_duplicates &&
 		    (!read_entry_len(&entry_ctx, name_len+1) ||
-		     settings_file_check_duplicate(&entry_ctx, name))) {
+		     settings_file_check_duplicate(cf, &entry_ctx, name))) {
 			pass_entry = false;
 		}
 		/*name, val-read_cb-ctx, val-off*/
@@ -231,8 +428,7 @@ static int settings_file_save_and_compress(struct settings_file *cf,
 	struct fs_file_t rf;
 	struct fs_file_t wf;
 	char tmp_file[SETTINGS_FILE_NAME_MAX];
-	char name1[SETTINGS_MAX_NAME_LEN + SETTINGS_EXTRA_LEN];
-	char name2[SETTINGS_MAX_NAME_LEN + SETTINGS_EXTRA_LEN];
+	char name1[SETTINGS_MAX_NAME_LEN + SETTINGS_EXTRA_LEN + 1];
 	struct line_entry_ctx loc1 = {
 		.stor_ctx = &rf,
 		.seek = 0,
@@ -245,7 +441,6 @@ static int settings_file_save_and_compress(struct settings_file *cf,
 		.stor_ctx = &wf
 	};
 
-	int copy;
 	int lines;
 	size_t new_name_len;
 	size_t val1_off;
@@ -275,12 +470,13 @@ static int settings_file_save_and_compress(struct settings_file *cf,
 			break;
 		}
 
-		rc = settings_line_name_read(name1, sizeof(name1), &val1_off,
-					     &loc1);
+		rc = settings_line_name_read(name1, sizeof(name1) - 1,
+					     &val1_off, &loc1);
 		if (rc) {
 			/* try to process next line */
 			continue;
 		}
+		name1[val1_off] = '\0';
 
 		if (val1_off + 1 == loc1.len) {
 			/* Lack of a value so the record is a deletion-record */
@@ -295,33 +491,8 @@ static int settings_file_save_and_compress(struct settings_file *cf,
 			continue;
 		}
 
-		loc2 = loc1;
-
-		copy = 1;
-		while (1) {
-			size_t val2_off;
-
-			rc = settings_next_line_ctx(&loc2);
-
-			if (rc || loc2.len == 0) {
-				/* try to amend new value to */
-				/* the compressed file */
-				break;
-			}
-
-			rc = settings_line_name_read(name2, sizeof(name2),
-						     &val2_off, &loc2);
-			if (rc) {
-				/* try to process next line */
-				continue;
-			}
-			if ((val1_off == val2_off) &&
-			    !memcmp(name1, name2, val1_off)) {
-				copy = 0; /* newer version doesn't exist */
-				break;
-			}
-		}
-		if (!copy) {
+		/* skip the line if a newer version exists */
+		if (settings_file_check_duplicate(cf, &loc1, name1)) {
 			continue;
 		}
 
@@ -346,6 +517,10 @@ static int settings_file_save_and_compress(struct settings_file *cf,
 
 	rc = fs_close(&wf);
 	rc2 = fs_close(&rf);
+
+	/* Rebuilt on the next use for the compressed file */
+	settings_file_index_invalidate();
+
 	if (rc == 0 && rc2 == 0) {
 		if (fs_rename(tmp_file, cf->cf_name)) {
 			return -ENOENT;
@@ -364,6 +539,7 @@ end_rolback:
 	if (fs_close(&rf) == 0) {
 		(void)fs_unlink(tmp_file);
 	}
+	settings_file_index_invalidate();
 	return -EIO;
 
 }
@@ -400,10 +576,17 @@ static int settings_file_save_priv(struct settings_store *cs, const char *name,
 		rc = fs_seek(&file, 0, FS_SEEK_END);
 		if (rc == 0) {
 			entry_ctx.stor_ctx = &file;
+			/* name follows the length field */
+			entry_ctx.seek = fs_tell(&file) + sizeof(uint16_t);
+			entry_ctx.len = settings_line_len_calc(name, val_len);
 			rc = settings_line_write(name, value, val_len, 0,
 						  (void *)&entry_ctx);
 			if (rc == 0) {
 				cf->cf_lines++;
+				settings_file_index_update(cf, name,
+							   &entry_ctx);
+			} else {
+				settings_file_index_invalidate();
 			}
 		}
 
@@ -436,7 +619,11 @@ static int settings_file_save(struct settings_store *cs, const char *name,
 	cdca.val = (char *)value;
 	cdca.is_dup = 0;
 	cdca.val_len = val_len;
-	settings_file_load_priv(cs, settings_line_dup_check_cb, &cdca, false);
+	if (settings_file_index_dup_check(CONTAINER_OF(cs, struct settings_file, cf_store),
+					  &cdca)) {
+		settings_file_load_priv(cs, settings_line_dup_check_cb, &cdca,
+					false);
+	}
 	if (cdca.is_dup == 1) {
 		return 0;
 	}
@@ -0,0 +1,145 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+
+#include <zephyr/settings/settings.h>
+#include <zephyr/sys/hash_function.h>
+#include "settings_priv.h"
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(settings, CONFIG_SETTINGS_LOG_LEVEL);
+
+BUILD_ASSERT(IS_POWER_OF_TWO(CONFIG_SETTINGS_LINE_INDEX_SIZE),
+	     "CONFIG_SETTINGS_LINE_INDEX_SIZE must be a power of two");
+
+/*
+ * The index is an open addressing hash table with linear probing. Only the
+ * hash of a name is kept, so a matching hash is confirmed by reading the name
+ * of the record from the storage.
+ */
+
+static uint16_t settings_line_index_hash(const char *name)
+{
+	uint32_t hash = sys_hash32(name, strlen(name));
+
+	return (uint16_t)(hash ^ (hash >> 16));
+}
+
+static bool settings_line_index_name_eq(struct settings_line_index *idx,
+					const struct settings_line_index_entry *entry,
+					const char *name, void *ctx)
+{
+	char name2[SETTINGS_MAX_NAME_LEN + SETTINGS_EXTRA_LEN + 1];
+	size_t name2_len;
+
+	if (idx->name_read(ctx, entry, name2, sizeof(name2) - 1, &name2_len)) {
+		return false;
+	}
+	name2[name2_len] = '\0';
+
+	return !strcmp(name, name2);
+}
+
+static struct settings_line_index_entry *settings_line_index_lookup(
+	struct settings_line_index *idx, const char *name, uint16_t hash,
+	void *ctx, uint16_t *free_slot)
+{
+	uint16_t mask = idx->size - 1;
+	uint16_t i = hash & mask;
+
+	/* The table is never full, so there is always a free entry */
+	while (idx->entries[i].len != 0) {
+		if (idx->entries[i].hash == hash &&
+		    settings_line_index_name_eq(idx, &idx->entries[i], name, ctx)) {
+			return &idx->entries[i];
+		}
+		i = (i + 1) & mask;
+	}
+
+	*free_slot = i;
+
+	return NULL;
+}
+
+void settings_line_index_reset(struct settings_line_index *idx,
+			       const void *owner)
+{
+	(void)memset(idx->entries, 0, idx->size * sizeof(idx->entries[0]));
+	idx->count = 0;
+	idx->full = false;
+	idx->owner = owner;
+}
+
+struct settings_line_index_entry *settings_line_index_find(
+	struct settings_line_index *idx, const char *name, void *ctx)
+{
+	uint16_t free_slot;
+
+	return settings_line_index_lookup(idx, name,
+					  settings_line_index_hash(name), ctx,
+					  &free_slot);
+}
+
+int settings_line_index_set(struct settings_line_index *idx, const char *name,
+			    uint32_t loc, uint16_t len, void *ctx)
+{
+	struct settings_line_index_entry *entry;
+	uint16_t hash = settings_line_index_hash(name);
+	uint16_t free_slot;
+
+	entry = settings_line_index_lookup(idx, name, hash, ctx, &free_slot);
+	if (entry == NULL) {
+		/* Keep a quarter of the table free for short probe sequences */
+		if (idx->count >= idx->size - idx->size / 4) {
+			if (!idx->full) {
+				LOG_WRN("settings index is full, falling back "
+					"to storage scans");
+			}
+			idx->full = true;
+			return -ENOMEM;
+		}
+
+		entry = &idx->entries[free_slot];
+		entry->hash = hash;
+		idx->count++;
+	}
+
+	entry->loc = loc;
+	entry->len = len;
+
+	return 0;
+}
+
+void settings_line_index_remove(struct settings_line_index *idx,
+				struct settings_line_index_entry *entry)
+{
+	uint16_t mask = idx->size - 1;
+	uint16_t hole = entry - idx->entries;
+	uint16_t i = hole;
+
+	/*
+	 * Shift the following entries of the probe sequence back, so that no
+	 * lookup stops at the removed entry before reaching them.
+	 */
+	while (true) {
+		uint16_t home;
+
+		i = (i + 1) & mask;
+		if (idx->entries[i].len == 0) {
+			break;
+		}
+
+		home = idx->entries[i].hash & mask;
+		if (((i - home) & mask) >= ((i - hole) & mask)) {
+			idx->entries[hole] = idx->entries[i];
+			hole = i;
+		}
+	}
+
+	idx->entries[hole].len = 0;
+	idx->count--;
+}
@@ -106,6 +106,55 @@ void settings_line_io_init(int (*read_cb)(void *ctx, off_t off, char *buf,
 			  size_t (*get_len_cb)(void *ctx),
 			  uint8_t io_rwbs);
 
+#ifdef CONFIG_SETTINGS_LINE_INDEX
+/* Location of the newest record of a name, entries with len 0 are free */
+struct settings_line_index_entry {
+	uint32_t loc; /* back-end specific record location */
+	uint16_t len; /* record length */
+	uint16_t hash; /* name hash */
+};
+
+struct settings_line_index {
+	struct settings_line_index_entry *entries;
+	uint16_t size; /* number of entries, a power of two */
+	uint16_t count; /* number of used entries */
+	const void *owner; /* store the index was built for, NULL if not built */
+	bool full; /* some names did not fit, the index can't be used */
+	/*
+	 * Read the name of the record at the location of entry, ctx is passed
+	 * through from the index calls.
+	 */
+	int (*name_read)(void *ctx, const struct settings_line_index_entry *entry,
+			 char *name, size_t len_req, size_t *len_read);
+};
+
+/* Forget all entries and start building the index for the owner store */
+void settings_line_index_reset(struct settings_line_index *idx,
+			       const void *owner);
+
+static inline bool settings_line_index_ready(const struct settings_line_index *idx,
+					     const void *owner)
+{
+	return idx->owner == owner && !idx->full;
+}
+
+static inline void settings_line_index_invalidate(struct settings_line_index *idx)
+{
+	idx->owner = NULL;
+}
+
+/* Find the entry of the newest record of name, NULL if there is none */
+struct settings_line_index_entry *settings_line_index_find(
+	struct settings_line_index *idx, const char *name, void *ctx);
+
+/* Record that the newest record of name is at loc */
+int settings_line_index_set(struct settings_line_index *idx, const char *name,
+			    uint32_t loc, uint16_t len, void *ctx);
+
+void settings_line_index_remove(struct settings_line_index *idx,
+				struct settings_line_index_entry *entry);
+#endif
+
 
 extern sys_slist_t settings_load_srcs;
 extern sys_slist_t settings_handlers;
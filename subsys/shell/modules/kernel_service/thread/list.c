@@ -69,8 +69,12 @@ static void shell_tdata_dump(const struct k_thread *cthread, void *user_data)
 	const char *tname;
 	int ret;
 	char state_str[32];
+	k_ticks_t timeout = 0;
 
 	tname = k_thread_name_get(thread);
+#ifdef CONFIG_SYS_CLOCK_EXISTS
+	timeout = k_thread_timeout_remaining_ticks(thread);
+#endif /* CONFIG_SYS_CLOCK_EXISTS */
 
 	shell_print(sh, "%s%p %-10s",
 		    (thread == k_current_get()) ? "*" : " ",
@@ -80,7 +84,7 @@ static void shell_tdata_dump(const struct k_thread *cthread, void *user_data)
 	shell_print(sh, "\toptions: 0x%x, priority: %d timeout: %" PRId64,
 		    thread->base.user_options,
 		    thread->base.prio,
-		    (int64_t)thread->base.timeout.dticks);
+		    (int64_t)timeout);
 	shell_print(sh, "\tstate: %s, entry: %p",
 		    k_thread_state_str(thread, state_str, sizeof(state_str)),
 		    thread->entry.pEntry);
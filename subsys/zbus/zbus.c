@@ -8,6 +8,7 @@
 #include <zephyr/sys/iterable_sections.h>
 #include <zephyr/logging/log.h>
 #include <zephyr/sys/printk.h>
+#include <zephyr/sys/barrier.h>
 #include <zephyr/net_buf.h>
 #include <zephyr/zbus/zbus.h>
 LOG_MODULE_REGISTER(zbus, CONFIG_ZBUS_LOG_LEVEL);
@@ -52,6 +53,42 @@ static inline struct net_buf *_zbus_create_net_buf(struct net_buf_pool *pool, si
 
 #endif /* CONFIG_ZBUS_MSG_SUBSCRIBER */
 
+static inline bool loan_chan(const struct zbus_channel *chan)
+{
+#if defined(CONFIG_ZBUS_CHANNEL_LOAN)
+	return chan->data->loan_refs != NULL;
+#else
+	ARG_UNUSED(chan);
+
+	return false;
+#endif /* CONFIG_ZBUS_CHANNEL_LOAN */
+}
+
+#if defined(CONFIG_ZBUS_CHANNEL_LOAN)
+
+static inline bool loan_slot_valid(const struct zbus_channel *chan, const void *msg)
+{
+	uintptr_t offset = (uintptr_t)msg - (uintptr_t)chan->message;
+
+	return (uintptr_t)msg >= (uintptr_t)chan->message &&
+	       offset < chan->data->loan_slots * chan->message_size &&
+	       offset % chan->message_size == 0;
+}
+
+static inline atomic_val_t loan_slot_idx(const struct zbus_channel *chan, const void *msg)
+{
+	return ((const uint8_t *)msg - (const uint8_t *)chan->message) / chan->message_size;
+}
+
+static void loan_slot_put(const struct zbus_channel *chan, atomic_val_t idx)
+{
+	if (atomic_dec(&chan->data->loan_refs[idx]) == 1) {
+		k_sem_give(&chan->data->loan_sem);
+	}
+}
+
+#endif /* CONFIG_ZBUS_CHANNEL_LOAN */
+
 int _zbus_init(void)
 {
 
@@ -122,6 +159,44 @@ const struct zbus_channel *zbus_chan_from_id(uint32_t channel_id)
 
 #endif /* CONFIG_ZBUS_CHANNEL_ID */
 
+#if defined(CONFIG_ZBUS_MSG_SUBSCRIBER)
+
+static inline struct net_buf_pool *msg_sub_pool(const struct zbus_channel *chan)
+{
+	return COND_CODE_1(CONFIG_ZBUS_MSG_SUBSCRIBER_NET_BUF_POOL_ISOLATION,
+			   (chan->data->msg_subscriber_pool), (&_zbus_msg_subscribers_pool));
+}
+
+static struct net_buf *msg_sub_buf_get(const struct zbus_channel *chan, struct net_buf *buf,
+				       k_timepoint_t end_time)
+{
+#if defined(CONFIG_ZBUS_CHANNEL_LOAN)
+	if (loan_chan(chan)) {
+		/* The subscriber gets a reference to the published slot instead of a copy. The
+		 * slot is kept until the subscriber has read the message.
+		 */
+		atomic_val_t idx = atomic_get(&chan->data->loan_current);
+		struct net_buf *ref_buf =
+			net_buf_alloc_with_data(msg_sub_pool(chan), _zbus_chan_loan_slot(chan, idx),
+						zbus_chan_msg_size(chan), sys_timepoint_timeout(end_time));
+
+		if (ref_buf == NULL) {
+			return NULL;
+		}
+
+		atomic_inc(&chan->data->loan_refs[idx]);
+
+		memcpy(net_buf_user_data(ref_buf), &chan, sizeof(struct zbus_channel *));
+
+		return ref_buf;
+	}
+#endif /* CONFIG_ZBUS_CHANNEL_LOAN */
+
+	return net_buf_clone(buf, sys_timepoint_timeout(end_time));
+}
+
+#endif /* CONFIG_ZBUS_MSG_SUBSCRIBER */
+
 static inline int _zbus_notify_observer(const struct zbus_channel *chan,
 					const struct zbus_observer *obs, k_timepoint_t end_time,
 					struct net_buf *buf)
@@ -136,7 +211,7 @@ static inline int _zbus_notify_observer(const struct zbus_channel *chan,
 	}
 #if defined(CONFIG_ZBUS_MSG_SUBSCRIBER)
 	case ZBUS_OBSERVER_MSG_SUBSCRIBER_TYPE: {
-		struct net_buf *cloned_buf = net_buf_clone(buf, sys_timepoint_timeout(end_time));
+		struct net_buf *cloned_buf = msg_sub_buf_get(chan, buf, end_time);
 
 		if (cloned_buf == NULL) {
 			return -ENOMEM;
@@ -165,18 +240,18 @@ static inline int _zbus_vded_exec(const struct zbus_channel *chan, k_timepoint_t
 	struct zbus_channel_observation_mask *observation_mask;
 
 #if defined(CONFIG_ZBUS_MSG_SUBSCRIBER)
-	struct net_buf_pool *pool =
-		COND_CODE_1(CONFIG_ZBUS_MSG_SUBSCRIBER_NET_BUF_POOL_ISOLATION,
-			    (chan->data->msg_subscriber_pool), (&_zbus_msg_subscribers_pool));
+	/* Loan channels hand a reference to the published slot to each message subscriber */
+	if (!loan_chan(chan)) {
+		buf = _zbus_create_net_buf(msg_sub_pool(chan), zbus_chan_msg_size(chan),
+					   sys_timepoint_timeout(end_time));
 
-	buf = _zbus_create_net_buf(pool, zbus_chan_msg_size(chan), sys_timepoint_timeout(end_time));
+		_ZBUS_ASSERT(buf != NULL, "net_buf zbus_msg_subscribers_pool is "
+					  "unavailable or heap is full");
 
-	_ZBUS_ASSERT(buf != NULL, "net_buf zbus_msg_subscribers_pool is "
-				  "unavailable or heap is full");
+		memcpy(net_buf_user_data(buf), &chan, sizeof(struct zbus_channel *));
 
-	memcpy(net_buf_user_data(buf), &chan, sizeof(struct zbus_channel *));
-
-	net_buf_add_mem(buf, zbus_chan_msg(chan), zbus_chan_msg_size(chan));
+		net_buf_add_mem(buf, zbus_chan_msg(chan), zbus_chan_msg_size(chan));
+	}
 #endif /* CONFIG_ZBUS_MSG_SUBSCRIBER */
 
 	LOG_DBG("Notifing %s's observers. Starting VDED:", _ZBUS_CHAN_NAME(chan));
@@ -203,7 +278,7 @@ static inline int _zbus_vded_exec(const struct zbus_channel *chan, k_timepoint_t
 			LOG_ERR("could not deliver notification to observer %s. Error code %d",
 				_ZBUS_OBS_NAME(obs), err);
 			if (err == -ENOMEM) {
-				if (IS_ENABLED(CONFIG_ZBUS_MSG_SUBSCRIBER)) {
+				if (IS_ENABLED(CONFIG_ZBUS_MSG_SUBSCRIBER) && buf != NULL) {
 					net_buf_unref(buf);
 				}
 				return err;
@@ -232,7 +307,9 @@ static inline int _zbus_vded_exec(const struct zbus_channel *chan, k_timepoint_t
 	}
 #endif /* CONFIG_ZBUS_RUNTIME_OBSERVERS */
 
-	IF_ENABLED(CONFIG_ZBUS_MSG_SUBSCRIBER, (net_buf_unref(buf);))
+	if (IS_ENABLED(CONFIG_ZBUS_MSG_SUBSCRIBER) && buf != NULL) {
+		net_buf_unref(buf);
+	}
 
 	return last_error;
 }
@@ -389,6 +466,21 @@ int zbus_chan_pub(const struct zbus_channel *chan, const void *msg, k_timeout_t
 
 	k_timepoint_t end_time = sys_timepoint_calc(timeout);
 
+#if defined(CONFIG_ZBUS_CHANNEL_LOAN)
+	if (loan_chan(chan)) {
+		void *slot;
+
+		err = zbus_chan_loan(chan, &slot, timeout);
+		if (err) {
+			return err;
+		}
+
+		memcpy(slot, msg, chan->message_size);
+
+		return zbus_chan_pub_loan(chan, slot, sys_timepoint_timeout(end_time));
+	}
+#endif /* CONFIG_ZBUS_CHANNEL_LOAN */
+
 	if (chan->validator != NULL && !chan->validator(msg, chan->message_size)) {
 		return -ENOMSG;
 	}
@@ -414,6 +506,123 @@ int zbus_chan_pub(const struct zbus_channel *chan, const void *msg, k_timeout_t
 	return err;
 }
 
+#if defined(CONFIG_ZBUS_CHANNEL_LOAN)
+
+static void loan_chan_read(const struct zbus_channel *chan, void *msg)
+{
+	atomic_val_t seq;
+
+	/* A slot is only given back after the sequence counter has changed, so the copy is
+	 * consistent if the counter is the same before and after it.
+	 */
+	do {
+		seq = atomic_get(&chan->data->loan_seq);
+
+		memcpy(msg, _zbus_chan_loan_slot(chan, atomic_get(&chan->data->loan_current)),
+		       chan->message_size);
+
+		barrier_dmem_fence_full();
+	} while (seq != atomic_get(&chan->data->loan_seq));
+}
+
+int zbus_chan_loan(const struct zbus_channel *chan, void **msg, k_timeout_t timeout)
+{
+	_ZBUS_ASSERT(chan != NULL, "chan is required");
+	_ZBUS_ASSERT(loan_chan(chan), "chan must be a loan channel");
+	_ZBUS_ASSERT(msg != NULL, "msg is required");
+	_ZBUS_ASSERT(k_is_in_isr() ? K_TIMEOUT_EQ(timeout, K_NO_WAIT) : true,
+		     "inside an ISR, the timeout must be K_NO_WAIT");
+
+	if (k_is_in_isr()) {
+		timeout = K_NO_WAIT;
+	}
+
+	int err = k_sem_take(&chan->data->loan_sem, timeout);
+
+	if (err) {
+		return err;
+	}
+
+	/* The semaphore guarantees there is an unreferenced slot left */
+	for (atomic_val_t i = 0; i < chan->data->loan_slots; ++i) {
+		if (atomic_cas(&chan->data->loan_refs[i], 0, 1)) {
+			*msg = _zbus_chan_loan_slot(chan, i);
+
+			return 0;
+		}
+	}
+
+	k_sem_give(&chan->data->loan_sem);
+
+	_ZBUS_ASSERT(false, "Unreachable");
+
+	return -EBUSY;
+}
+
+int zbus_chan_pub_loan(const struct zbus_channel *chan, void *msg, k_timeout_t timeout)
+{
+	int err;
+
+	_ZBUS_ASSERT(chan != NULL, "chan is required");
+	_ZBUS_ASSERT(loan_chan(chan), "chan must be a loan channel");
+	_ZBUS_ASSERT(msg != NULL && loan_slot_valid(chan, msg), "msg must be a loaned slot");
+	_ZBUS_ASSERT(k_is_in_isr() ? K_TIMEOUT_EQ(timeout, K_NO_WAIT) : true,
+		     "inside an ISR, the timeout must be K_NO_WAIT");
+
+	if (k_is_in_isr()) {
+		timeout = K_NO_WAIT;
+	}
+
+	k_timepoint_t end_time = sys_timepoint_calc(timeout);
+	atomic_val_t idx = loan_slot_idx(chan, msg);
+
+	if (chan->validator != NULL && !chan->validator(msg, chan->message_size)) {
+		loan_slot_put(chan, idx);
+
+		return -ENOMSG;
+	}
+
+	int context_priority = ZBUS_MIN_THREAD_PRIORITY;
+
+	err = chan_lock(chan, timeout, &context_priority);
+	if (err) {
+		loan_slot_put(chan, idx);
+
+		return err;
+	}
+
+#if defined(CONFIG_ZBUS_CHANNEL_PUBLISH_STATS)
+	chan->data->publish_timestamp = k_uptime_ticks();
+	chan->data->publish_count += 1;
+#endif /* CONFIG_ZBUS_CHANNEL_PUBLISH_STATS */
+
+	/* The channel takes over the reference of the loan. The previous message is only
+	 * dropped after the sequence counter tells the readers it was replaced.
+	 */
+	idx = atomic_set(&chan->data->loan_current, idx);
+	atomic_inc(&chan->data->loan_seq);
+	loan_slot_put(chan, idx);
+
+	err = _zbus_vded_exec(chan, end_time);
+
+	chan_unlock(chan, context_priority);
+
+	return err;
+}
+
+int zbus_chan_loan_discard(const struct zbus_channel *chan, void *msg)
+{
+	_ZBUS_ASSERT(chan != NULL, "chan is required");
+	_ZBUS_ASSERT(loan_chan(chan), "chan must be a loan channel");
+	_ZBUS_ASSERT(msg != NULL && loan_slot_valid(chan, msg), "msg must be a loaned slot");
+
+	loan_slot_put(chan, loan_slot_idx(chan, msg));
+
+	return 0;
+}
+
+#endif /* CONFIG_ZBUS_CHANNEL_LOAN */
+
 int zbus_chan_read(const struct zbus_channel *chan, void *msg, k_timeout_t timeout)
 {
 	_ZBUS_ASSERT(chan != NULL, "chan is required");
@@ -425,6 +634,14 @@ int zbus_chan_read(const struct zbus_channel *chan, void *msg, k_timeout_t timeo
 		timeout = K_NO_WAIT;
 	}
 
+#if defined(CONFIG_ZBUS_CHANNEL_LOAN)
+	if (loan_chan(chan)) {
+		loan_chan_read(chan, msg);
+
+		return 0;
+	}
+#endif /* CONFIG_ZBUS_CHANNEL_LOAN */
+
 	int err = k_sem_take(&chan->data->sem, timeout);
 	if (err) {
 		return err;
@@ -528,6 +745,13 @@ int zbus_sub_wait_msg(const struct zbus_observer *sub, const struct zbus_channel
 
 	memcpy(msg, net_buf_remove_mem(buf, zbus_chan_msg_size(*chan)), zbus_chan_msg_size(*chan));
 
+#if defined(CONFIG_ZBUS_CHANNEL_LOAN)
+	if (loan_chan(*chan)) {
+		/* Drop the reference to the slot the message was read from */
+		loan_slot_put(*chan, loan_slot_idx(*chan, buf->__buf));
+	}
+#endif /* CONFIG_ZBUS_CHANNEL_LOAN */
+
 	net_buf_unref(buf);
 
 	return 0;
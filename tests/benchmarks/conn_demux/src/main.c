@@ -0,0 +1,208 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * @file
+ * This file contains tests that will measure the length of time required
+ * by net_conn_input() to find the connection a received UDP packet belongs
+ * to, while a varying number of connections is registered. Packets are
+ * handed to net_conn_input() directly, with their IPv4 and UDP headers
+ * already parsed, so only the connection lookup itself is measured.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/timing/timing.h>
+#include <zephyr/net/net_if.h>
+#include <zephyr/net/net_pkt.h>
+#include <zephyr/net/dummy.h>
+#include <zephyr/tc_util.h>
+#include <stdio.h>
+#include "connection.h"
+#include "utils.h"
+
+#define NUM_PAIRS (CONFIG_NET_MAX_CONN / 2)
+#define BASE_PORT 20000
+#define PEER_PORT 5683
+
+static struct in_addr my_addr = { { { 192, 0, 2, 1 } } };
+static struct in_addr peer_addr = { { { 192, 0, 2, 2 } } };
+
+static struct net_conn_handle *handles[2 * NUM_PAIRS];
+static uint32_t delivered;
+
+static struct net_ipv4_hdr ipv4_hdr;
+static struct net_udp_hdr udp_hdr;
+
+static int dummy_send(const struct device *dev, struct net_pkt *pkt)
+{
+	ARG_UNUSED(dev);
+	ARG_UNUSED(pkt);
+
+	return 0;
+}
+
+static void dummy_iface_init(struct net_if *iface)
+{
+	static uint8_t mac[] = { 0x00, 0x00, 0x5e, 0x00, 0x53, 0x01 };
+
+	net_if_set_link_addr(iface, mac, sizeof(mac), NET_LINK_ETHERNET);
+}
+
+static struct dummy_api dummy_api = {
+	.iface_api.init = dummy_iface_init,
+	.send = dummy_send,
+};
+
+NET_DEVICE_INIT(conn_demux_dummy, "conn_demux_dummy", NULL, NULL, NULL, NULL,
+		CONFIG_KERNEL_INIT_PRIORITY_DEFAULT, &dummy_api, DUMMY_L2,
+		NET_L2_GET_CTX_TYPE(DUMMY_L2), 127);
+
+/* Consumes nothing, so the same packet can be demultiplexed again */
+static enum net_verdict demux_cb(struct net_conn *conn, struct net_pkt *pkt,
+				 union net_ip_header *ip_hdr,
+				 union net_proto_header *proto_hdr,
+				 void *user_data)
+{
+	ARG_UNUSED(conn);
+	ARG_UNUSED(pkt);
+	ARG_UNUSED(ip_hdr);
+	ARG_UNUSED(proto_hdr);
+	ARG_UNUSED(user_data);
+
+	delivered++;
+
+	return NET_OK;
+}
+
+/* Registers pair i: a socket connected to the peer and one bound to a port */
+static int register_pair(unsigned int i)
+{
+	struct sockaddr_in local = {
+		.sin_family = AF_INET,
+		.sin_addr = my_addr,
+	};
+	struct sockaddr_in any = {
+		.sin_family = AF_INET,
+	};
+	struct sockaddr_in remote = {
+		.sin_family = AF_INET,
+		.sin_addr = peer_addr,
+	};
+	int ret;
+
+	ret = net_conn_register(IPPROTO_UDP, AF_INET, (struct sockaddr *)&remote,
+				(struct sockaddr *)&local, PEER_PORT, BASE_PORT + 2 * i,
+				NULL, demux_cb, NULL, &handles[2 * i]);
+	if (ret < 0) {
+		return ret;
+	}
+
+	return net_conn_register(IPPROTO_UDP, AF_INET, NULL, (struct sockaddr *)&any,
+				 0, BASE_PORT + 2 * i + 1, NULL, demux_cb, NULL,
+				 &handles[2 * i + 1]);
+}
+
+static uint64_t time_demux(struct net_pkt *pkt, uint16_t dst_port)
+{
+	union net_ip_header ip_hdr = { .ipv4 = &ipv4_hdr };
+	union net_proto_header proto_hdr = { .udp = &udp_hdr };
+	timing_t start;
+	timing_t finish;
+
+	udp_hdr.dst_port = htons(dst_port);
+	delivered = 0;
+
+	start = timing_counter_get();
+	for (int i = 0; i < CONFIG_BENCHMARK_NUM_ITERATIONS; i++) {
+		(void)net_conn_input(pkt, &ip_hdr, IPPROTO_UDP, &proto_hdr);
+	}
+	finish = timing_counter_get();
+
+	if (delivered != CONFIG_BENCHMARK_NUM_ITERATIONS) {
+		printk("Only %u of %u packets delivered to port %u\n", delivered,
+		       CONFIG_BENCHMARK_NUM_ITERATIONS, dst_port);
+		return 0;
+	}
+
+	return timing_cycles_get(&start, &finish) / CONFIG_BENCHMARK_NUM_ITERATIONS;
+}
+
+static void report(const char *kind, unsigned int num_conns, uint64_t cycles)
+{
+	char description[80];
+
+	snprintf(description, sizeof(description), "Demux to %s socket, %u connections",
+		 kind, num_conns);
+
+#ifdef CONFIG_BENCHMARK_RECORDING
+	printk("REC: net.conn_demux.%s.%u - %s : %7llu cycles , %7u ns :\n", kind,
+	       num_conns, description, cycles, (uint32_t)timing_cycles_to_ns(cycles));
+#else
+	PRINT_F(description, (uint32_t)cycles, (uint32_t)timing_cycles_to_ns(cycles));
+#endif
+}
+
+int main(void)
+{
+	struct net_if *iface = net_if_get_first_by_type(&NET_L2_GET_NAME(DUMMY));
+	unsigned int num_pairs = 0;
+	struct net_pkt *pkt;
+	bool failed = false;
+
+	timing_init();
+
+	TC_START("conn_demux");
+	printk("Connection lookup: %s\n",
+	       IS_ENABLED(CONFIG_NET_CONN_HASH) ? "hash index" : "linear scan");
+
+	pkt = net_pkt_alloc_on_iface(iface, K_FOREVER);
+	net_pkt_set_family(pkt, AF_INET);
+
+	net_ipv4_addr_copy_raw(ipv4_hdr.src, (uint8_t *)&peer_addr);
+	net_ipv4_addr_copy_raw(ipv4_hdr.dst, (uint8_t *)&my_addr);
+	ipv4_hdr.proto = IPPROTO_UDP;
+	udp_hdr.src_port = htons(PEER_PORT);
+
+	timing_start();
+
+	for (unsigned int target = 1; target <= NUM_PAIRS; target *= 2) {
+		uint64_t connected;
+		uint64_t bound;
+
+		for (; num_pairs < target; num_pairs++) {
+			if (register_pair(num_pairs) < 0) {
+				printk("Cannot register connection pair %u\n", num_pairs);
+				failed = true;
+				break;
+			}
+		}
+
+		/* Pair 0 is the oldest, so the last one visited by a scan */
+		connected = time_demux(pkt, BASE_PORT);
+		bound = time_demux(pkt, BASE_PORT + 1);
+		if (failed || connected == 0 || bound == 0) {
+			failed = true;
+			break;
+		}
+
+		if (IS_ENABLED(CONFIG_BENCHMARK_VERBOSE) || target * 2 > NUM_PAIRS) {
+			report("connected", 2 * num_pairs, connected);
+			report("bound", 2 * num_pairs, bound);
+		}
+	}
+
+	timing_stop();
+
+	for (unsigned int i = 0; i < 2 * num_pairs; i++) {
+		net_conn_unregister(handles[i]);
+	}
+
+	net_pkt_unref(pkt);
+
+	TC_END_REPORT(failed ? TC_FAIL : 0);
+
+	return 0;
+}
@@ -0,0 +1,162 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * @file
+ * This file contains tests that will measure the length of time required
+ * to compute CRC32 (IEEE) and CRC32C (Castagnoli) checksums over buffers
+ * of increasing size with the CRC engine selected at build time. The
+ * engine is first checked against a bit-by-bit reference implementation.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/timing/timing.h>
+#include <zephyr/sys/crc.h>
+#include <zephyr/tc_util.h>
+#include "utils.h"
+#include <stdio.h>
+
+#define CRC32_IEEE_POLY 0xEDB88320U
+#define CRC32C_POLY     0x82F63B78U
+#define MIN_BUFFER_SIZE 16
+
+/* One spare byte so that measured buffers start unaligned */
+static uint8_t buffer[CONFIG_BENCHMARK_BUFFER_SIZE + 1] __aligned(8);
+
+typedef uint32_t (*crc_fn_t)(const uint8_t *data, size_t len);
+
+static uint32_t crc32_c_oneshot(const uint8_t *data, size_t len)
+{
+	return crc32_c(0, data, len, true, true);
+}
+
+static const struct {
+	const char *name;
+	crc_fn_t fn;
+	uint32_t poly;
+} crcs[] = {
+	{ "crc32_ieee", crc32_ieee, CRC32_IEEE_POLY },
+	{ "crc32_c", crc32_c_oneshot, CRC32C_POLY },
+};
+
+static const char *engine_name(void)
+{
+	if (IS_ENABLED(CONFIG_CRC32_SLICE_BY_8)) {
+		return IS_ENABLED(CONFIG_CRC32_HW) ? "slicing-by-8 + hw" : "slicing-by-8";
+	} else if (IS_ENABLED(CONFIG_CRC32_SLICE_BY_4)) {
+		return IS_ENABLED(CONFIG_CRC32_HW) ? "slicing-by-4 + hw" : "slicing-by-4";
+	} else if (IS_ENABLED(CONFIG_CRC32_BYTE_TABLE)) {
+		return IS_ENABLED(CONFIG_CRC32_HW) ? "byte table + hw" : "byte table";
+	}
+	return IS_ENABLED(CONFIG_CRC32_HW) ? "nibble table + hw" : "nibble table";
+}
+
+static uint32_t reference_crc(uint32_t poly, const uint8_t *data, size_t len)
+{
+	uint32_t crc = 0xffffffffU;
+
+	for (size_t i = 0; i < len; i++) {
+		crc ^= data[i];
+		for (int bit = 0; bit < 8; bit++) {
+			crc = (crc >> 1) ^ ((crc & 1U) ? poly : 0U);
+		}
+	}
+
+	return ~crc;
+}
+
+static bool check_engine(void)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(crcs); i++) {
+		for (size_t offset = 0; offset < 8; offset++) {
+			for (size_t len = 0; len < 64; len++) {
+				const uint8_t *data = &buffer[offset];
+
+				if (crcs[i].fn(data, len) != reference_crc(crcs[i].poly, data, len)) {
+					printk("%s mismatch at offset %u, length %u\n", crcs[i].name,
+					       (unsigned int)offset, (unsigned int)len);
+					return false;
+				}
+			}
+		}
+	}
+
+	return true;
+}
+
+static uint64_t time_crc(crc_fn_t fn, const uint8_t *data, size_t len)
+{
+	volatile uint32_t sink;
+	timing_t start;
+	timing_t finish;
+
+	start = timing_counter_get();
+	for (int i = 0; i < CONFIG_BENCHMARK_NUM_ITERATIONS; i++) {
+		sink = fn(data, len);
+	}
+	finish = timing_counter_get();
+
+	ARG_UNUSED(sink);
+
+	return timing_cycles_get(&start, &finish) / CONFIG_BENCHMARK_NUM_ITERATIONS;
+}
+
+static void report(const char *name, size_t len, uint64_t cycles)
+{
+	/* Throughput in thousandths of a byte per cycle */
+	uint32_t milli = (cycles != 0) ? (uint32_t)((len * 1000ULL) / cycles) : 0;
+	char description[80];
+
+	snprintf(description, sizeof(description), "%s %u bytes (%u.%03u bytes/cycle)",
+		 name, (unsigned int)len, milli / 1000, milli % 1000);
+
+#ifdef CONFIG_BENCHMARK_RECORDING
+	printk("REC: crc.%s.%u - %s : %7llu cycles , %7u ns :\n", name, (unsigned int)len,
+	       description, cycles, (uint32_t)timing_cycles_to_ns(cycles));
+#else
+	PRINT_F(description, (uint32_t)cycles, (uint32_t)timing_cycles_to_ns(cycles));
+#endif
+}
+
+int main(void)
+{
+	uint32_t seed = 0x12345678U;
+
+	for (size_t i = 0; i < sizeof(buffer); i++) {
+		seed = seed * 1103515245U + 12345U;
+		buffer[i] = seed >> 24;
+	}
+
+	timing_init();
+
+	TC_START("crc");
+	printk("CRC32 engine: %s\n", engine_name());
+
+	if (!check_engine()) {
+		TC_END_REPORT(TC_FAIL);
+		return 0;
+	}
+
+	timing_start();
+
+	for (size_t i = 0; i < ARRAY_SIZE(crcs); i++) {
+		for (size_t len = MIN_BUFFER_SIZE; len <= CONFIG_BENCHMARK_BUFFER_SIZE;
+		     len *= 2) {
+			if (!IS_ENABLED(CONFIG_BENCHMARK_VERBOSE) &&
+			    (len * 2 <= CONFIG_BENCHMARK_BUFFER_SIZE)) {
+				continue;
+			}
+
+			report(crcs[i].name, len, time_crc(crcs[i].fn, &buffer[1], len));
+		}
+	}
+
+	timing_stop();
+
+	TC_END_REPORT(0);
+
+	return 0;
+}
@@ -0,0 +1,86 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Compare the Hashmap implementations on a table of sparse 64-bit keys, like
+ * session ids: average cycles of each operation and the slowest insertion,
+ * which includes the rehashing of the table.
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/sys/hash_map.h>
+
+#define NUM_ENTRIES CONFIG_BENCHMARK_NUM_ENTRIES
+
+SYS_HASHMAP_SC_DEFINE_STATIC(sc_map);
+SYS_HASHMAP_OA_LP_DEFINE_STATIC(oa_lp_map);
+SYS_HASHMAP_SWISS_DEFINE_STATIC(swiss_map);
+
+static uint64_t key_of(uint32_t i)
+{
+	/* spread consecutive indices over the whole key space */
+	return (i + 1) * 0x9e3779b97f4a7c15ULL;
+}
+
+static void run(const char *name, struct sys_hashmap *map)
+{
+	uint32_t insert_max = 0;
+	uint64_t insert = 0;
+	uint64_t hit = 0;
+	uint64_t miss = 0;
+	uint64_t remove = 0;
+	uint64_t value;
+	uint32_t start;
+	uint32_t cycles;
+	int ret;
+
+	for (uint32_t i = 0; i < NUM_ENTRIES; i++) {
+		start = k_cycle_get_32();
+		ret = sys_hashmap_insert(map, key_of(i), i, NULL);
+		cycles = k_cycle_get_32() - start;
+
+		zassert_equal(ret, 1, "%s: insert failed: %d", name, ret);
+		insert += cycles;
+		insert_max = MAX(insert_max, cycles);
+	}
+
+	for (uint32_t i = 0; i < NUM_ENTRIES; i++) {
+		start = k_cycle_get_32();
+		zassert_true(sys_hashmap_get(map, key_of(i), &value));
+		hit += k_cycle_get_32() - start;
+		zassert_equal(value, i);
+	}
+
+	for (uint32_t i = NUM_ENTRIES; i < 2 * NUM_ENTRIES; i++) {
+		start = k_cycle_get_32();
+		zassert_false(sys_hashmap_get(map, key_of(i), NULL));
+		miss += k_cycle_get_32() - start;
+	}
+
+	for (uint32_t i = 0; i < NUM_ENTRIES; i++) {
+		start = k_cycle_get_32();
+		zassert_true(sys_hashmap_remove(map, key_of(i), NULL));
+		remove += k_cycle_get_32() - start;
+	}
+
+	zassert_true(sys_hashmap_is_empty(map));
+
+	printk("%-8s insert %6u, get hit %6u, get miss %6u, remove %6u cycles, "
+	       "slowest insert %8u cycles\n",
+	       name, (uint32_t)(insert / NUM_ENTRIES), (uint32_t)(hit / NUM_ENTRIES),
+	       (uint32_t)(miss / NUM_ENTRIES), (uint32_t)(remove / NUM_ENTRIES), insert_max);
+}
+
+ZTEST(hashmap_perf, test_hashmap_perf)
+{
+	printk("%u entries\n", NUM_ENTRIES);
+
+	run("sc", &sc_map);
+	run("oa_lp", &oa_lp_map);
+	run("swiss", &swiss_map);
+}
+
+ZTEST_SUITE(hashmap_perf, NULL, NULL, NULL, NULL, NULL);
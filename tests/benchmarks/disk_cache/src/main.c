@@ -0,0 +1,194 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Cycles per file read and write of FAT and ext2 on a RAM disk, and of ext2
+ * on a loopback disk backed by a file on the FAT RAM disk, accessed
+ * sequentially and at random offsets. Run with and without the disk block
+ * cache to compare.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+#include <zephyr/fs/fs.h>
+#include <zephyr/storage/disk_access.h>
+#include <zephyr/drivers/loopback_disk.h>
+#include <ff.h>
+
+#define FILE_SIZE   (CONFIG_BENCHMARK_FILE_SIZE * 1024)
+#define BLOCK_SIZE  CONFIG_BENCHMARK_BLOCK_SIZE
+#define RANDOM_OPS  CONFIG_BENCHMARK_RANDOM_OPS
+#define NUM_BLOCKS  (FILE_SIZE / BLOCK_SIZE)
+
+#define FAT_DISK    "RAM"
+#define EXT2_DISK   "EXT"
+#define LOOP_DISK   "LOOP"
+#define FAT_MNT     "/" FAT_DISK ":"
+#define EXT2_MNT    "/ext"
+#define LOOP_IMAGE  FAT_MNT "/loop.img"
+
+static FATFS fat_fs;
+static struct fs_mount_t fat_mnt = {
+	.type = FS_FATFS,
+	.mnt_point = FAT_MNT,
+	.fs_data = &fat_fs,
+};
+
+static struct fs_mount_t ext2_mnt = {
+	.type = FS_EXT2,
+	.mnt_point = EXT2_MNT,
+};
+
+static struct loopback_disk_access loop_access;
+static uint8_t block[BLOCK_SIZE];
+static uint32_t rand_state;
+
+/* Same sequence of offsets in every run */
+static uint32_t next_block(void)
+{
+	rand_state = rand_state * 1103515245U + 12345U;
+
+	return (rand_state >> 16) % NUM_BLOCKS;
+}
+
+static void report(const char *name, const char *op, uint64_t cycles, uint32_t count)
+{
+	printk("%-14s %-13s %8u cycles per %u bytes\n", name, op, (uint32_t)(cycles / count),
+	       BLOCK_SIZE);
+}
+
+static void report_stats(const char *disk)
+{
+#ifdef CONFIG_DISK_CACHE_STATS
+	struct disk_cache_stats stats;
+
+	zassert_ok(disk_access_cache_stats(disk, &stats));
+	printk("%-14s hits %u, misses %u, read ahead %u, written back %u\n", disk, stats.hits,
+	       stats.misses, stats.read_ahead, stats.write_backs);
+	zassert_ok(disk_access_cache_stats_reset(disk));
+#else
+	ARG_UNUSED(disk);
+#endif
+}
+
+static void bench_file(const char *name, const char *path, const char *disk)
+{
+	struct fs_file_t file;
+	uint64_t cycles;
+	uint32_t start;
+
+	fs_file_t_init(&file);
+	zassert_ok(fs_open(&file, path, FS_O_CREATE | FS_O_RDWR));
+
+	cycles = 0;
+	for (int i = 0; i < NUM_BLOCKS; i++) {
+		memset(block, i, sizeof(block));
+		start = k_cycle_get_32();
+		zassert_equal(BLOCK_SIZE, fs_write(&file, block, sizeof(block)));
+		cycles += k_cycle_get_32() - start;
+	}
+	start = k_cycle_get_32();
+	zassert_ok(fs_sync(&file));
+	cycles += k_cycle_get_32() - start;
+	report(name, "seq write", cycles, NUM_BLOCKS);
+	report_stats(disk);
+
+	zassert_ok(fs_seek(&file, 0, FS_SEEK_SET));
+	cycles = 0;
+	for (int i = 0; i < NUM_BLOCKS; i++) {
+		start = k_cycle_get_32();
+		zassert_equal(BLOCK_SIZE, fs_read(&file, block, sizeof(block)));
+		cycles += k_cycle_get_32() - start;
+		zassert_equal((uint8_t)i, block[0]);
+	}
+	report(name, "seq read", cycles, NUM_BLOCKS);
+	report_stats(disk);
+
+	rand_state = 1U;
+	cycles = 0;
+	for (int i = 0; i < RANDOM_OPS; i++) {
+		uint32_t n = next_block();
+
+		start = k_cycle_get_32();
+		zassert_ok(fs_seek(&file, n * BLOCK_SIZE, FS_SEEK_SET));
+		zassert_equal(BLOCK_SIZE, fs_read(&file, block, sizeof(block)));
+		cycles += k_cycle_get_32() - start;
+		zassert_equal((uint8_t)n, block[0]);
+	}
+	report(name, "random read", cycles, RANDOM_OPS);
+	report_stats(disk);
+
+	cycles = 0;
+	for (int i = 0; i < RANDOM_OPS; i++) {
+		uint32_t n = next_block();
+
+		memset(block, n, sizeof(block));
+		start = k_cycle_get_32();
+		zassert_ok(fs_seek(&file, n * BLOCK_SIZE, FS_SEEK_SET));
+		zassert_equal(BLOCK_SIZE, fs_write(&file, block, sizeof(block)));
+		cycles += k_cycle_get_32() - start;
+	}
+	start = k_cycle_get_32();
+	zassert_ok(fs_sync(&file));
+	cycles += k_cycle_get_32() - start;
+	report(name, "random write", cycles, RANDOM_OPS);
+	report_stats(disk);
+
+	zassert_ok(fs_close(&file));
+	zassert_ok(fs_unlink(path));
+}
+
+static void bench_ext2(const char *name, const char *disk)
+{
+	ext2_mnt.storage_dev = (void *)disk;
+	zassert_ok(fs_mkfs(FS_EXT2, (uintptr_t)disk, NULL, 0));
+	zassert_ok(fs_mount(&ext2_mnt));
+	report_stats(disk);
+
+	bench_file(name, EXT2_MNT "/bench", disk);
+
+	zassert_ok(fs_unmount(&ext2_mnt));
+}
+
+ZTEST(disk_cache, test_fat_ramdisk)
+{
+	bench_file("fat ramdisk", FAT_MNT "/bench", FAT_DISK);
+}
+
+ZTEST(disk_cache, test_ext2_ramdisk)
+{
+	bench_ext2("ext2 ramdisk", EXT2_DISK);
+}
+
+ZTEST(disk_cache, test_ext2_loopback)
+{
+	bench_ext2("ext2 loopback", LOOP_DISK);
+	report_stats(FAT_DISK);
+}
+
+static void *disk_cache_setup(void)
+{
+	struct fs_file_t file;
+
+	zassert_ok(fs_mkfs(FS_FATFS, (uintptr_t)FAT_DISK, NULL, 0));
+	zassert_ok(fs_mount(&fat_mnt));
+
+	/* The loopback disk image lives on the FAT RAM disk */
+	memset(block, 0, sizeof(block));
+	fs_file_t_init(&file);
+	zassert_ok(fs_open(&file, LOOP_IMAGE, FS_O_CREATE | FS_O_WRITE));
+	for (int i = 0; i < CONFIG_BENCHMARK_LOOPBACK_SIZE * 1024 / BLOCK_SIZE; i++) {
+		zassert_equal(BLOCK_SIZE, fs_write(&file, block, sizeof(block)));
+	}
+	zassert_ok(fs_close(&file));
+	zassert_ok(loopback_disk_access_register(&loop_access, LOOP_IMAGE, LOOP_DISK));
+
+	report_stats(FAT_DISK);
+
+	return NULL;
+}
+
+ZTEST_SUITE(disk_cache, NULL, disk_cache_setup, NULL, NULL, NULL);
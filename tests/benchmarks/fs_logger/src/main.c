@@ -0,0 +1,177 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Sampling jitter and throughput of a data logger sampling at a fixed period
+ * and appending the records to a file on littlefs on the simulated flash.
+ * Full blocks of records are either written with fs_write() by the sampling
+ * thread, or queued with fs_write_async() while it keeps sampling.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+#include <zephyr/fs/fs.h>
+#include <zephyr/fs/littlefs.h>
+#include <zephyr/rtio/rtio.h>
+#include <zephyr/storage/flash_map.h>
+
+#define PERIOD_US         CONFIG_BENCHMARK_SAMPLE_PERIOD_US
+#define NUM_SAMPLES       CONFIG_BENCHMARK_NUM_SAMPLES
+#define RECORD_SIZE       CONFIG_BENCHMARK_RECORD_SIZE
+#define BLOCK_SIZE        CONFIG_BENCHMARK_BLOCK_SIZE
+#define NUM_BLOCKS        CONFIG_BENCHMARK_NUM_BLOCKS
+#define RECORDS_PER_BLOCK (BLOCK_SIZE / RECORD_SIZE)
+
+BUILD_ASSERT(BLOCK_SIZE % RECORD_SIZE == 0, "Blocks must hold whole records");
+
+#define LOG_MNT  "/lfs"
+#define LOG_FILE LOG_MNT "/log.bin"
+
+FS_LITTLEFS_DECLARE_DEFAULT_CONFIG(log_lfs);
+static struct fs_mount_t log_mnt = {
+	.type = FS_LITTLEFS,
+	.fs_data = &log_lfs,
+	.storage_dev = (void *)FIXED_PARTITION_ID(log_partition),
+	.mnt_point = LOG_MNT,
+};
+
+RTIO_DEFINE(log_rtio, NUM_BLOCKS, NUM_BLOCKS);
+K_TIMER_DEFINE(sample_timer, NULL, NULL);
+
+static uint8_t blocks[NUM_BLOCKS][BLOCK_SIZE];
+
+struct logger_stats {
+	uint32_t max_jitter_us;
+	uint64_t total_jitter_us;
+	uint32_t missed;
+	uint32_t stalls;
+};
+
+static void complete_write(struct rtio_cqe *cqe)
+{
+	zassert_equal(BLOCK_SIZE, cqe->result, "write failed (%d)", cqe->result);
+	rtio_cqe_release(&log_rtio, cqe);
+}
+
+static void write_block(struct fs_file_t *file, bool async, const uint8_t *block,
+			uint32_t *queued, struct logger_stats *stats)
+{
+	struct rtio_cqe *cqe;
+
+	if (!async) {
+		zassert_equal(BLOCK_SIZE, fs_write(file, block, BLOCK_SIZE));
+		return;
+	}
+
+	while ((cqe = rtio_cqe_consume(&log_rtio)) != NULL) {
+		complete_write(cqe);
+		(*queued)--;
+	}
+
+	zassert_ok(fs_write_async(&log_rtio, file, block, BLOCK_SIZE, NULL));
+	(*queued)++;
+
+	/*
+	 * Blocks are written in order, so the next one to fill is free once
+	 * the oldest queued write completes.
+	 */
+	if (*queued == NUM_BLOCKS) {
+		stats->stalls++;
+		complete_write(rtio_cqe_consume_block(&log_rtio));
+		(*queued)--;
+	}
+}
+
+static void run_logger(const char *name, bool async)
+{
+	struct logger_stats stats = {0};
+	struct fs_file_t file;
+	uint32_t queued = 0;
+	uint32_t start;
+	uint32_t prev;
+	uint32_t now;
+	uint32_t elapsed_us;
+	int block = 0;
+	int record = 0;
+
+	fs_file_t_init(&file);
+	zassert_ok(fs_open(&file, LOG_FILE, FS_O_CREATE | FS_O_WRITE));
+
+	k_timer_start(&sample_timer, K_USEC(PERIOD_US), K_USEC(PERIOD_US));
+	start = k_cycle_get_32();
+	prev = start;
+
+	for (uint32_t n = 0; n < NUM_SAMPLES; n++) {
+		uint32_t expired = k_timer_status_sync(&sample_timer);
+		uint32_t interval_us;
+		uint32_t jitter_us;
+
+		now = k_cycle_get_32();
+		interval_us = k_cyc_to_us_near32(now - prev);
+		jitter_us = (interval_us > PERIOD_US) ? interval_us - PERIOD_US
+						      : PERIOD_US - interval_us;
+		prev = now;
+
+		stats.max_jitter_us = MAX(stats.max_jitter_us, jitter_us);
+		stats.total_jitter_us += jitter_us;
+		stats.missed += expired - 1;
+
+		/* The sample, its timestamp repeated over the record */
+		for (int i = 0; i < RECORD_SIZE; i += sizeof(now)) {
+			memcpy(&blocks[block][record * RECORD_SIZE + i], &now, sizeof(now));
+		}
+
+		if (++record == RECORDS_PER_BLOCK) {
+			write_block(&file, async, blocks[block], &queued, &stats);
+			block = (block + 1) % NUM_BLOCKS;
+			record = 0;
+		}
+	}
+
+	k_timer_stop(&sample_timer);
+
+	while (queued > 0) {
+		complete_write(rtio_cqe_consume_block(&log_rtio));
+		queued--;
+	}
+	zassert_ok(fs_sync(&file));
+	elapsed_us = k_cyc_to_us_near32(k_cycle_get_32() - start);
+
+	zassert_ok(fs_close(&file));
+	zassert_ok(fs_unlink(LOG_FILE));
+
+	printk("%-5s: jitter max %u us avg %u us, %u periods missed, %u stalls, %u B/s\n", name,
+	       stats.max_jitter_us, (uint32_t)(stats.total_jitter_us / NUM_SAMPLES), stats.missed,
+	       stats.stalls,
+	       (uint32_t)((uint64_t)NUM_SAMPLES / RECORDS_PER_BLOCK * BLOCK_SIZE * USEC_PER_SEC /
+			  elapsed_us));
+}
+
+ZTEST(fs_logger, test_sync)
+{
+	run_logger("sync", false);
+}
+
+ZTEST(fs_logger, test_async)
+{
+	run_logger("async", true);
+}
+
+static void *fs_logger_setup(void)
+{
+	zassert_ok(fs_mount(&log_mnt));
+
+	return NULL;
+}
+
+static void fs_logger_teardown(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	fs_unmount(&log_mnt);
+}
+
+ZTEST_SUITE(fs_logger, NULL, fs_logger_setup, NULL, NULL, fs_logger_teardown);
@@ -0,0 +1,206 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Measure the JSON parsing throughput on a hawkBit deployment base document,
+ * decoded with descriptors like the hawkBit client does, and parsed by the
+ * streaming parser in one piece and in chunks.
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/data/json.h>
+
+static const char deployment_base[] =
+	"{\"id\":\"8\",\"deployment\":{\"download\":\"forced\",\"update\":\"forced\","
+	"\"maintenanceWindow\":\"available\",\"chunks\":[{\"part\":\"os\",\"version\":\"1.0.2\","
+	"\"name\":\"zephyr\",\"artifacts\":[{\"filename\":\"zephyr.signed.bin\","
+	"\"hashes\":{\"sha1\":\"5a1f3f9ec6a2b5e38e5e1b0a1e6d0f2c9b7c4d11\","
+	"\"md5\":\"0d9b2f6f3a7e5c1b8e4a6d2c9f0b1a3e\","
+	"\"sha256\":\"b9c8e1f0a2d3c4b5a6978877665544332211ffeeddccbbaa0099887766554433\"},"
+	"\"size\":262144,\"_links\":{\"download-http\":{\"href\":"
+	"\"http://hawkbit.example.com:8080/DEFAULT/controller/v1/zephyr-device/"
+	"softwaremodules/8/artifacts/zephyr.signed.bin\"},\"md5sum-http\":{\"href\":"
+	"\"http://hawkbit.example.com:8080/DEFAULT/controller/v1/zephyr-device/"
+	"softwaremodules/8/artifacts/zephyr.signed.bin.MD5SUM\"}}}],"
+	"\"metadata\":[{\"key\":\"board\",\"value\":\"frdm_k64f\"},"
+	"{\"key\":\"release\",\"value\":\"stable\"}]}]},"
+	"\"actionHistory\":{\"status\":\"RUNNING\",\"messages\":["
+	"\"Reboot\",\"Update Server: Target retrieved update action and should start now "
+	"the download.\"]}}";
+
+struct href {
+	const char *href;
+};
+
+struct dep_hashes {
+	const char *sha1;
+	const char *md5;
+	const char *sha256;
+};
+
+struct dep_links {
+	struct href download_http;
+	struct href md5sum_http;
+};
+
+struct dep_artifact {
+	const char *filename;
+	struct dep_hashes hashes;
+	struct dep_links _links;
+	int size;
+};
+
+struct dep_chunk {
+	const char *part;
+	const char *name;
+	const char *version;
+	struct dep_artifact artifacts[1];
+	size_t num_artifacts;
+};
+
+struct dep_deploy {
+	const char *download;
+	const char *update;
+	struct dep_chunk chunks[1];
+	size_t num_chunks;
+};
+
+struct dep_res {
+	const char *id;
+	struct dep_deploy deployment;
+};
+
+static const struct json_obj_descr href_descr[] = {
+	JSON_OBJ_DESCR_PRIM(struct href, href, JSON_TOK_STRING),
+};
+
+static const struct json_obj_descr dep_hashes_descr[] = {
+	JSON_OBJ_DESCR_PRIM(struct dep_hashes, sha1, JSON_TOK_STRING),
+	JSON_OBJ_DESCR_PRIM(struct dep_hashes, md5, JSON_TOK_STRING),
+	JSON_OBJ_DESCR_PRIM(struct dep_hashes, sha256, JSON_TOK_STRING),
+};
+
+static const struct json_obj_descr dep_links_descr[] = {
+	JSON_OBJ_DESCR_OBJECT_NAMED(struct dep_links, "download-http", download_http, href_descr),
+	JSON_OBJ_DESCR_OBJECT_NAMED(struct dep_links, "md5sum-http", md5sum_http, href_descr),
+};
+
+static const struct json_obj_descr dep_artifact_descr[] = {
+	JSON_OBJ_DESCR_PRIM(struct dep_artifact, filename, JSON_TOK_STRING),
+	JSON_OBJ_DESCR_OBJECT(struct dep_artifact, hashes, dep_hashes_descr),
+	JSON_OBJ_DESCR_PRIM(struct dep_artifact, size, JSON_TOK_NUMBER),
+	JSON_OBJ_DESCR_OBJECT(struct dep_artifact, _links, dep_links_descr),
+};
+
+static const struct json_obj_descr dep_chunk_descr[] = {
+	JSON_OBJ_DESCR_PRIM(struct dep_chunk, part, JSON_TOK_STRING),
+	JSON_OBJ_DESCR_PRIM(struct dep_chunk, version, JSON_TOK_STRING),
+	JSON_OBJ_DESCR_PRIM(struct dep_chunk, name, JSON_TOK_STRING),
+	JSON_OBJ_DESCR_OBJ_ARRAY(struct dep_chunk, artifacts, 1, num_artifacts,
+				 dep_artifact_descr, ARRAY_SIZE(dep_artifact_descr)),
+};
+
+static const struct json_obj_descr dep_deploy_descr[] = {
+	JSON_OBJ_DESCR_PRIM(struct dep_deploy, download, JSON_TOK_STRING),
+	JSON_OBJ_DESCR_PRIM(struct dep_deploy, update, JSON_TOK_STRING),
+	JSON_OBJ_DESCR_OBJ_ARRAY(struct dep_deploy, chunks, 1, num_chunks, dep_chunk_descr,
+				 ARRAY_SIZE(dep_chunk_descr)),
+};
+
+static const struct json_obj_descr dep_res_descr[] = {
+	JSON_OBJ_DESCR_PRIM(struct dep_res, id, JSON_TOK_STRING),
+	JSON_OBJ_DESCR_OBJECT(struct dep_res, deployment, dep_deploy_descr),
+};
+
+static char payload[sizeof(deployment_base)];
+static char stream_buf[256];
+static size_t num_events;
+
+static void report(const char *name, uint64_t cycles)
+{
+	uint64_t ns = k_cyc_to_ns_ceil64(cycles);
+	uint64_t bytes = (uint64_t)(sizeof(deployment_base) - 1) * CONFIG_BENCHMARK_ITERATIONS;
+	/* bytes per ns is GB/s, keep two decimals of MB/s */
+	uint64_t rate = ns > 0 ? bytes * 100000U / ns : 0;
+
+	printk("%-28s %6u.%02u MB/s\n", name, (unsigned int)(rate / 100U),
+	       (unsigned int)(rate % 100U));
+}
+
+ZTEST(json_benchmark, test_obj_parse)
+{
+	struct dep_res res;
+	uint64_t cycles = 0;
+	uint32_t start;
+	int64_t ret;
+
+	for (int i = 0; i < CONFIG_BENCHMARK_ITERATIONS; i++) {
+		/* The parser terminates the strings in place */
+		memcpy(payload, deployment_base, sizeof(payload));
+
+		start = k_cycle_get_32();
+		ret = json_obj_parse(payload, sizeof(payload) - 1, dep_res_descr,
+				     ARRAY_SIZE(dep_res_descr), &res);
+		cycles += k_cycle_get_32() - start;
+
+		zassert_equal(ret, BIT_MASK(ARRAY_SIZE(dep_res_descr)), "parsing failed: %lld",
+			      ret);
+	}
+
+	zassert_str_equal(res.deployment.chunks[0].artifacts[0].filename, "zephyr.signed.bin");
+	zassert_equal(res.deployment.chunks[0].artifacts[0].size, 262144);
+
+	report("json_obj_parse", cycles);
+}
+
+static int count_event(const struct json_stream_event *event, void *user_data)
+{
+	ARG_UNUSED(event);
+	ARG_UNUSED(user_data);
+
+	num_events++;
+
+	return 0;
+}
+
+static void stream_parse(const char *name, size_t chunk_size)
+{
+	struct json_stream stream;
+	const size_t len = sizeof(deployment_base) - 1;
+	uint64_t cycles = 0;
+	uint32_t start;
+	int ret = 0;
+
+	for (int i = 0; i < CONFIG_BENCHMARK_ITERATIONS; i++) {
+		num_events = 0;
+
+		start = k_cycle_get_32();
+		json_stream_init(&stream, stream_buf, sizeof(stream_buf), count_event, NULL);
+		for (size_t off = 0; off < len && ret == 0; off += chunk_size) {
+			ret = json_stream_feed(&stream, &deployment_base[off],
+					       MIN(chunk_size, len - off));
+		}
+		if (ret == 0) {
+			ret = json_stream_finish(&stream);
+		}
+		cycles += k_cycle_get_32() - start;
+
+		zassert_equal(ret, 0, "parsing failed: %d", ret);
+	}
+
+	zassert_equal(num_events, 51, "unexpected number of values: %zu", num_events);
+
+	report(name, cycles);
+}
+
+ZTEST(json_benchmark, test_stream)
+{
+	stream_parse("json_stream, 1 chunk", sizeof(deployment_base));
+	stream_parse("json_stream, 64 byte chunks", 64);
+	stream_parse("json_stream, 16 byte chunks", 16);
+}
+
+ZTEST_SUITE(json_benchmark, NULL, NULL, NULL, NULL, NULL);
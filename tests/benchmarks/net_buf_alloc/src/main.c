@@ -0,0 +1,96 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Average cycles to allocate and free a network buffer, one buffer at a time
+ * and as chains allocated with one bulk call and freed with one unref.
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/net_buf.h>
+
+#define NUM_BUFS       CONFIG_BENCHMARK_NUM_BUFS
+#define NUM_ITERATIONS CONFIG_BENCHMARK_NUM_ITERATIONS
+#define BUF_SIZE       64
+
+NET_BUF_POOL_FIXED_DEFINE(bench_pool, NUM_BUFS, BUF_SIZE, 0, NULL);
+
+#if defined(CONFIG_NET_BUF_POOL_CACHE)
+static struct net_buf_pool_cache bench_pool_cache;
+#endif
+
+static struct net_buf *bufs[NUM_BUFS];
+
+static void report(const char *name, uint64_t alloc, uint64_t unref)
+{
+	uint32_t count = NUM_BUFS * NUM_ITERATIONS;
+
+	printk("%-8s alloc %6u, free %6u cycles per buffer\n", name,
+	       (uint32_t)(alloc / count), (uint32_t)(unref / count));
+}
+
+ZTEST(net_buf_alloc, test_single)
+{
+	uint64_t alloc = 0;
+	uint64_t unref = 0;
+	uint32_t start;
+
+	for (int i = 0; i < NUM_ITERATIONS; i++) {
+		start = k_cycle_get_32();
+		for (int j = 0; j < NUM_BUFS; j++) {
+			bufs[j] = net_buf_alloc(&bench_pool, K_NO_WAIT);
+		}
+		alloc += k_cycle_get_32() - start;
+
+		for (int j = 0; j < NUM_BUFS; j++) {
+			zassert_not_null(bufs[j], "Failed to get buffer");
+		}
+
+		start = k_cycle_get_32();
+		for (int j = 0; j < NUM_BUFS; j++) {
+			net_buf_unref(bufs[j]);
+		}
+		unref += k_cycle_get_32() - start;
+	}
+
+	report("single", alloc, unref);
+}
+
+ZTEST(net_buf_alloc, test_bulk)
+{
+	struct net_buf *chain;
+	uint64_t alloc = 0;
+	uint64_t unref = 0;
+	uint32_t start;
+
+	for (int i = 0; i < NUM_ITERATIONS; i++) {
+		start = k_cycle_get_32();
+		chain = net_buf_alloc_bulk(&bench_pool, NUM_BUFS, K_NO_WAIT);
+		alloc += k_cycle_get_32() - start;
+
+		zassert_not_null(chain, "Failed to get buffer chain");
+
+		start = k_cycle_get_32();
+		net_buf_unref(chain);
+		unref += k_cycle_get_32() - start;
+	}
+
+	report("bulk", alloc, unref);
+}
+
+static void *setup(void)
+{
+#if defined(CONFIG_NET_BUF_POOL_CACHE)
+	net_buf_pool_cache_init(&bench_pool, &bench_pool_cache);
+	printk("%u buffers, cache of %u buffers\n", NUM_BUFS,
+	       CONFIG_NET_BUF_POOL_CACHE_SIZE);
+#else
+	printk("%u buffers, no cache\n", NUM_BUFS);
+#endif
+	return NULL;
+}
+
+ZTEST_SUITE(net_buf_alloc, NULL, setup, NULL, NULL, NULL);
@@ -0,0 +1,116 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Measure the latency of NVS writes that keep updating a set of ids, so that
+ * sectors fill up and get garbage collected during the measurement. The
+ * flash simulator is set up to take as long as real flash for an erase.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <zephyr/ztest.h>
+
+#include <zephyr/drivers/flash.h>
+#include <zephyr/fs/nvs.h>
+#include <zephyr/storage/flash_map.h>
+
+#define TEST_NVS_FLASH_AREA		storage_partition
+#define TEST_NVS_FLASH_AREA_OFFSET	FIXED_PARTITION_OFFSET(TEST_NVS_FLASH_AREA)
+#define TEST_NVS_FLASH_AREA_ID		FIXED_PARTITION_ID(TEST_NVS_FLASH_AREA)
+#define TEST_SECTOR_COUNT		4U
+
+static struct nvs_fs fs;
+static uint32_t latency_us[CONFIG_BENCHMARK_NUM_WRITES];
+
+static void fill_data(uint8_t *data, uint32_t seq)
+{
+	for (size_t i = 0; i < CONFIG_BENCHMARK_DATA_SIZE; i++) {
+		data[i] = (uint8_t)(seq + i);
+	}
+}
+
+static int latency_cmp(const void *a, const void *b)
+{
+	uint32_t la = *(const uint32_t *)a;
+	uint32_t lb = *(const uint32_t *)b;
+
+	return (la > lb) - (la < lb);
+}
+
+static uint32_t percentile(unsigned int pct)
+{
+	size_t i = ((size_t)CONFIG_BENCHMARK_NUM_WRITES * pct) / 100U;
+
+	return latency_us[MIN(i, CONFIG_BENCHMARK_NUM_WRITES - 1)];
+}
+
+static void *setup(void)
+{
+	const struct flash_area *fa;
+	struct flash_pages_info info;
+	int err;
+
+	err = flash_area_open(TEST_NVS_FLASH_AREA_ID, &fa);
+	zassert_equal(err, 0, "flash_area_open() fail: %d", err);
+
+	fs.offset = TEST_NVS_FLASH_AREA_OFFSET;
+	fs.flash_device = flash_area_get_device(fa);
+	err = flash_get_page_info_by_offs(fs.flash_device, fs.offset, &info);
+	zassert_equal(err, 0, "Unable to get page info: %d", err);
+
+	fs.sector_size = info.size;
+	fs.sector_count = TEST_SECTOR_COUNT;
+
+	err = flash_area_flatten(fa, 0, fs.sector_size * fs.sector_count);
+	zassert_equal(err, 0, "Unable to erase the flash area: %d", err);
+
+	err = nvs_mount(&fs);
+	zassert_equal(err, 0, "nvs_mount call failure: %d", err);
+
+	return NULL;
+}
+
+ZTEST(nvs_write_latency, test_write_latency)
+{
+	uint8_t data[CONFIG_BENCHMARK_DATA_SIZE];
+	uint8_t rd_data[CONFIG_BENCHMARK_DATA_SIZE];
+	uint32_t start;
+	ssize_t len;
+
+	for (uint32_t i = 0; i < CONFIG_BENCHMARK_NUM_WRITES; i++) {
+		fill_data(data, i);
+
+		start = k_cycle_get_32();
+		len = nvs_write(&fs, i % CONFIG_BENCHMARK_NUM_IDS, data, sizeof(data));
+		latency_us[i] = k_cyc_to_us_ceil32(k_cycle_get_32() - start);
+
+		zassert_equal(len, sizeof(data), "nvs_write call failure: %zd", len);
+
+		k_msleep(CONFIG_BENCHMARK_WRITE_INTERVAL_MS);
+	}
+
+	/* the newest value of every id must have survived the garbage collections */
+	for (uint32_t i = CONFIG_BENCHMARK_NUM_WRITES - CONFIG_BENCHMARK_NUM_IDS;
+	     i < CONFIG_BENCHMARK_NUM_WRITES; i++) {
+		fill_data(data, i);
+
+		len = nvs_read(&fs, i % CONFIG_BENCHMARK_NUM_IDS, rd_data, sizeof(rd_data));
+		zassert_equal(len, sizeof(rd_data), "nvs_read call failure: %zd", len);
+		zassert_mem_equal(rd_data, data, sizeof(data), "unexpected data of id %u",
+				  i % CONFIG_BENCHMARK_NUM_IDS);
+	}
+
+	qsort(latency_us, ARRAY_SIZE(latency_us), sizeof(latency_us[0]), latency_cmp);
+
+	printk("NVS write latency, background gc %s, %u writes of %u bytes\n",
+	       IS_ENABLED(CONFIG_NVS_BACKGROUND_GC) ? "enabled" : "disabled",
+	       CONFIG_BENCHMARK_NUM_WRITES, CONFIG_BENCHMARK_DATA_SIZE);
+	printk("p50: %u us, p90: %u us, p99: %u us, max: %u us\n", percentile(50),
+	       percentile(90), percentile(99), latency_us[CONFIG_BENCHMARK_NUM_WRITES - 1]);
+}
+
+ZTEST_SUITE(nvs_write_latency, NULL, setup, NULL, NULL, NULL);
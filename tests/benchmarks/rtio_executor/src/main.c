@@ -0,0 +1,116 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Drive chains of register reads alternating between an emulated I2C and an
+ * emulated SPI device through one RTIO context, submitting on the caller's
+ * thread and through a worker per bus, and report the cycles per submission.
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/rtio/rtio.h>
+
+#define NUM_SQES   CONFIG_BENCHMARK_NUM_SQES
+#define CHAIN_LEN  CONFIG_BENCHMARK_CHAIN_LEN
+#define NUM_CHAINS 4
+#define BATCH      (NUM_CHAINS * CHAIN_LEN)
+#define REG_SIZE   8
+
+/* An emulated bus device, the transfer is done in the submit call */
+struct emul_dev {
+	uint8_t regs[REG_SIZE];
+	uint32_t transfers;
+};
+
+static void emul_dev_submit(struct rtio_iodev_sqe *iodev_sqe)
+{
+	struct emul_dev *dev = iodev_sqe->sqe.iodev->data;
+	struct rtio_sqe *sqe = &iodev_sqe->sqe;
+
+	if (sqe->op == RTIO_OP_RX) {
+		memcpy(sqe->rx.buf, dev->regs, MIN(sqe->rx.buf_len, REG_SIZE));
+	}
+	dev->transfers++;
+
+	rtio_iodev_sqe_ok(iodev_sqe, 0);
+}
+
+static const struct rtio_iodev_api emul_dev_api = {
+	.submit = emul_dev_submit,
+};
+
+static struct emul_dev i2c_dev_data;
+static struct emul_dev spi_dev_data;
+
+RTIO_IODEV_DEFINE(i2c_dev, &emul_dev_api, &i2c_dev_data);
+RTIO_IODEV_DEFINE(spi_dev, &emul_dev_api, &spi_dev_data);
+
+RTIO_IODEV_WORKER_DEFINE(i2c_worker, 1024, 3);
+RTIO_IODEV_WORKER_DEFINE(spi_worker, 1024, 3);
+
+RTIO_DEFINE(r_bench, BATCH, BATCH);
+
+static uint8_t bufs[BATCH][REG_SIZE];
+
+static void run(const char *name)
+{
+	struct rtio_sqe *sqe;
+	struct rtio_cqe *cqe;
+	uint64_t cycles = 0;
+	uint32_t start;
+	int n;
+
+	for (n = 0; n < NUM_SQES; n += BATCH) {
+		for (int i = 0; i < BATCH; i++) {
+			sqe = rtio_sqe_acquire(&r_bench);
+			zassert_not_null(sqe);
+			rtio_sqe_prep_read(sqe, (i & 1) ? &spi_dev : &i2c_dev, RTIO_PRIO_NORM,
+					   bufs[i], REG_SIZE, NULL);
+			if ((i % CHAIN_LEN) != CHAIN_LEN - 1) {
+				sqe->flags |= RTIO_SQE_CHAINED;
+			}
+		}
+
+		start = k_cycle_get_32();
+		zassert_ok(rtio_submit(&r_bench, BATCH));
+		cycles += k_cycle_get_32() - start;
+
+		for (int i = 0; i < BATCH; i++) {
+			cqe = rtio_cqe_consume(&r_bench);
+			zassert_not_null(cqe);
+			zassert_ok(cqe->result);
+			rtio_cqe_release(&r_bench, cqe);
+		}
+	}
+
+	printk("%-8s %6u cycles per submission\n", name, (uint32_t)(cycles / n));
+}
+
+ZTEST(rtio_executor, test_caller_thread)
+{
+	rtio_iodev_set_worker(&i2c_dev, NULL);
+	rtio_iodev_set_worker(&spi_dev, NULL);
+
+	run("caller");
+}
+
+ZTEST(rtio_executor, test_workers)
+{
+	rtio_iodev_set_worker(&i2c_dev, &i2c_worker);
+	rtio_iodev_set_worker(&spi_dev, &spi_worker);
+
+	run("workers");
+}
+
+static void *setup(void)
+{
+	printk("%u submissions in chains of %u, batch size %u\n", NUM_SQES, CHAIN_LEN,
+	       CONFIG_RTIO_WORKER_BATCH_SIZE);
+
+	return NULL;
+}
+
+ZTEST_SUITE(rtio_executor, NULL, setup, NULL, NULL, NULL);
@@ -236,6 +236,10 @@ int main(void)
 
 	bench_test_init();
 
+	if (IS_ENABLED(CONFIG_BENCHMARK_SWITCH_THROUGHPUT)) {
+		return switch_throughput_run();
+	}
+
 	freq = timing_freq_get_mhz();
 
 	printk("Time Measurements for %s sched queues\n",
@@ -0,0 +1,169 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * @file
+ * Context switch throughput. One pair of threads per CPU ping-pongs over a
+ * pair of semaphores for a fixed duration. Every round trip readies and
+ * pends two threads, so with several CPUs this puts all of them on the
+ * scheduler at once. The reported cost is the CPU time spent per round
+ * trip (elapsed cycles times the number of CPUs, divided by the number of
+ * round trips), which stays flat when the scheduler scales with the
+ * number of CPUs. Optionally, lower priority threads are kept ready for the
+ * whole run so that the ready queues are never empty while the pairs switch.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/tc_util.h>
+#include "utils.h"
+
+#define PAIR_STACK_SIZE (1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+#define PAIR_PRIORITY   1
+#define NUM_PAIRS       CONFIG_MP_MAX_NUM_CPUS
+#define QUEUED_PRIORITY (PAIR_PRIORITY + 1)
+#define NUM_QUEUED      CONFIG_BENCHMARK_SWITCH_QUEUED_THREADS
+
+static K_THREAD_STACK_ARRAY_DEFINE(ping_stack, NUM_PAIRS, PAIR_STACK_SIZE);
+static K_THREAD_STACK_ARRAY_DEFINE(pong_stack, NUM_PAIRS, PAIR_STACK_SIZE);
+static struct k_thread ping_thread[NUM_PAIRS];
+static struct k_thread pong_thread[NUM_PAIRS];
+
+static struct k_sem ping_sem[NUM_PAIRS];
+static struct k_sem pong_sem[NUM_PAIRS];
+static uint32_t round_trips[NUM_PAIRS];
+static atomic_t stop;
+
+#if NUM_QUEUED > 0
+static K_THREAD_STACK_ARRAY_DEFINE(queued_stack, NUM_QUEUED, PAIR_STACK_SIZE);
+static struct k_thread queued_thread[NUM_QUEUED];
+#endif
+
+static void ping_entry(void *p1, void *p2, void *p3)
+{
+	unsigned int i = (unsigned int)(uintptr_t)p1;
+
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	while (!atomic_get(&stop)) {
+		k_sem_give(&pong_sem[i]);
+		k_sem_take(&ping_sem[i], K_FOREVER);
+		round_trips[i]++;
+	}
+}
+
+static void pong_entry(void *p1, void *p2, void *p3)
+{
+	unsigned int i = (unsigned int)(uintptr_t)p1;
+
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	while (true) {
+		k_sem_take(&pong_sem[i], K_FOREVER);
+		k_sem_give(&ping_sem[i]);
+	}
+}
+
+static void queued_entry(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	while (!atomic_get(&stop)) {
+		/* Only runs while a CPU has no pair thread ready */
+	}
+}
+
+int switch_throughput_run(void)
+{
+	unsigned int num_cpus = arch_num_cpus();
+	uint64_t total = 0;
+	uint64_t cycles;
+	uint64_t per_trip;
+	timing_t start;
+	timing_t finish;
+	unsigned int i;
+
+	printk("Context switch throughput on %u CPU(s) with %s run queue(s), "
+	       "%u lower priority thread(s) ready\n",
+	       num_cpus, IS_ENABLED(CONFIG_SCHED_PER_CPU_RUNQ) ? "per-CPU" : "shared",
+	       NUM_QUEUED);
+
+#if NUM_QUEUED > 0
+	for (i = 0; i < NUM_QUEUED; i++) {
+		k_thread_create(&queued_thread[i], queued_stack[i], PAIR_STACK_SIZE,
+				queued_entry, NULL, NULL, NULL,
+				QUEUED_PRIORITY, 0, K_NO_WAIT);
+	}
+#endif
+
+	for (i = 0; i < num_cpus; i++) {
+		k_sem_init(&ping_sem[i], 0, 1);
+		k_sem_init(&pong_sem[i], 0, 1);
+		k_thread_create(&pong_thread[i], pong_stack[i], PAIR_STACK_SIZE,
+				pong_entry, (void *)(uintptr_t)i, NULL, NULL,
+				PAIR_PRIORITY, 0, K_NO_WAIT);
+	}
+
+	timing_start();
+	start = timing_counter_get();
+
+	for (i = 0; i < num_cpus; i++) {
+		k_thread_create(&ping_thread[i], ping_stack[i], PAIR_STACK_SIZE,
+				ping_entry, (void *)(uintptr_t)i, NULL, NULL,
+				PAIR_PRIORITY, 0, K_NO_WAIT);
+	}
+
+	k_sleep(K_MSEC(CONFIG_BENCHMARK_SWITCH_DURATION_MS));
+
+	atomic_set(&stop, 1);
+	finish = timing_counter_get();
+
+	for (i = 0; i < num_cpus; i++) {
+		total += round_trips[i];
+	}
+
+	for (i = 0; i < num_cpus; i++) {
+		k_thread_join(&ping_thread[i], K_FOREVER);
+		k_thread_abort(&pong_thread[i]);
+	}
+
+#if NUM_QUEUED > 0
+	for (i = 0; i < NUM_QUEUED; i++) {
+		k_thread_join(&queued_thread[i], K_FOREVER);
+	}
+#endif
+
+	timing_stop();
+
+	if (total == 0) {
+		printk("No round trips completed\n");
+		TC_END_REPORT(TC_FAIL);
+		return 0;
+	}
+
+	cycles = timing_cycles_get(&start, &finish);
+	per_trip = (cycles * num_cpus) / total;
+
+	printk("    Round trips : %llu in %u ms (%llu per second)\n", total,
+	       CONFIG_BENCHMARK_SWITCH_DURATION_MS,
+	       (total * MSEC_PER_SEC) / CONFIG_BENCHMARK_SWITCH_DURATION_MS);
+
+#ifdef CONFIG_BENCHMARK_RECORDING
+	printk("REC: sched.switch.roundtrip.%ucpu.%uqueued - Semaphore ping-pong round trip"
+	       " per CPU : %7llu cycles , %7u ns :\n",
+	       num_cpus, NUM_QUEUED, per_trip, (uint32_t)timing_cycles_to_ns(per_trip));
+#else
+	printk("    CPU time per round trip : %7llu cycles (%7u nsec)\n", per_trip,
+	       (uint32_t)timing_cycles_to_ns(per_trip));
+#endif
+
+	TC_END_REPORT(0);
+
+	return 0;
+}
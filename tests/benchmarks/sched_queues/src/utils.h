@@ -51,4 +51,6 @@
 		(uint32_t)timing_cycles_to_ns_avg(value, counter))
 
 
+int switch_throughput_run(void);
+
 #endif
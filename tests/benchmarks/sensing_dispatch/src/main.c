@@ -0,0 +1,92 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Cycles the sensing dispatch thread spends per sample of a physical sensor
+ * with a number of clients at 1, 2, 4 and 8 times the sensor interval.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+#include <zephyr/sensing/sensing.h>
+
+#define NUM_CLIENTS     CONFIG_BENCHMARK_NUM_CLIENTS
+#define SENSOR_INTERVAL (5 * USEC_PER_MSEC)
+
+extern const k_tid_t sensing_dispatch;
+
+struct client {
+	sensing_sensor_handle_t handle;
+	struct sensing_callback_list cb_list;
+	uint32_t count;
+};
+
+static struct client clients[NUM_CLIENTS];
+
+static void on_data_event(sensing_sensor_handle_t handle, const void *buf, void *context)
+{
+	struct client *client = context;
+
+	ARG_UNUSED(handle);
+	ARG_UNUSED(buf);
+
+	client->count++;
+}
+
+static void *sensing_dispatch_setup(void)
+{
+	const struct sensing_sensor_info *info;
+	struct sensing_sensor_config config = {
+		.attri = SENSING_SENSOR_ATTRIBUTE_INTERVAL,
+	};
+	int num;
+
+	zassert_ok(sensing_get_sensors(&num, &info));
+	zassert_equal(1, num);
+
+	for (int i = 0; i < NUM_CLIENTS; i++) {
+		clients[i].cb_list.on_data_event = on_data_event;
+		clients[i].cb_list.context = &clients[i];
+		zassert_ok(sensing_open_sensor(info, &clients[i].cb_list, &clients[i].handle));
+
+		config.interval = SENSOR_INTERVAL << (i % 4);
+		zassert_ok(sensing_set_config(clients[i].handle, &config, 1));
+	}
+
+	return NULL;
+}
+
+ZTEST(sensing_dispatch, test_dispatch)
+{
+	k_thread_runtime_stats_t start;
+	k_thread_runtime_stats_t end;
+	uint32_t events = 0;
+	uint32_t samples;
+
+	/* let the configuration settle */
+	k_msleep(100);
+
+	zassert_ok(k_thread_runtime_stats_get(sensing_dispatch, &start));
+	for (int i = 0; i < NUM_CLIENTS; i++) {
+		clients[i].count = 0;
+	}
+
+	k_msleep(CONFIG_BENCHMARK_DURATION_MS);
+
+	zassert_ok(k_thread_runtime_stats_get(sensing_dispatch, &end));
+	/* the first client gets every sample */
+	samples = clients[0].count;
+	for (int i = 0; i < NUM_CLIENTS; i++) {
+		events += clients[i].count;
+	}
+	zassert_true(samples > 0, "no samples dispatched");
+
+	printk("%d clients: %u samples, %u data events, %u cycles per sample\n", NUM_CLIENTS,
+	       samples, events, (uint32_t)((end.execution_cycles - start.execution_cycles) /
+					   samples));
+}
+
+ZTEST_SUITE(sensing_dispatch, NULL, sensing_dispatch_setup, NULL, NULL, NULL);
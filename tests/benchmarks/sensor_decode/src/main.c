@@ -0,0 +1,170 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Average cycles to decode a sample with a sensor_decode() call per frame,
+ * compared to decoding whole buffers into structure of arrays blocks with
+ * sensor_decode_block(), through the decoder's own decode_block() and
+ * through the generic fallback.
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/drivers/sensor.h>
+#include <zephyr/rtio/rtio.h>
+
+#include "icm42688_decoder.h"
+#include "icm42688_reg.h"
+
+#define NUM_FRAMES     CONFIG_BENCHMARK_NUM_FRAMES
+#define NUM_ITERATIONS CONFIG_BENCHMARK_NUM_ITERATIONS
+
+static const struct device *const icm42688 = DEVICE_DT_GET(DT_NODELABEL(icm42688));
+static const struct device *const bmi160 = DEVICE_DT_GET(DT_NODELABEL(bmi160));
+
+SENSOR_DT_READ_IODEV(bmi160_iodev, DT_NODELABEL(bmi160), {SENSOR_CHAN_ACCEL_XYZ, 0});
+RTIO_DEFINE(bench_rtio, 1, 1);
+
+static uint8_t fifo_buffer[sizeof(struct icm42688_fifo_data) + NUM_FRAMES * 16] __aligned(4);
+static uint8_t bmi160_buffer[128] __aligned(4);
+
+static uint32_t timestamp_delta[NUM_FRAMES];
+static q31_t x[NUM_FRAMES];
+static q31_t y[NUM_FRAMES];
+static q31_t z[NUM_FRAMES];
+static struct sensor_three_axis_data frame_out;
+
+static void report(const char *name, uint64_t cycles, uint32_t samples)
+{
+	printk("%-24s %6u cycles per sample\n", name, (uint32_t)(cycles / samples));
+}
+
+static uint64_t decode_frames(const struct sensor_decoder_api *decoder, const uint8_t *buffer,
+			      uint32_t *samples)
+{
+	uint64_t cycles = 0;
+	uint32_t start;
+	int rc;
+
+	*samples = 0;
+	for (int i = 0; i < NUM_ITERATIONS; i++) {
+		struct sensor_decode_context ctx =
+			SENSOR_DECODE_CONTEXT_INIT(decoder, buffer, SENSOR_CHAN_ACCEL_XYZ, 0);
+
+		start = k_cycle_get_32();
+		while ((rc = sensor_decode(&ctx, &frame_out, 1)) > 0) {
+			*samples += rc;
+		}
+		cycles += k_cycle_get_32() - start;
+	}
+
+	return cycles;
+}
+
+static uint64_t decode_blocks(const struct sensor_decoder_api *decoder, const uint8_t *buffer,
+			      bool generic, uint32_t *samples)
+{
+	struct sensor_q31_block block = {
+		.capacity = NUM_FRAMES,
+		.timestamp_delta = timestamp_delta,
+		.x = x,
+		.y = y,
+		.z = z,
+	};
+	uint64_t cycles = 0;
+	uint32_t start;
+	int rc;
+
+	*samples = 0;
+	for (int i = 0; i < NUM_ITERATIONS; i++) {
+		struct sensor_decode_context ctx =
+			SENSOR_DECODE_CONTEXT_INIT(decoder, buffer, SENSOR_CHAN_ACCEL_XYZ, 0);
+
+		start = k_cycle_get_32();
+		if (generic) {
+			while ((rc = sensor_decode_block_generic(decoder, buffer, ctx.channel,
+								 &ctx.fit, &block)) > 0) {
+				*samples += rc;
+			}
+		} else {
+			while ((rc = sensor_decode_block(&ctx, &block)) > 0) {
+				*samples += rc;
+			}
+		}
+		cycles += k_cycle_get_32() - start;
+	}
+
+	return cycles;
+}
+
+static void *sensor_decode_setup(void)
+{
+	struct icm42688_fifo_data *edata = (struct icm42688_fifo_data *)fifo_buffer;
+	uint8_t *frame = fifo_buffer + sizeof(*edata);
+
+	zassert_true(device_is_ready(icm42688));
+	zassert_true(device_is_ready(bmi160));
+
+	/* A full FIFO of 16 byte packets holding accel, gyro and temperature */
+	edata->header.is_fifo = true;
+	edata->header.accel_fs = ICM42688_DT_ACCEL_FS_4;
+	edata->header.gyro_fs = ICM42688_DT_GYRO_FS_500;
+	edata->accel_odr = ICM42688_DT_ACCEL_ODR_1000;
+	edata->gyro_odr = ICM42688_DT_GYRO_ODR_1000;
+	edata->fifo_count = NUM_FRAMES * 16;
+	for (int i = 0; i < NUM_FRAMES; i++, frame += 16) {
+		frame[0] = FIELD_PREP(FIFO_HEADER_ACCEL, 1) | FIELD_PREP(FIFO_HEADER_GYRO, 1);
+		for (int j = 1; j < 13; j++) {
+			frame[j] = (uint8_t)(i * 31 + j * 7);
+		}
+	}
+
+	/* The bmi160 has no decoder of its own and uses the default one */
+	zassert_ok(sensor_read(&bmi160_iodev, &bench_rtio, bmi160_buffer,
+			       sizeof(bmi160_buffer)));
+
+	return NULL;
+}
+
+ZTEST(sensor_decode, test_icm42688_fifo)
+{
+	const struct sensor_decoder_api *decoder;
+	uint32_t samples;
+	uint64_t cycles;
+
+	zassert_ok(sensor_get_decoder(icm42688, &decoder));
+
+	cycles = decode_frames(decoder, fifo_buffer, &samples);
+	zassert_equal(NUM_FRAMES * NUM_ITERATIONS, samples);
+	report("icm42688 per frame", cycles, samples);
+
+	cycles = decode_blocks(decoder, fifo_buffer, false, &samples);
+	zassert_equal(NUM_FRAMES * NUM_ITERATIONS, samples);
+	report("icm42688 block", cycles, samples);
+
+	cycles = decode_blocks(decoder, fifo_buffer, true, &samples);
+	zassert_equal(NUM_FRAMES * NUM_ITERATIONS, samples);
+	report("icm42688 block generic", cycles, samples);
+}
+
+ZTEST(sensor_decode, test_bmi160_one_shot)
+{
+	const struct sensor_decoder_api *decoder;
+	uint32_t samples;
+	uint64_t cycles;
+
+	zassert_ok(sensor_get_decoder(bmi160, &decoder));
+	zassert_is_null(decoder->decode_block);
+
+	cycles = decode_frames(decoder, bmi160_buffer, &samples);
+	zassert_equal(NUM_ITERATIONS, samples);
+	report("bmi160 per frame", cycles, samples);
+
+	cycles = decode_blocks(decoder, bmi160_buffer, false, &samples);
+	zassert_equal(NUM_ITERATIONS, samples);
+	report("bmi160 block", cycles, samples);
+}
+
+ZTEST_SUITE(sensor_decode, NULL, sensor_decode_setup, NULL, NULL, NULL);
@@ -0,0 +1,248 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * @file
+ * This file contains tests that will measure the length of time required
+ * to find and service a few ready sockets among many idle ones, with
+ * zsock_poll() and with zsock_epoll_wait(). Before each wakeup a few of the
+ * sockets receive a datagram over the loopback interface, the measured time
+ * covers waiting for the ready sockets and reading their data.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/timing/timing.h>
+#include <zephyr/net/socket.h>
+#include <zephyr/tc_util.h>
+#include <stdio.h>
+#include "utils.h"
+
+#define NUM_SOCKETS CONFIG_BENCHMARK_NUM_SOCKETS
+#define NUM_ACTIVE  CONFIG_BENCHMARK_NUM_ACTIVE
+#define BASE_PORT   20000
+#define WAIT_MS     1000
+
+static int socks[NUM_SOCKETS];
+static struct zsock_pollfd pollfds[NUM_SOCKETS];
+static struct zsock_epoll_event events[NUM_ACTIVE];
+static struct sockaddr_in server_addr;
+static int client;
+
+static int open_socket(unsigned int i)
+{
+	struct sockaddr_in addr = server_addr;
+	int sock;
+
+	sock = zsock_socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+	if (sock < 0) {
+		return -1;
+	}
+
+	addr.sin_port = htons(BASE_PORT + i);
+	if (zsock_bind(sock, (struct sockaddr *)&addr, sizeof(addr)) < 0) {
+		(void)zsock_close(sock);
+		return -1;
+	}
+
+	return sock;
+}
+
+/* Sends a datagram to NUM_ACTIVE sockets spread over the first count ones */
+static int send_active(unsigned int count)
+{
+	struct sockaddr_in addr = server_addr;
+
+	for (unsigned int a = 0; a < NUM_ACTIVE; a++) {
+		unsigned int i = count - 1 - a * (count / NUM_ACTIVE);
+
+		addr.sin_port = htons(BASE_PORT + i);
+		if (zsock_sendto(client, "x", 1, 0, (struct sockaddr *)&addr,
+				 sizeof(addr)) != 1) {
+			return -1;
+		}
+	}
+
+	return 0;
+}
+
+static uint64_t time_poll(unsigned int count)
+{
+	uint64_t total = 0;
+	timing_t start;
+	timing_t finish;
+	char buf[4];
+
+	for (int it = 0; it < CONFIG_BENCHMARK_NUM_ITERATIONS; it++) {
+		unsigned int serviced = 0;
+
+		if (send_active(count) < 0) {
+			return 0;
+		}
+
+		start = timing_counter_get();
+
+		while (serviced < NUM_ACTIVE) {
+			if (zsock_poll(pollfds, count, WAIT_MS) <= 0) {
+				printk("poll() failed or timed out (%d)\n", errno);
+				return 0;
+			}
+
+			for (unsigned int i = 0; i < count; i++) {
+				if (pollfds[i].revents & ZSOCK_POLLIN) {
+					(void)zsock_recv(pollfds[i].fd, buf, sizeof(buf), 0);
+					serviced++;
+				}
+			}
+		}
+
+		finish = timing_counter_get();
+		total += timing_cycles_get(&start, &finish);
+	}
+
+	return total / CONFIG_BENCHMARK_NUM_ITERATIONS;
+}
+
+static uint64_t time_epoll(int epfd, unsigned int count)
+{
+	uint64_t total = 0;
+	timing_t start;
+	timing_t finish;
+	char buf[4];
+	int n;
+
+	for (int it = 0; it < CONFIG_BENCHMARK_NUM_ITERATIONS; it++) {
+		unsigned int serviced = 0;
+
+		if (send_active(count) < 0) {
+			return 0;
+		}
+
+		start = timing_counter_get();
+
+		while (serviced < NUM_ACTIVE) {
+			n = zsock_epoll_wait(epfd, events, ARRAY_SIZE(events), WAIT_MS);
+			if (n <= 0) {
+				printk("epoll_wait() failed or timed out (%d)\n", errno);
+				return 0;
+			}
+
+			for (int i = 0; i < n; i++) {
+				(void)zsock_recv(events[i].data.fd, buf, sizeof(buf), 0);
+				serviced++;
+			}
+		}
+
+		finish = timing_counter_get();
+		total += timing_cycles_get(&start, &finish);
+	}
+
+	return total / CONFIG_BENCHMARK_NUM_ITERATIONS;
+}
+
+static void report(const char *kind, unsigned int count, uint64_t cycles)
+{
+	char description[80];
+
+	snprintf(description, sizeof(description), "Wake up on %u of %u sockets with %s",
+		 NUM_ACTIVE, count, kind);
+
+#ifdef CONFIG_BENCHMARK_RECORDING
+	printk("REC: net.socket.%s.%u - %s : %7llu cycles , %7u ns :\n", kind, count,
+	       description, cycles, (uint32_t)timing_cycles_to_ns(cycles));
+#else
+	PRINT_F(description, (uint32_t)cycles, (uint32_t)timing_cycles_to_ns(cycles));
+#endif
+}
+
+int main(void)
+{
+	struct zsock_epoll_event ev = {
+		.events = ZSOCK_EPOLLIN,
+	};
+	unsigned int count = NUM_ACTIVE;
+	unsigned int opened = 0;
+	bool failed = false;
+	int epfd;
+
+	timing_init();
+
+	TC_START("socket_epoll");
+
+	server_addr.sin_family = AF_INET;
+	server_addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+
+	client = zsock_socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+	epfd = zsock_epoll_create(0);
+	if (client < 0 || epfd < 0) {
+		printk("Cannot create client socket or epoll instance (%d)\n", errno);
+		TC_END_REPORT(TC_FAIL);
+		return 0;
+	}
+
+	timing_start();
+
+	while (true) {
+		uint64_t poll_cycles;
+		uint64_t epoll_cycles;
+
+		for (; opened < count; opened++) {
+			socks[opened] = open_socket(opened);
+			if (socks[opened] < 0) {
+				printk("Cannot open socket %u (%d)\n", opened, errno);
+				failed = true;
+				break;
+			}
+
+			pollfds[opened].fd = socks[opened];
+			pollfds[opened].events = ZSOCK_POLLIN;
+
+			ev.data.fd = socks[opened];
+			if (zsock_epoll_ctl(epfd, ZSOCK_EPOLL_CTL_ADD, socks[opened], &ev) < 0) {
+				printk("Cannot watch socket %u (%d)\n", opened, errno);
+				failed = true;
+				opened++;
+				break;
+			}
+		}
+
+		if (failed) {
+			break;
+		}
+
+		poll_cycles = time_poll(count);
+		epoll_cycles = time_epoll(epfd, count);
+		if (poll_cycles == 0 || epoll_cycles == 0) {
+			failed = true;
+			break;
+		}
+
+		if (IS_ENABLED(CONFIG_BENCHMARK_VERBOSE) || count == NUM_SOCKETS) {
+			report("poll", count, poll_cycles);
+			report("epoll", count, epoll_cycles);
+		}
+
+		if (count == NUM_SOCKETS) {
+			break;
+		}
+
+		count = MIN(2 * count, NUM_SOCKETS);
+	}
+
+	timing_stop();
+
+	for (unsigned int i = 0; i < opened; i++) {
+		if (socks[i] >= 0) {
+			(void)zsock_close(socks[i]);
+		}
+	}
+
+	(void)zsock_close(epfd);
+	(void)zsock_close(client);
+
+	TC_END_REPORT(failed ? TC_FAIL : 0);
+
+	return 0;
+}
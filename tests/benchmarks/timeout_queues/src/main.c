@@ -0,0 +1,306 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * @file
+ * This file contains tests that will measure the length of time required
+ * to add, expire and abort kernel timeouts while the timeout queue holds a
+ * varying number of pending timeouts. Bare _timeout records are used rather
+ * than k_timer objects so that only the timeout queue itself is measured.
+ * All timeouts are scheduled far beyond the (1 Hz) system tick, and expiry
+ * is driven explicitly through sys_clock_announce() with interrupts locked,
+ * timing each expiry from within the timeout handlers.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/timestamp.h>
+#include <zephyr/timing/timing.h>
+#include <zephyr/drivers/timer/system_timer.h>
+#include "utils.h"
+#include <zephyr/tc_util.h>
+#include <timeout_q.h>
+#include <stdio.h>
+
+/* Offset applied to every expiry so the real system tick never fires one */
+#define TIMEOUT_BASE_TICKS 1000
+
+static struct _timeout dummy_timeout[CONFIG_BENCHMARK_NUM_TIMEOUTS];
+static unsigned int num_pending;
+static unsigned int num_expired;
+static timing_t last_expiry;
+
+uint64_t add_cycles[CONFIG_BENCHMARK_NUM_TIMEOUTS];
+uint64_t remove_cycles[CONFIG_BENCHMARK_NUM_TIMEOUTS];
+
+/**
+ * Expiry handler: charges the time since the previous expiry (or since
+ * sys_clock_announce() was entered) to the current queue depth.
+ */
+static void dummy_timeout_fn(struct _timeout *t)
+{
+	timing_t now = timing_counter_get();
+
+	ARG_UNUSED(t);
+
+	num_pending--;
+	remove_cycles[num_pending] += timing_cycles_get(&last_expiry, &now);
+	num_expired++;
+
+	last_expiry = timing_counter_get();
+}
+
+static void dummy_timeouts_init(unsigned int num_timeouts)
+{
+	unsigned int i;
+
+	for (i = 0; i < num_timeouts; i++) {
+		z_init_timeout(&dummy_timeout[i]);
+	}
+}
+
+static void cycles_reset(unsigned int num_timeouts)
+{
+	unsigned int i;
+
+	for (i = 0; i < num_timeouts; i++) {
+		add_cycles[i] = 0ULL;
+		remove_cycles[i] = 0ULL;
+	}
+}
+
+/**
+ * Each successive timeout added to the queue expires after all of the
+ * previous ones (worst case for a sorted list). A single announcement
+ * then expires them all, earliest first.
+ */
+static void test_increasing_expiry(unsigned int num_timeouts)
+{
+	unsigned int i;
+	unsigned int key;
+	timing_t start;
+	timing_t finish;
+
+	for (i = 0; i < num_timeouts; i++) {
+		start = timing_counter_get();
+		z_add_timeout(&dummy_timeout[i], dummy_timeout_fn,
+			      K_TICKS(TIMEOUT_BASE_TICKS + i));
+		finish = timing_counter_get();
+
+		add_cycles[i] += timing_cycles_get(&start, &finish);
+	}
+
+	/* Expire from head of timeout queue */
+
+	key = irq_lock();
+	num_pending = num_timeouts;
+	last_expiry = timing_counter_get();
+	sys_clock_announce(2 * (TIMEOUT_BASE_TICKS + num_timeouts));
+	irq_unlock(key);
+}
+
+/**
+ * Each successive timeout added to the queue expires before all of the
+ * previous ones. The timeouts are then aborted latest first.
+ */
+static void test_decreasing_expiry(unsigned int num_timeouts)
+{
+	unsigned int i;
+	timing_t start;
+	timing_t finish;
+
+	for (i = 0; i < num_timeouts; i++) {
+		start = timing_counter_get();
+		z_add_timeout(&dummy_timeout[i], dummy_timeout_fn,
+			      K_TICKS(TIMEOUT_BASE_TICKS + num_timeouts - i));
+		finish = timing_counter_get();
+
+		add_cycles[i] += timing_cycles_get(&start, &finish);
+	}
+
+	/* Abort from tail of timeout queue */
+
+	for (i = 0; i < num_timeouts; i++) {
+		start = timing_counter_get();
+		z_abort_timeout(&dummy_timeout[i]);
+		finish = timing_counter_get();
+
+		remove_cycles[num_timeouts - i - 1] +=
+			timing_cycles_get(&start, &finish);
+	}
+}
+
+#ifdef CONFIG_BENCHMARK_VERBOSE
+static void report_verbose(uint64_t *cycles, const char *tag_fmt, const char *str)
+{
+	char description[120];
+	char tag[50];
+	unsigned int i;
+
+	for (i = 0; i < CONFIG_BENCHMARK_NUM_TIMEOUTS; i++) {
+		snprintf(tag, sizeof(tag), tag_fmt, i);
+		snprintf(description, sizeof(description), "%-40s - %s", tag, str);
+		PRINT_STATS_AVG(description, (uint32_t)cycles[i],
+				CONFIG_BENCHMARK_NUM_ITERATIONS);
+	}
+}
+#else
+#define report_verbose(cycles, tag_fmt, str) do {} while (false)
+#endif /* CONFIG_BENCHMARK_VERBOSE */
+
+static uint64_t sqrt_u64(uint64_t square)
+{
+	if (square > 1) {
+		uint64_t lo = sqrt_u64(square >> 2) << 1;
+		uint64_t hi = lo + 1;
+
+		return ((hi * hi) > square) ? lo : hi;
+	}
+
+	return square;
+}
+
+static void compute_and_report_stats(unsigned int num_timeouts, unsigned int num_iterations,
+				     uint64_t *cycles, const char *tag, const char *str)
+{
+	uint64_t minimum = cycles[0];
+	uint64_t maximum = cycles[0];
+	uint64_t total = cycles[0];
+	uint64_t average;
+	uint64_t std_dev = 0;
+	uint64_t tmp;
+	uint64_t diff;
+	unsigned int i;
+
+	for (i = 1; i < num_timeouts; i++) {
+		if (cycles[i] > maximum) {
+			maximum = cycles[i];
+		}
+
+		if (cycles[i] < minimum) {
+			minimum = cycles[i];
+		}
+
+		total += cycles[i];
+	}
+
+	minimum /= (uint64_t)num_iterations;
+	maximum /= (uint64_t)num_iterations;
+	average = total / (num_timeouts * num_iterations);
+
+	/* Calculate standard deviation */
+
+	for (i = 0; i < num_timeouts; i++) {
+		tmp = cycles[i] / num_iterations;
+		diff = (average > tmp) ? (average - tmp) : (tmp - average);
+
+		std_dev += (diff * diff);
+	}
+	std_dev /= num_timeouts;
+	std_dev = sqrt_u64(std_dev);
+
+#ifdef CONFIG_BENCHMARK_RECORDING
+	int tag_len = strlen(tag);
+	int descr_len = strlen(str);
+	int stag_len = strlen(".stddev");
+	int sdescr_len = strlen(", stddev.");
+
+	stag_len = (tag_len + stag_len < 40) ? 40 - tag_len : stag_len;
+	sdescr_len = (descr_len + sdescr_len < 50) ? 50 - descr_len : sdescr_len;
+
+	printk("REC: %s%-*s - %s%-*s : %7llu cycles , %7u ns :\n", tag, stag_len, ".min", str,
+	       sdescr_len, ", min.", minimum, (uint32_t)timing_cycles_to_ns(minimum));
+	printk("REC: %s%-*s - %s%-*s : %7llu cycles , %7u ns :\n", tag, stag_len, ".max", str,
+	       sdescr_len, ", max.", maximum, (uint32_t)timing_cycles_to_ns(maximum));
+	printk("REC: %s%-*s - %s%-*s : %7llu cycles , %7u ns :\n", tag, stag_len, ".avg", str,
+	       sdescr_len, ", avg.", average, (uint32_t)timing_cycles_to_ns(average));
+	printk("REC: %s%-*s - %s%-*s : %7llu cycles , %7u ns :\n", tag, stag_len, ".stddev", str,
+	       sdescr_len, ", stddev.", std_dev, (uint32_t)timing_cycles_to_ns(std_dev));
+#else
+	ARG_UNUSED(tag);
+
+	printk("------------------------------------\n");
+	printk("%s\n", str);
+
+	printk("    Minimum : %7llu cycles (%7u nsec)\n", minimum,
+	       (uint32_t)timing_cycles_to_ns(minimum));
+	printk("    Maximum : %7llu cycles (%7u nsec)\n", maximum,
+	       (uint32_t)timing_cycles_to_ns(maximum));
+	printk("    Average : %7llu cycles (%7u nsec)\n", average,
+	       (uint32_t)timing_cycles_to_ns(average));
+	printk("    Std Deviation: %7llu cycles (%7u nsec)\n", std_dev,
+	       (uint32_t)timing_cycles_to_ns(std_dev));
+#endif
+}
+
+int main(void)
+{
+	unsigned int i;
+	unsigned int freq;
+
+	timing_init();
+
+	bench_test_init();
+
+	freq = timing_freq_get_mhz();
+
+	printk("Time Measurements for %s timeout queue\n",
+	       IS_ENABLED(CONFIG_TIMEOUT_QUEUE_DUMB) ? "dumb" : "scalable");
+	printk("Timing results: Clock frequency: %u MHz\n", freq);
+
+	dummy_timeouts_init(CONFIG_BENCHMARK_NUM_TIMEOUTS);
+
+	timing_start();
+
+	cycles_reset(CONFIG_BENCHMARK_NUM_TIMEOUTS);
+
+	for (i = 0; i < CONFIG_BENCHMARK_NUM_ITERATIONS; i++) {
+		test_increasing_expiry(CONFIG_BENCHMARK_NUM_TIMEOUTS);
+	}
+
+	compute_and_report_stats(CONFIG_BENCHMARK_NUM_TIMEOUTS, CONFIG_BENCHMARK_NUM_ITERATIONS,
+				 add_cycles, "timeout.add.TimeoutQ_tail",
+				 "Add timeouts of increasing expiry");
+	report_verbose(add_cycles, "TimeoutQ.add.to.tail.%04u.pending",
+		       "Add timeout of increasing expiry");
+
+	compute_and_report_stats(CONFIG_BENCHMARK_NUM_TIMEOUTS, CONFIG_BENCHMARK_NUM_ITERATIONS,
+				 remove_cycles, "timeout.expire.TimeoutQ_head",
+				 "Expire earliest timeout");
+	report_verbose(remove_cycles, "TimeoutQ.expire.from.head.%04u.pending",
+		       "Expire earliest timeout");
+
+	cycles_reset(CONFIG_BENCHMARK_NUM_TIMEOUTS);
+
+	for (i = 0; i < CONFIG_BENCHMARK_NUM_ITERATIONS; i++) {
+		test_decreasing_expiry(CONFIG_BENCHMARK_NUM_TIMEOUTS);
+	}
+
+	compute_and_report_stats(CONFIG_BENCHMARK_NUM_TIMEOUTS, CONFIG_BENCHMARK_NUM_ITERATIONS,
+				 add_cycles, "timeout.add.TimeoutQ_head",
+				 "Add timeouts of decreasing expiry");
+	report_verbose(add_cycles, "TimeoutQ.add.to.head.%04u.pending",
+		       "Add timeout of decreasing expiry");
+
+	compute_and_report_stats(CONFIG_BENCHMARK_NUM_TIMEOUTS, CONFIG_BENCHMARK_NUM_ITERATIONS,
+				 remove_cycles, "timeout.abort.TimeoutQ_tail",
+				 "Abort latest timeout");
+	report_verbose(remove_cycles, "TimeoutQ.abort.from.tail.%04u.pending",
+		       "Abort latest timeout");
+
+	timing_stop();
+
+	if (num_expired != CONFIG_BENCHMARK_NUM_TIMEOUTS * CONFIG_BENCHMARK_NUM_ITERATIONS) {
+		printk("Expected %u expirations, got %u\n",
+		       CONFIG_BENCHMARK_NUM_TIMEOUTS * CONFIG_BENCHMARK_NUM_ITERATIONS,
+		       num_expired);
+		TC_END_REPORT(TC_FAIL);
+		return 0;
+	}
+
+	TC_END_REPORT(0);
+
+	return 0;
+}
@@ -0,0 +1,104 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Measure how the ZMS mount time and read latency grow with the number of
+ * stored ids, with the lookup cache configuration of the build.
+ */
+
+#include <zephyr/ztest.h>
+
+#include <zephyr/drivers/flash.h>
+#include <zephyr/fs/zms.h>
+#include <zephyr/storage/flash_map.h>
+
+#define TEST_ZMS_AREA        storage_partition
+#define TEST_ZMS_AREA_OFFSET FIXED_PARTITION_OFFSET(TEST_ZMS_AREA)
+#define TEST_ZMS_AREA_ID     FIXED_PARTITION_ID(TEST_ZMS_AREA)
+#define TEST_ZMS_AREA_SIZE   FIXED_PARTITION_SIZE(TEST_ZMS_AREA)
+
+static struct zms_fs fs;
+
+static void *setup(void)
+{
+	const struct flash_area *fa;
+	struct flash_pages_info info;
+	int err;
+
+	err = flash_area_open(TEST_ZMS_AREA_ID, &fa);
+	zassert_equal(err, 0, "flash_area_open() fail: %d", err);
+
+	fs.offset = TEST_ZMS_AREA_OFFSET;
+	fs.flash_device = flash_area_get_device(fa);
+	err = flash_get_page_info_by_offs(fs.flash_device, fs.offset, &info);
+	zassert_equal(err, 0, "Unable to get page info: %d", err);
+
+	fs.sector_size = info.size;
+	fs.sector_count = TEST_ZMS_AREA_SIZE / info.size;
+
+	err = flash_area_flatten(fa, 0, TEST_ZMS_AREA_SIZE);
+	zassert_equal(err, 0, "Unable to erase the flash area: %d", err);
+
+	return NULL;
+}
+
+ZTEST(zms_lookup, test_lookup)
+{
+	uint32_t start;
+	uint32_t mount_us;
+	uint32_t read_us;
+	uint32_t read_total_us;
+	uint32_t read_max_us;
+	uint32_t data;
+	ssize_t len;
+	int err;
+
+	printk("ZMS lookup, cache %s", IS_ENABLED(CONFIG_ZMS_LOOKUP_CACHE) ? "enabled" : "disabled");
+#ifdef CONFIG_ZMS_LOOKUP_CACHE
+	printk(" (%u entries, %u ways)", CONFIG_ZMS_LOOKUP_CACHE_SIZE,
+	       CONFIG_ZMS_LOOKUP_CACHE_WAYS);
+#endif
+	printk("\n");
+
+	for (uint32_t num_ids = 64; num_ids <= CONFIG_BENCHMARK_MAX_IDS; num_ids *= 2) {
+		err = zms_mount(&fs);
+		zassert_equal(err, 0, "zms_mount call failure: %d", err);
+		err = zms_clear(&fs);
+		zassert_equal(err, 0, "zms_clear call failure: %d", err);
+		err = zms_mount(&fs);
+		zassert_equal(err, 0, "zms_mount call failure: %d", err);
+
+		for (uint32_t id = 0; id < num_ids; id++) {
+			data = id;
+			len = zms_write(&fs, id, &data, sizeof(data));
+			zassert_equal(len, sizeof(data), "zms_write call failure: %zd", len);
+		}
+
+		start = k_cycle_get_32();
+		err = zms_mount(&fs);
+		mount_us = k_cyc_to_us_ceil32(k_cycle_get_32() - start);
+		zassert_equal(err, 0, "zms_mount call failure: %d", err);
+
+		read_total_us = 0;
+		read_max_us = 0;
+		for (uint32_t id = 0; id < num_ids; id++) {
+			start = k_cycle_get_32();
+			len = zms_read(&fs, id, &data, sizeof(data));
+			read_us = k_cyc_to_us_ceil32(k_cycle_get_32() - start);
+
+			zassert_equal(len, sizeof(data), "zms_read call failure: %zd", len);
+			zassert_equal(data, id, "unexpected data of id %u", id);
+
+			read_total_us += read_us;
+			read_max_us = MAX(read_max_us, read_us);
+		}
+
+		printk("%u ids: mount %u us, read avg %u us, read max %u us\n", num_ids, mount_us,
+		       read_total_us / num_ids, read_max_us);
+	}
+}
+
+ZTEST_SUITE(zms_lookup, NULL, setup, NULL, NULL, NULL);
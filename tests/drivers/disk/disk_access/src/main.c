@@ -275,6 +275,53 @@ ZTEST(disk_driver, test_write)
 	}
 }
 
+#ifdef CONFIG_DISK_CACHE_STATS
+/* Test the block cache reading ahead, hitting and writing back sectors */
+ZTEST(disk_driver, test_cache)
+{
+	struct disk_cache_stats stats;
+	uint32_t sector = disk_sector_count / 4;
+	uint32_t write_backs = IS_ENABLED(CONFIG_DISK_CACHE_WRITE_BACK) ? 1 : 0;
+	bool force = false;
+	int rc, i;
+
+	/* Written data has to survive deinitializing the disk */
+	rc = write_sector_checked(scratch_buf[0], scratch_buf[1], sector, 1);
+	zassert_equal(rc, 0, "Failed to write to disk");
+	zassert_ok(disk_access_cache_stats_reset(disk_pdrv));
+	rc = disk_access_ioctl(disk_pdrv, DISK_IOCTL_CTRL_DEINIT, &force);
+	zassert_equal(rc, 0, "Failed to deinitialize disk");
+	zassert_ok(disk_access_cache_stats(disk_pdrv, &stats));
+	zassert_equal(stats.write_backs, write_backs, "Cache not written back");
+	rc = disk_access_init(disk_pdrv);
+	zassert_equal(rc, 0, "Disk access initialization failed");
+
+	/* The second sequential read triggers reading ahead */
+	zassert_ok(disk_access_cache_stats_reset(disk_pdrv));
+	for (i = 0; i < 3; i++) {
+		memset(scratch_buf[1], 0, disk_sector_size);
+		rc = read_sector(scratch_buf[1], sector + i, 1);
+		zassert_equal(rc, 0, "Failed to read from disk");
+		if (i == 0) {
+			zassert_mem_equal(scratch_buf[0], scratch_buf[1], disk_sector_size,
+					  "Read data did not match data written to disk");
+		}
+	}
+	zassert_ok(disk_access_cache_stats(disk_pdrv, &stats));
+	zassert_equal(stats.read_ahead, CONFIG_DISK_CACHE_READ_AHEAD, "Unexpected read-ahead");
+	zassert_equal(stats.hits, MIN(CONFIG_DISK_CACHE_READ_AHEAD, 1), "Unexpected hits");
+	zassert_equal(stats.misses, 3 - stats.hits, "Unexpected misses");
+
+	/* Syncing the disk writes the cache back */
+	rc = write_sector_checked(scratch_buf[0], scratch_buf[1], sector, 1);
+	zassert_equal(rc, 0, "Failed to write to disk");
+	rc = disk_access_ioctl(disk_pdrv, DISK_IOCTL_CTRL_SYNC, NULL);
+	zassert_equal(rc, 0, "Failed to sync disk");
+	zassert_ok(disk_access_cache_stats(disk_pdrv, &stats));
+	zassert_equal(stats.write_backs, write_backs, "Cache not written back");
+}
+#endif /* CONFIG_DISK_CACHE_STATS */
+
 static void *disk_driver_setup(void)
 {
 #ifdef CONFIG_DISK_DRIVER_LOOPBACK
@@ -12,6 +12,7 @@
 #include <zephyr/fff.h>
 #include <zephyr/ztest.h>
 
+#include "icm42688_decoder.h"
 #include "icm42688_emul.h"
 #include "icm42688_reg.h"
 
@@ -240,3 +241,111 @@ ZTEST_F(icm42688, test_interrupt)
 	/* Verify the handler was called */
 	zassert_equal(test_interrupt_trigger_handler_fake.call_count, 1);
 }
+
+#define FIFO_FRAMES 37
+
+static uint8_t fifo_buffer[sizeof(struct icm42688_fifo_data) + FIFO_FRAMES * 16] __aligned(4);
+
+static void fill_fifo_buffer(void)
+{
+	struct icm42688_fifo_data *edata = (struct icm42688_fifo_data *)fifo_buffer;
+	uint8_t *frame = fifo_buffer + sizeof(*edata);
+
+	memset(fifo_buffer, 0, sizeof(fifo_buffer));
+	edata->header.is_fifo = true;
+	edata->header.timestamp = 123456789;
+	edata->header.accel_fs = ICM42688_DT_ACCEL_FS_4;
+	edata->header.gyro_fs = ICM42688_DT_GYRO_FS_500;
+	edata->accel_odr = ICM42688_DT_ACCEL_ODR_1000;
+	edata->gyro_odr = ICM42688_DT_GYRO_ODR_1000;
+	edata->fifo_count = FIFO_FRAMES * 16;
+
+	/* 16 byte packets holding accel, gyro and temperature */
+	for (int i = 0; i < FIFO_FRAMES; i++, frame += 16) {
+		frame[0] = FIELD_PREP(FIFO_HEADER_ACCEL, 1) | FIELD_PREP(FIFO_HEADER_GYRO, 1);
+		for (int j = 1; j < 13; j++) {
+			frame[j] = (uint8_t)(i * 31 + j * 7);
+		}
+		frame[13] = (uint8_t)(20 + i);
+	}
+}
+
+static void test_decode_block_channel(const struct sensor_decoder_api *decoder,
+				      enum sensor_channel channel, uint16_t capacity, bool generic)
+{
+	struct sensor_decode_context frame_ctx = SENSOR_DECODE_CONTEXT_INIT(decoder, fifo_buffer,
+									    channel, 0);
+	struct sensor_decode_context block_ctx = SENSOR_DECODE_CONTEXT_INIT(decoder, fifo_buffer,
+									    channel, 0);
+	const bool three_axis = SENSOR_CHANNEL_3_AXIS(channel);
+	uint32_t timestamp_delta[FIFO_FRAMES];
+	q31_t x[FIFO_FRAMES];
+	q31_t y[FIFO_FRAMES];
+	q31_t z[FIFO_FRAMES];
+	struct sensor_q31_block block = {
+		.capacity = capacity,
+		.timestamp_delta = timestamp_delta,
+		.x = x,
+		.y = y,
+		.z = z,
+	};
+	int total = 0;
+	int count;
+
+	while (true) {
+		if (generic) {
+			count = sensor_decode_block_generic(decoder, fifo_buffer, block_ctx.channel,
+							    &block_ctx.fit, &block);
+		} else {
+			count = sensor_decode_block(&block_ctx, &block);
+		}
+		if (count <= 0) {
+			break;
+		}
+		zassert_true(count <= capacity);
+		zassert_equal(count, block.header.reading_count);
+
+		/* Every sample must match what decoding frame by frame returns */
+		for (int i = 0; i < count; i++, total++) {
+			union {
+				struct sensor_three_axis_data three_axis;
+				struct sensor_q31_data q31;
+			} out;
+
+			zassert_equal(1, sensor_decode(&frame_ctx, &out, 1));
+			if (three_axis) {
+				zassert_equal(out.three_axis.header.base_timestamp_ns,
+					      block.header.base_timestamp_ns);
+				zassert_equal(out.three_axis.shift, block.shift);
+				zassert_equal(out.three_axis.readings[0].timestamp_delta,
+					      timestamp_delta[i]);
+				zassert_equal(out.three_axis.readings[0].x, x[i]);
+				zassert_equal(out.three_axis.readings[0].y, y[i]);
+				zassert_equal(out.three_axis.readings[0].z, z[i]);
+			} else {
+				zassert_equal(out.q31.shift, block.shift);
+				zassert_equal(out.q31.readings[0].timestamp_delta,
+					      timestamp_delta[i]);
+				zassert_equal(out.q31.readings[0].value, x[i]);
+			}
+		}
+	}
+	zassert_equal(0, count);
+	zassert_equal(FIFO_FRAMES, total);
+}
+
+ZTEST_F(icm42688, test_decode_block)
+{
+	const struct sensor_decoder_api *decoder;
+
+	zassert_ok(sensor_get_decoder(fixture->dev, &decoder));
+	zassert_not_null(decoder->decode_block);
+	fill_fifo_buffer();
+
+	for (int generic = 0; generic < 2; generic++) {
+		test_decode_block_channel(decoder, SENSOR_CHAN_ACCEL_XYZ, FIFO_FRAMES, generic);
+		test_decode_block_channel(decoder, SENSOR_CHAN_ACCEL_XYZ, 5, generic);
+		test_decode_block_channel(decoder, SENSOR_CHAN_GYRO_XYZ, 16, generic);
+		test_decode_block_channel(decoder, SENSOR_CHAN_DIE_TEMP, 7, generic);
+	}
+}
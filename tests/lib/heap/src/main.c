@@ -485,4 +485,147 @@ ZTEST(lib_heap, test_heap_listeners)
 #endif /* CONFIG_SYS_HEAP_LISTENER */
 }
 
+#ifdef CONFIG_SYS_HEAP_CACHE
+static struct sys_heap_cache heap_cache;
+
+static void *cachealloc(void *arg, size_t bytes)
+{
+	void *ret = sys_heap_cache_alloc(arg, bytes);
+
+	if (ret == NULL) {
+		ret = sys_heap_cache_refill(arg, bytes);
+	}
+	return ret;
+}
+
+static void cachefree(void *arg, void *p)
+{
+	if (!sys_heap_cache_free(arg, p)) {
+		sys_heap_cache_drain(arg, p);
+	}
+}
+
+static void *plainalloc(void *arg, size_t bytes)
+{
+	return sys_heap_alloc(arg, bytes);
+}
+
+static void plainfree(void *arg, void *p)
+{
+	sys_heap_free(arg, p);
+}
+
+static void *checkedalloc(void *arg, size_t bytes)
+{
+	void *ret = cachealloc(arg, bytes);
+
+	fill_block(ret, bytes);
+	zassert_true(sys_heap_validate(arg), "invalid heap");
+	return ret;
+}
+
+static void checkedfree(void *arg, void *p)
+{
+	check_fill(p);
+	cachefree(arg, p);
+	zassert_true(sys_heap_validate(arg), "invalid heap");
+}
+
+static void log_cycles(const char *tag, struct z_heap_stress_result *r)
+{
+	TC_PRINT("%s: %u cycles/alloc, %u cycles/free\n", tag,
+		 (uint32_t)(r->alloc_cycles / MAX(r->total_allocs, 1U)),
+		 (uint32_t)(r->free_cycles / MAX(r->total_frees, 1U)));
+}
+#endif /* CONFIG_SYS_HEAP_CACHE */
+
+/* Runs the stress rig through the magazine cache, first checking heap
+ * consistency after every operation, then timing it against the bare
+ * heap on the same workload.
+ */
+ZTEST(lib_heap, test_heap_cache)
+{
+#ifdef CONFIG_SYS_HEAP_CACHE
+	struct sys_heap heap;
+	struct z_heap_stress_result result;
+	struct sys_memory_stats stats;
+
+	TC_PRINT("Testing cached small (%d byte) heap\n", (int) SMALL_HEAP_SZ);
+
+	sys_heap_init(&heap, heapmem, SMALL_HEAP_SZ);
+	sys_heap_cache_init(&heap, &heap_cache);
+	sys_heap_stress(checkedalloc, checkedfree, &heap,
+			SMALL_HEAP_SZ, ITERATION_COUNT,
+			scratchmem, sizeof(scratchmem),
+			50, &result);
+	log_result(SMALL_HEAP_SZ, &result);
+
+	sys_heap_runtime_stats_get(&heap, &stats);
+	TC_PRINT("cache hits: %u, misses: %u\n", stats.cache_hits, stats.cache_misses);
+	zassert_true(stats.cache_hits > 0, "magazines never hit");
+
+	/* Everything that was handed back to this CPU's magazines can be
+	 * returned to the heap.
+	 */
+	sys_heap_cache_flush(&heap);
+	zassert_true(sys_heap_validate(&heap), "invalid heap");
+
+	sys_heap_init(&heap, heapmem, SMALL_HEAP_SZ);
+	sys_heap_stress(plainalloc, plainfree, &heap,
+			SMALL_HEAP_SZ, ITERATION_COUNT,
+			scratchmem, sizeof(scratchmem),
+			50, &result);
+	log_cycles("sys_heap", &result);
+
+	sys_heap_init(&heap, heapmem, SMALL_HEAP_SZ);
+	sys_heap_cache_init(&heap, &heap_cache);
+	sys_heap_stress(cachealloc, cachefree, &heap,
+			SMALL_HEAP_SZ, ITERATION_COUNT,
+			scratchmem, sizeof(scratchmem),
+			50, &result);
+	log_cycles("sys_heap_cache", &result);
+#else
+	ztest_test_skip();
+#endif
+}
+
+/* Blocks parked in the magazines of any CPU must be given back to the
+ * heap before an allocation gives up.
+ */
+ZTEST(lib_heap, test_heap_cache_flush)
+{
+#ifdef CONFIG_SYS_HEAP_CACHE
+	const size_t heap_sz = 8 * CONFIG_SYS_HEAP_CACHE_MAX_BYTES;
+	const int cls = SYS_HEAP_CACHE_CLASSES - 1;
+	struct sys_heap heap;
+	int n = 0;
+	void *p;
+
+	sys_heap_init(&heap, heapmem, heap_sz);
+	sys_heap_cache_init(&heap, &heap_cache);
+
+	/* Exhaust the heap and spread the blocks over all the CPUs */
+	while ((p = sys_heap_alloc(&heap, CONFIG_SYS_HEAP_CACHE_MAX_BYTES)) != NULL) {
+		struct sys_heap_magazine *mag =
+			&heap_cache.cpu[n % CONFIG_MP_MAX_NUM_CPUS].mags[cls];
+
+		zassert_true(mag->count < CONFIG_SYS_HEAP_CACHE_DEPTH, "magazine full");
+		mag->blocks[mag->count++] = p;
+		n++;
+	}
+	zassert_true(n > 1, "heap too small");
+
+	/* Not cacheable, served by the heap once the magazines are flushed */
+	p = sys_heap_cache_refill(&heap, heap_sz / 2);
+	zassert_not_null(p, "cached blocks not returned to the heap");
+	for (int cpu = 0; cpu < CONFIG_MP_MAX_NUM_CPUS; cpu++) {
+		zassert_equal(heap_cache.cpu[cpu].mags[cls].count, 0, "CPU %d not flushed", cpu);
+	}
+	sys_heap_free(&heap, p);
+	zassert_true(sys_heap_validate(&heap), "invalid heap");
+#else
+	ztest_test_skip();
+#endif
+}
+
 ZTEST_SUITE(lib_heap, NULL, NULL, NULL, NULL, NULL);
@@ -8,6 +8,7 @@
 #include <stdbool.h>
 #include <zephyr/ztest.h>
 #include <zephyr/data/json.h>
+#include <zephyr/sys/printk.h>
 
 struct test_nested {
 	int nested_int;
@@ -1362,4 +1363,143 @@ ZTEST(lib_json_test, test_json_array_alignment)
 	zassert_equal(o.array[1].int3, 6, "Element 1 int3 not decoded correctly");
 }
 
+struct stream_log {
+	char text[512];
+	size_t len;
+};
+
+static int stream_log_cb(const struct json_stream_event *event, void *user_data)
+{
+	struct stream_log *log = user_data;
+	int ret;
+
+	ret = snprintk(log->text + log->len, sizeof(log->text) - log->len, "%u%.*s%s%c%.*s ",
+		       event->depth, (int)event->key_len, event->key ? event->key : "",
+		       event->key ? "=" : "", (char)event->type, (int)event->value_len,
+		       event->value ? event->value : "");
+	zassert_true(ret > 0 && ret < sizeof(log->text) - log->len, "event log too long");
+	log->len += ret;
+
+	return 0;
+}
+
+static int stream_parse(const char *doc, size_t chunk_size, char *buf, size_t buf_size,
+			struct stream_log *log)
+{
+	struct json_stream stream;
+	size_t len = strlen(doc);
+	int ret;
+
+	log->len = 0;
+	log->text[0] = '\0';
+	json_stream_init(&stream, buf, buf_size, stream_log_cb, log);
+
+	for (size_t off = 0; off < len; off += chunk_size) {
+		ret = json_stream_feed(&stream, doc + off, MIN(chunk_size, len - off));
+		if (ret < 0) {
+			return ret;
+		}
+	}
+
+	return json_stream_finish(&stream);
+}
+
+ZTEST(lib_json_test, test_json_stream)
+{
+	const char doc[] = "{\"some_string\": \"zephyr \\u0031\\\"\", \"some_int\": -42, "
+			   "\"some_array\": [1, 2.5e3, true, false, null, {}, []], "
+			   "\"nested\": {\"nested_bool\": true, \"nested_string\": \"\"}}";
+	const char expected[] = "0{ 1some_string=\"zephyr \\u0031\\\" 1some_int=0-42 "
+				"1some_array=[ 201 202.5e3 2t 2f 2n 2{ 2} 2[ 2] 1] "
+				"1nested={ 2nested_bool=t 2nested_string=\" 1} 0} ";
+	struct stream_log log;
+	char buf[32];
+	int ret;
+
+	/* The events must not depend on how the document is split */
+	for (size_t chunk_size = 1; chunk_size <= sizeof(doc) - 1; chunk_size++) {
+		ret = stream_parse(doc, chunk_size, buf, sizeof(buf), &log);
+		zassert_equal(ret, 0, "Parsing failed with chunks of %zu bytes", chunk_size);
+		zassert_str_equal(log.text, expected, "Unexpected events with chunks of %zu bytes",
+				  chunk_size);
+	}
+}
+
+ZTEST(lib_json_test, test_json_stream_top_level_values)
+{
+	struct stream_log log;
+	char buf[8];
+
+	zassert_equal(stream_parse(" 1234 ", 1, buf, sizeof(buf), &log), 0);
+	zassert_str_equal(log.text, "001234 ");
+
+	zassert_equal(stream_parse("-5", 1, buf, sizeof(buf), &log), 0);
+	zassert_str_equal(log.text, "00-5 ");
+
+	zassert_equal(stream_parse("\"abc\"", 2, buf, sizeof(buf), &log), 0);
+	zassert_str_equal(log.text, "0\"abc ");
+
+	zassert_equal(stream_parse("true", 3, buf, sizeof(buf), &log), 0);
+	zassert_str_equal(log.text, "0t ");
+}
+
+ZTEST(lib_json_test, test_json_stream_invalid)
+{
+	static const char *const invalid[] = {
+		"",
+		"{",
+		"[1,]",
+		"{\"a\" 1}",
+		"{\"a\": 1,}",
+		"{1: 2}",
+		"[1 2]",
+		"[1}",
+		"{\"a\": 1]",
+		"[tru]",
+		"[nul1]",
+		"[\"\\x\"]",
+		"[\"\\u12g4\"]",
+		"[\"abc]",
+		"{} {}",
+		"[-]x",
+		"@",
+	};
+	struct stream_log log;
+	char buf[16];
+
+	for (size_t i = 0; i < ARRAY_SIZE(invalid); i++) {
+		for (size_t chunk_size = 1; chunk_size <= 4; chunk_size++) {
+			zassert_equal(stream_parse(invalid[i], chunk_size, buf, sizeof(buf), &log),
+				      -EINVAL, "\"%s\" not rejected", invalid[i]);
+		}
+	}
+}
+
+ZTEST(lib_json_test, test_json_stream_limits)
+{
+	char doc[2 * (JSON_STREAM_MAX_DEPTH + 1) + 1];
+	struct stream_log log;
+	char buf[8];
+
+	/* Keys and split values must fit the buffer */
+	zassert_equal(stream_parse("{\"12345678\": 1}", 16, buf, sizeof(buf), &log), 0);
+	zassert_equal(stream_parse("{\"123456789\": 1}", 16, buf, sizeof(buf), &log), -ENOMEM);
+	zassert_equal(stream_parse("{\"1234\": \"5678\"}", 12, buf, sizeof(buf), &log), 0);
+	zassert_equal(stream_parse("{\"1234\": \"56789\"}", 12, buf, sizeof(buf), &log),
+		      -ENOMEM);
+
+	/* Values held in a single chunk are not copied */
+	zassert_equal(stream_parse("[\"0123456789abcdef\"]", 32, buf, sizeof(buf), &log), 0);
+
+	memset(doc, '[', JSON_STREAM_MAX_DEPTH);
+	memset(doc + JSON_STREAM_MAX_DEPTH, ']', JSON_STREAM_MAX_DEPTH);
+	doc[2 * JSON_STREAM_MAX_DEPTH] = '\0';
+	zassert_equal(stream_parse(doc, sizeof(doc), buf, sizeof(buf), &log), 0);
+
+	memset(doc, '[', JSON_STREAM_MAX_DEPTH + 1);
+	memset(doc + JSON_STREAM_MAX_DEPTH + 1, ']', JSON_STREAM_MAX_DEPTH + 1);
+	doc[2 * (JSON_STREAM_MAX_DEPTH + 1)] = '\0';
+	zassert_equal(stream_parse(doc, sizeof(doc), buf, sizeof(buf), &log), -E2BIG);
+}
+
 ZTEST_SUITE(lib_json_test, NULL, NULL, NULL, NULL, NULL);
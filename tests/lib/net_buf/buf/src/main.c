@@ -71,6 +71,11 @@ static void var_destroy(struct net_buf *buf);
 NET_BUF_POOL_HEAP_DEFINE(bufs_pool, 10, USER_DATA_HEAP, buf_destroy);
 NET_BUF_POOL_FIXED_DEFINE(fixed_pool, 10, FIXED_BUFFER_SIZE, USER_DATA_FIXED, fixed_destroy);
 NET_BUF_POOL_VAR_DEFINE(var_pool, 10, 1024, USER_DATA_VAR, var_destroy);
+NET_BUF_POOL_FIXED_DEFINE(bulk_pool, 8, FIXED_BUFFER_SIZE, 0, NULL);
+
+#if defined(CONFIG_NET_BUF_POOL_CACHE)
+static struct net_buf_pool_cache bulk_pool_cache;
+#endif
 
 static void buf_destroy(struct net_buf *buf)
 {
@@ -980,5 +985,158 @@ ZTEST(net_buf_tests, test_net_buf_fixed_append)
 	net_buf_unref(buf);
 }
 
+static size_t chain_len(struct net_buf *buf)
+{
+	size_t len = 0;
+
+	for (; buf; buf = buf->frags) {
+		zassert_equal(buf->ref, 1U, "Invalid buffer reference count");
+		zassert_equal(buf->size, FIXED_BUFFER_SIZE, "Invalid buffer size");
+		zassert_equal(buf->len, 0, "Invalid buffer length");
+		len++;
+	}
+
+	return len;
+}
+
+ZTEST(net_buf_tests, test_net_buf_bulk_alloc)
+{
+	struct net_buf *chain;
+
+	chain = net_buf_alloc_bulk(&bulk_pool, bulk_pool.buf_count, K_NO_WAIT);
+	zassert_not_null(chain, "Failed to get buffer chain");
+	zassert_equal(chain_len(chain), bulk_pool.buf_count, "Invalid chain length");
+	zassert_is_null(net_buf_alloc(&bulk_pool, K_NO_WAIT), "Pool not exhausted");
+
+	/* All buffers of the chain go back to the pool at once */
+	net_buf_unref(chain);
+
+	chain = net_buf_alloc_bulk(&bulk_pool, bulk_pool.buf_count, K_NO_WAIT);
+	zassert_not_null(chain, "Buffers of the chain not freed");
+	net_buf_unref(chain);
+}
+
+ZTEST(net_buf_tests, test_net_buf_bulk_alloc_fail)
+{
+	struct net_buf *chain, *buf;
+
+	/* A chain which does not fit keeps none of its buffers */
+	chain = net_buf_alloc_bulk(&bulk_pool, bulk_pool.buf_count + 1, K_NO_WAIT);
+	zassert_is_null(chain, "Unexpected buffer chain");
+
+	buf = net_buf_alloc(&bulk_pool, K_NO_WAIT);
+	zassert_not_null(buf, "Failed to get buffer");
+
+	chain = net_buf_alloc_bulk(&bulk_pool, bulk_pool.buf_count, K_MSEC(10));
+	zassert_is_null(chain, "Unexpected buffer chain");
+
+	chain = net_buf_alloc_bulk(&bulk_pool, bulk_pool.buf_count - 1, K_NO_WAIT);
+	zassert_not_null(chain, "Buffers of the failed chain not freed");
+
+	net_buf_unref(chain);
+	net_buf_unref(buf);
+}
+
+ZTEST(net_buf_tests, test_net_buf_bulk_alloc_destroy)
+{
+	struct net_buf *chain;
+
+	destroy_called = 0;
+
+	chain = net_buf_alloc_len_bulk(&var_pool, 100, 4, K_NO_WAIT);
+	zassert_not_null(chain, "Failed to get buffer chain");
+	zassert_equal(net_buf_frags_len(chain), 0, "Invalid chain data length");
+
+	/* The destroy callback still runs for every buffer */
+	net_buf_unref(chain);
+	zassert_equal(destroy_called, 4, "Incorrect destroy callback count");
+}
+
+static void bulk_free_thread(void *arg1, void *arg2, void *arg3)
+{
+	ARG_UNUSED(arg2);
+	ARG_UNUSED(arg3);
+
+	k_msleep(10);
+	net_buf_unref(arg1);
+}
+
+static K_THREAD_STACK_DEFINE(bulk_free_thread_stack, 1024);
+
+ZTEST(net_buf_tests, test_net_buf_bulk_wait)
+{
+	static struct k_thread bulk_free_thread_data;
+	struct net_buf *chain, *buf;
+
+	chain = net_buf_alloc_bulk(&bulk_pool, bulk_pool.buf_count - 1, K_NO_WAIT);
+	zassert_not_null(chain, "Failed to get buffer chain");
+	buf = net_buf_alloc(&bulk_pool, K_NO_WAIT);
+	zassert_not_null(buf, "Failed to get buffer");
+
+	/* A buffer freed while an allocation waits goes to the waiter */
+	k_thread_create(&bulk_free_thread_data, bulk_free_thread_stack,
+			K_THREAD_STACK_SIZEOF(bulk_free_thread_stack),
+			bulk_free_thread, buf, NULL, NULL,
+			K_PRIO_COOP(7), 0, K_NO_WAIT);
+
+	buf = net_buf_alloc(&bulk_pool, TEST_TIMEOUT);
+	zassert_not_null(buf, "Failed to get freed buffer");
+
+	k_thread_join(&bulk_free_thread_data, K_FOREVER);
+
+	net_buf_unref(buf);
+	net_buf_unref(chain);
+}
+
+static struct net_buf *bulk_wait_chain;
+
+static void bulk_alloc_thread(void *arg1, void *arg2, void *arg3)
+{
+	ARG_UNUSED(arg1);
+	ARG_UNUSED(arg2);
+	ARG_UNUSED(arg3);
+
+	bulk_wait_chain = net_buf_alloc_bulk(&bulk_pool, bulk_pool.buf_count, TEST_TIMEOUT);
+}
+
+static K_THREAD_STACK_DEFINE(bulk_alloc_thread_stack, 1024);
+
+ZTEST(net_buf_tests, test_net_buf_bulk_wait_no_hold)
+{
+	static struct k_thread bulk_alloc_thread_data;
+	struct net_buf *chain, *buf;
+
+	buf = net_buf_alloc(&bulk_pool, K_NO_WAIT);
+	zassert_not_null(buf, "Failed to get buffer");
+
+	bulk_wait_chain = NULL;
+	k_thread_create(&bulk_alloc_thread_data, bulk_alloc_thread_stack,
+			K_THREAD_STACK_SIZEOF(bulk_alloc_thread_stack),
+			bulk_alloc_thread, NULL, NULL, NULL,
+			K_PRIO_COOP(7), 0, K_NO_WAIT);
+	k_msleep(10);
+
+	/* A waiting chain allocation holds none of the free buffers */
+	chain = net_buf_alloc_bulk(&bulk_pool, bulk_pool.buf_count - 1, K_NO_WAIT);
+	zassert_not_null(chain, "Free buffers held by the waiter");
+
+	net_buf_unref(chain);
+	net_buf_unref(buf);
+
+	k_thread_join(&bulk_alloc_thread_data, K_FOREVER);
+	zassert_not_null(bulk_wait_chain, "Failed to get buffer chain");
+	zassert_equal(chain_len(bulk_wait_chain), bulk_pool.buf_count,
+		      "Invalid chain length");
+
+	net_buf_unref(bulk_wait_chain);
+}
+
+static void *net_buf_setup(void)
+{
+#if defined(CONFIG_NET_BUF_POOL_CACHE)
+	net_buf_pool_cache_init(&bulk_pool, &bulk_pool_cache);
+#endif
+	return NULL;
+}
 
-ZTEST_SUITE(net_buf_tests, NULL, NULL, NULL, NULL, NULL);
+ZTEST_SUITE(net_buf_tests, NULL, net_buf_setup, NULL, NULL, NULL);
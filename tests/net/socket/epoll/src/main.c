@@ -0,0 +1,440 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(net_test, CONFIG_NET_SOCKETS_LOG_LEVEL);
+
+#include <stdio.h>
+#include <zephyr/ztest_assert.h>
+
+#include <zephyr/net/socket.h>
+#include <zephyr/net/socket_epoll.h>
+#include <zephyr/sys/fdtable.h>
+
+#if defined(CONFIG_EPOLL)
+#include <zephyr/posix/sys/epoll.h>
+#endif
+
+#include "../../socket_helpers.h"
+
+#define BUF_AND_SIZE(buf) buf, sizeof(buf) - 1
+#define STRLEN(buf) (sizeof(buf) - 1)
+
+#define TEST_STR_SMALL "test"
+
+#define MY_IPV6_ADDR "::1"
+
+#define SERVER_PORT 4242
+#define CLIENT_PORT 9898
+
+/* On QEMU, poll() which waits takes +10ms from the requested time. */
+#define FUZZ 10
+
+#define TCP_TEARDOWN_TIMEOUT K_SECONDS(3)
+
+static void epoll_add(int epfd, int fd, uint32_t events)
+{
+	struct zsock_epoll_event ev = {
+		.events = events,
+		.data.fd = fd,
+	};
+	int res;
+
+	res = zsock_epoll_ctl(epfd, ZSOCK_EPOLL_CTL_ADD, fd, &ev);
+	zassert_equal(res, 0, "epoll_ctl ADD failed (%d)", errno);
+}
+
+ZTEST(net_socket_epoll, test_epoll_udp)
+{
+	int res;
+	int epfd;
+	int c_sock;
+	int s_sock;
+	struct sockaddr_in6 c_addr;
+	struct sockaddr_in6 s_addr;
+	struct zsock_epoll_event events[2];
+	struct zsock_epoll_event ev;
+	struct zsock_pollfd pollfd;
+	uint32_t tstamp;
+	ssize_t len;
+	char buf[10];
+
+	prepare_sock_udp_v6(MY_IPV6_ADDR, CLIENT_PORT, &c_sock, &c_addr);
+	prepare_sock_udp_v6(MY_IPV6_ADDR, SERVER_PORT, &s_sock, &s_addr);
+
+	res = zsock_bind(s_sock, (struct sockaddr *)&s_addr, sizeof(s_addr));
+	zassert_equal(res, 0, "bind failed");
+
+	res = zsock_connect(c_sock, (struct sockaddr *)&s_addr, sizeof(s_addr));
+	zassert_equal(res, 0, "connect failed");
+
+	epfd = zsock_epoll_create(0);
+	zassert_true(epfd >= 0, "epoll_create failed");
+
+	epoll_add(epfd, c_sock, ZSOCK_EPOLLIN);
+	epoll_add(epfd, s_sock, ZSOCK_EPOLLIN);
+
+	/* Wait on non-ready fd's with timeout of 0 */
+	tstamp = k_uptime_get_32();
+	res = zsock_epoll_wait(epfd, events, ARRAY_SIZE(events), 0);
+	zassert_true(k_uptime_get_32() - tstamp <= FUZZ, "");
+	zassert_equal(res, 0, "");
+
+	/* Wait on non-ready fd's with timeout of 30 */
+	tstamp = k_uptime_get_32();
+	res = zsock_epoll_wait(epfd, events, ARRAY_SIZE(events), 30);
+	tstamp = k_uptime_get_32() - tstamp;
+	zassert_true(tstamp >= 30U && tstamp <= 30 + FUZZ * 2, "tstamp %d", tstamp);
+	zassert_equal(res, 0, "");
+
+	/* Send pkt for s_sock and wait with timeout of 30 */
+	len = zsock_send(c_sock, BUF_AND_SIZE(TEST_STR_SMALL), 0);
+	zassert_equal(len, STRLEN(TEST_STR_SMALL), "invalid send len");
+
+	tstamp = k_uptime_get_32();
+	res = zsock_epoll_wait(epfd, events, ARRAY_SIZE(events), 30);
+	zassert_true(k_uptime_get_32() - tstamp <= FUZZ, "");
+	zassert_equal(res, 1, "");
+	zassert_equal(events[0].events, ZSOCK_EPOLLIN, "");
+	zassert_equal(events[0].data.fd, s_sock, "");
+
+	/* Level-triggered, still ready until the data is read */
+	res = zsock_epoll_wait(epfd, events, ARRAY_SIZE(events), 0);
+	zassert_equal(res, 1, "");
+	zassert_equal(events[0].data.fd, s_sock, "");
+
+	/* The instance itself polls as readable */
+	pollfd.fd = epfd;
+	pollfd.events = ZSOCK_POLLIN;
+	pollfd.revents = 0;
+
+	res = zsock_poll(&pollfd, 1, 0);
+	zassert_equal(res, 1, "");
+	zassert_equal(pollfd.revents, ZSOCK_POLLIN, "");
+
+	/* Recv pkt from s_sock and ensure no events happen */
+	len = zsock_recv(s_sock, BUF_AND_SIZE(buf), 0);
+	zassert_equal(len, STRLEN(TEST_STR_SMALL), "invalid recv len");
+
+	res = zsock_epoll_wait(epfd, events, ARRAY_SIZE(events), 0);
+	zassert_equal(res, 0, "");
+
+	/* Packets to a removed socket are not reported */
+	res = zsock_epoll_ctl(epfd, ZSOCK_EPOLL_CTL_DEL, s_sock, NULL);
+	zassert_equal(res, 0, "");
+
+	len = zsock_send(c_sock, BUF_AND_SIZE(TEST_STR_SMALL), 0);
+	zassert_equal(len, STRLEN(TEST_STR_SMALL), "invalid send len");
+
+	res = zsock_epoll_wait(epfd, events, ARRAY_SIZE(events), 30);
+	zassert_equal(res, 0, "");
+
+	/* Re-adding picks up the data queued meanwhile */
+	epoll_add(epfd, s_sock, ZSOCK_EPOLLIN);
+
+	res = zsock_epoll_wait(epfd, events, ARRAY_SIZE(events), 0);
+	zassert_equal(res, 1, "");
+	zassert_equal(events[0].data.fd, s_sock, "");
+
+	/* UDP sockets are always writable */
+	ev.events = ZSOCK_EPOLLIN | ZSOCK_EPOLLOUT;
+	ev.data.fd = c_sock;
+
+	res = zsock_epoll_ctl(epfd, ZSOCK_EPOLL_CTL_MOD, c_sock, &ev);
+	zassert_equal(res, 0, "");
+
+	res = zsock_epoll_wait(epfd, events, ARRAY_SIZE(events), 0);
+	zassert_equal(res, 2, "");
+
+	/* Closing a socket removes it from the interest set */
+	res = zsock_close(s_sock);
+	zassert_equal(res, 0, "close failed");
+
+	res = zsock_epoll_wait(epfd, events, ARRAY_SIZE(events), 0);
+	zassert_equal(res, 1, "");
+	zassert_equal(events[0].data.fd, c_sock, "");
+	zassert_equal(events[0].events, ZSOCK_EPOLLOUT, "");
+
+	res = zsock_close(c_sock);
+	zassert_equal(res, 0, "close failed");
+
+	res = zsock_epoll_wait(epfd, events, ARRAY_SIZE(events), 0);
+	zassert_equal(res, 0, "");
+
+	res = zsock_close(epfd);
+	zassert_equal(res, 0, "close failed");
+}
+
+ZTEST(net_socket_epoll, test_epoll_ctl_errors)
+{
+	int res;
+	int epfd;
+	int sock;
+	struct sockaddr_in6 addr;
+	struct zsock_epoll_event ev = {
+		.events = ZSOCK_EPOLLIN,
+	};
+
+	prepare_sock_udp_v6(MY_IPV6_ADDR, SERVER_PORT, &sock, &addr);
+
+	res = zsock_epoll_create(1);
+	zassert_equal(res, -1, "");
+	zassert_equal(errno, EINVAL, "");
+
+	epfd = zsock_epoll_create(0);
+	zassert_true(epfd >= 0, "epoll_create failed");
+
+	res = zsock_epoll_ctl(sock, ZSOCK_EPOLL_CTL_ADD, sock, &ev);
+	zassert_equal(res, -1, "");
+	zassert_equal(errno, EBADF, "");
+
+	res = zsock_epoll_ctl(epfd, ZSOCK_EPOLL_CTL_ADD, -1, &ev);
+	zassert_equal(res, -1, "");
+	zassert_equal(errno, EBADF, "");
+
+	res = zsock_epoll_ctl(epfd, ZSOCK_EPOLL_CTL_ADD, epfd, &ev);
+	zassert_equal(res, -1, "");
+	zassert_equal(errno, EINVAL, "");
+
+	res = zsock_epoll_ctl(epfd, ZSOCK_EPOLL_CTL_MOD, sock, &ev);
+	zassert_equal(res, -1, "");
+	zassert_equal(errno, ENOENT, "");
+
+	res = zsock_epoll_ctl(epfd, ZSOCK_EPOLL_CTL_DEL, sock, NULL);
+	zassert_equal(res, -1, "");
+	zassert_equal(errno, ENOENT, "");
+
+	/* Edge-triggered and one-shot modes are not supported */
+	ev.events = ZSOCK_EPOLLIN | BIT(31);
+	res = zsock_epoll_ctl(epfd, ZSOCK_EPOLL_CTL_ADD, sock, &ev);
+	zassert_equal(res, -1, "");
+	zassert_equal(errno, EINVAL, "");
+
+	ev.events = ZSOCK_EPOLLIN;
+	res = zsock_epoll_ctl(epfd, ZSOCK_EPOLL_CTL_ADD, sock, &ev);
+	zassert_equal(res, 0, "");
+
+	res = zsock_epoll_ctl(epfd, ZSOCK_EPOLL_CTL_ADD, sock, &ev);
+	zassert_equal(res, -1, "");
+	zassert_equal(errno, EEXIST, "");
+
+	res = zsock_epoll_wait(epfd, NULL, 1, 0);
+	zassert_equal(res, -1, "");
+	zassert_equal(errno, EINVAL, "");
+
+	res = zsock_close(epfd);
+	zassert_equal(res, 0, "close failed");
+
+	res = zsock_close(sock);
+	zassert_equal(res, 0, "close failed");
+}
+
+ZTEST(net_socket_epoll, test_epoll_tcp)
+{
+	int res;
+	int epfd;
+	int c_sock;
+	int s_sock;
+	int new_sock;
+	struct sockaddr_in6 c_addr;
+	struct sockaddr_in6 s_addr;
+	struct zsock_epoll_event events[2];
+	ssize_t len;
+	char buf[10];
+
+	prepare_sock_tcp_v6(MY_IPV6_ADDR, CLIENT_PORT, &c_sock, &c_addr);
+	prepare_sock_tcp_v6(MY_IPV6_ADDR, SERVER_PORT, &s_sock, &s_addr);
+
+	res = zsock_bind(s_sock, (struct sockaddr *)&s_addr, sizeof(s_addr));
+	zassert_equal(res, 0, "");
+	res = zsock_listen(s_sock, 0);
+	zassert_equal(res, 0, "");
+
+	epfd = zsock_epoll_create(0);
+	zassert_true(epfd >= 0, "epoll_create failed");
+
+	epoll_add(epfd, s_sock, ZSOCK_EPOLLIN);
+
+	/* A pending connection makes the listening socket readable */
+	res = zsock_connect(c_sock, (const struct sockaddr *)&s_addr, sizeof(s_addr));
+	zassert_equal(res, 0, "");
+
+	res = zsock_epoll_wait(epfd, events, ARRAY_SIZE(events), 100);
+	zassert_equal(res, 1, "");
+	zassert_equal(events[0].data.fd, s_sock, "");
+	zassert_equal(events[0].events, ZSOCK_EPOLLIN, "");
+
+	new_sock = zsock_accept(s_sock, NULL, NULL);
+	zassert_true(new_sock >= 0, "");
+
+	epoll_add(epfd, new_sock, ZSOCK_EPOLLIN);
+
+	/* Writability of a TCP socket is polled */
+	epoll_add(epfd, c_sock, ZSOCK_EPOLLOUT);
+
+	res = zsock_epoll_wait(epfd, events, ARRAY_SIZE(events), 100);
+	zassert_equal(res, 1, "");
+	zassert_equal(events[0].data.fd, c_sock, "");
+	zassert_equal(events[0].events, ZSOCK_EPOLLOUT, "");
+
+	res = zsock_epoll_ctl(epfd, ZSOCK_EPOLL_CTL_DEL, c_sock, NULL);
+	zassert_equal(res, 0, "");
+
+	len = zsock_send(c_sock, BUF_AND_SIZE(TEST_STR_SMALL), 0);
+	zassert_equal(len, STRLEN(TEST_STR_SMALL), "invalid send len");
+
+	res = zsock_epoll_wait(epfd, events, ARRAY_SIZE(events), 100);
+	zassert_equal(res, 1, "");
+	zassert_equal(events[0].data.fd, new_sock, "");
+	zassert_equal(events[0].events, ZSOCK_EPOLLIN, "");
+
+	len = zsock_recv(new_sock, BUF_AND_SIZE(buf), 0);
+	zassert_equal(len, STRLEN(TEST_STR_SMALL), "invalid recv len");
+
+	res = zsock_epoll_wait(epfd, events, ARRAY_SIZE(events), 0);
+	zassert_equal(res, 0, "");
+
+	/* Peer close is reported as readable and hung up */
+	res = zsock_close(c_sock);
+	zassert_equal(res, 0, "close failed");
+
+	res = zsock_epoll_wait(epfd, events, ARRAY_SIZE(events), 100);
+	zassert_equal(res, 1, "");
+	zassert_equal(events[0].data.fd, new_sock, "");
+	zassert_true(events[0].events & ZSOCK_EPOLLHUP, "");
+
+	res = zsock_close(new_sock);
+	zassert_equal(res, 0, "close failed");
+	res = zsock_close(s_sock);
+	zassert_equal(res, 0, "close failed");
+	res = zsock_close(epfd);
+	zassert_equal(res, 0, "close failed");
+
+	k_sleep(TCP_TEARDOWN_TIMEOUT);
+}
+
+#define NUM_IDLE 6
+
+ZTEST(net_socket_epoll, test_epoll_many)
+{
+	int res;
+	int epfd;
+	int c_sock;
+	int idle[NUM_IDLE];
+	struct sockaddr_in6 c_addr;
+	struct sockaddr_in6 s_addr;
+	struct zsock_epoll_event events[NUM_IDLE];
+	ssize_t len;
+	char buf[10];
+
+	prepare_sock_udp_v6(MY_IPV6_ADDR, CLIENT_PORT, &c_sock, &c_addr);
+
+	epfd = zsock_epoll_create(0);
+	zassert_true(epfd >= 0, "epoll_create failed");
+
+	/* More sockets than zsock_poll() could take at once */
+	for (int i = 0; i < NUM_IDLE; i++) {
+		prepare_sock_udp_v6(MY_IPV6_ADDR, SERVER_PORT + i, &idle[i], &s_addr);
+		res = zsock_bind(idle[i], (struct sockaddr *)&s_addr, sizeof(s_addr));
+		zassert_equal(res, 0, "bind failed");
+
+		epoll_add(epfd, idle[i], ZSOCK_EPOLLIN);
+	}
+
+	res = zsock_epoll_wait(epfd, events, ARRAY_SIZE(events), 10);
+	zassert_equal(res, 0, "");
+
+	/* Only the last socket gets data */
+	len = zsock_sendto(c_sock, BUF_AND_SIZE(TEST_STR_SMALL), 0,
+			   (struct sockaddr *)&s_addr, sizeof(s_addr));
+	zassert_equal(len, STRLEN(TEST_STR_SMALL), "invalid send len");
+
+	res = zsock_epoll_wait(epfd, events, ARRAY_SIZE(events), 100);
+	zassert_equal(res, 1, "");
+	zassert_equal(events[0].data.fd, idle[NUM_IDLE - 1], "");
+
+	len = zsock_recv(idle[NUM_IDLE - 1], BUF_AND_SIZE(buf), 0);
+	zassert_equal(len, STRLEN(TEST_STR_SMALL), "invalid recv len");
+
+	/* maxevents smaller than the number of ready sockets */
+	for (int i = 0; i < NUM_IDLE; i++) {
+		s_addr.sin6_port = htons(SERVER_PORT + i);
+		len = zsock_sendto(c_sock, BUF_AND_SIZE(TEST_STR_SMALL), 0,
+				   (struct sockaddr *)&s_addr, sizeof(s_addr));
+		zassert_equal(len, STRLEN(TEST_STR_SMALL), "invalid send len");
+	}
+
+	k_msleep(10);
+
+	res = zsock_epoll_wait(epfd, events, 2, 0);
+	zassert_equal(res, 2, "");
+
+	res = zsock_epoll_wait(epfd, events, ARRAY_SIZE(events), 0);
+	zassert_equal(res, NUM_IDLE, "");
+
+	for (int i = 0; i < NUM_IDLE; i++) {
+		res = zsock_close(idle[i]);
+		zassert_equal(res, 0, "close failed");
+	}
+
+	res = zsock_close(c_sock);
+	zassert_equal(res, 0, "close failed");
+	res = zsock_close(epfd);
+	zassert_equal(res, 0, "close failed");
+}
+
+ZTEST(net_socket_epoll, test_posix_epoll)
+{
+	Z_TEST_SKIP_IFNDEF(CONFIG_EPOLL);
+
+#if defined(CONFIG_EPOLL)
+	int res;
+	int epfd;
+	int c_sock;
+	int s_sock;
+	struct sockaddr_in6 c_addr;
+	struct sockaddr_in6 s_addr;
+	struct epoll_event ev = {
+		.events = EPOLLIN,
+	};
+	ssize_t len;
+
+	prepare_sock_udp_v6(MY_IPV6_ADDR, CLIENT_PORT, &c_sock, &c_addr);
+	prepare_sock_udp_v6(MY_IPV6_ADDR, SERVER_PORT, &s_sock, &s_addr);
+
+	res = zsock_bind(s_sock, (struct sockaddr *)&s_addr, sizeof(s_addr));
+	zassert_equal(res, 0, "bind failed");
+
+	res = epoll_create(0);
+	zassert_equal(res, -1, "");
+	zassert_equal(errno, EINVAL, "");
+
+	epfd = epoll_create(1);
+	zassert_true(epfd >= 0, "epoll_create failed");
+
+	ev.data.u32 = 0x5a5a;
+	res = epoll_ctl(epfd, EPOLL_CTL_ADD, s_sock, &ev);
+	zassert_equal(res, 0, "");
+
+	len = zsock_sendto(c_sock, BUF_AND_SIZE(TEST_STR_SMALL), 0,
+			   (struct sockaddr *)&s_addr, sizeof(s_addr));
+	zassert_equal(len, STRLEN(TEST_STR_SMALL), "invalid send len");
+
+	res = epoll_wait(epfd, &ev, 1, 100);
+	zassert_equal(res, 1, "");
+	zassert_equal(ev.events, EPOLLIN, "");
+	zassert_equal(ev.data.u32, 0x5a5a, "");
+
+	res = zsock_close(epfd);
+	zassert_equal(res, 0, "close failed");
+	res = zsock_close(s_sock);
+	zassert_equal(res, 0, "close failed");
+	res = zsock_close(c_sock);
+	zassert_equal(res, 0, "close failed");
+#endif
+}
+
+ZTEST_SUITE(net_socket_epoll, NULL, NULL, NULL, NULL, NULL);
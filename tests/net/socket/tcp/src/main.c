@@ -835,6 +835,147 @@ ZTEST_USER(net_socket_tcp, test_v4_sendto_recvmsg)
 	k_sleep(TCP_TEARDOWN_TIMEOUT);
 }
 
+#if defined(CONFIG_NET_SOCKETS_ZEROCOPY_TX)
+static K_SEM_DEFINE(send_zc_done, 0, 1);
+
+static void send_zc_cb(void *user_data)
+{
+	zassert_equal_ptr(user_data, &send_zc_done, "wrong user data");
+
+	k_sem_give(&send_zc_done);
+}
+#endif
+
+ZTEST(net_socket_tcp, test_v4_sendmsg_zc)
+{
+#if defined(CONFIG_NET_SOCKETS_ZEROCOPY_TX)
+	static char tx_buf[] = TEST_STR_LONG;
+	char rx_buf[sizeof(TEST_STR_LONG)];
+	int c_sock;
+	int s_sock;
+	int new_sock;
+	struct sockaddr_in c_saddr;
+	struct sockaddr_in s_saddr;
+	struct sockaddr addr;
+	socklen_t addrlen = sizeof(addr);
+	struct iovec io_vector[2];
+	struct msghdr msg;
+	size_t len = strlen(TEST_STR_LONG);
+	size_t received = 0;
+	ssize_t ret;
+
+	prepare_sock_tcp_v4(MY_IPV4_ADDR, ANY_PORT, &c_sock, &c_saddr);
+	prepare_sock_tcp_v4(MY_IPV4_ADDR, SERVER_PORT, &s_sock, &s_saddr);
+
+	test_bind(s_sock, (struct sockaddr *)&s_saddr, sizeof(s_saddr));
+	test_listen(s_sock);
+
+	test_connect(c_sock, (struct sockaddr *)&s_saddr, sizeof(s_saddr));
+
+	test_accept(s_sock, &new_sock, &addr, &addrlen);
+	zassert_equal(addrlen, sizeof(struct sockaddr_in), "wrong addrlen");
+
+	io_vector[0].iov_base = tx_buf;
+	io_vector[0].iov_len = len / 2;
+	io_vector[1].iov_base = &tx_buf[len / 2];
+	io_vector[1].iov_len = len - len / 2;
+
+	memset(&msg, 0, sizeof(msg));
+	msg.msg_iov = io_vector;
+	msg.msg_iovlen = 2;
+
+	ret = zsock_sendmsg_zc(c_sock, &msg, 0, send_zc_cb, &send_zc_done);
+	zassert_equal(ret, len, "sendmsg_zc failed (%d)", errno);
+
+	while (received < len) {
+		ret = zsock_recv(new_sock, &rx_buf[received],
+				 sizeof(rx_buf) - received, 0);
+		zassert_true(ret > 0, "recv failed (%d)", errno);
+		received += ret;
+	}
+
+	zassert_equal(received, len, "wrong data length");
+	zassert_mem_equal(rx_buf, TEST_STR_LONG, len, "wrong data");
+
+	zassert_ok(k_sem_take(&send_zc_done, K_SECONDS(2)),
+		   "buffers not released");
+
+	test_close(new_sock);
+	test_close(s_sock);
+	test_close(c_sock);
+
+	k_sleep(TCP_TEARDOWN_TIMEOUT);
+#else
+	ztest_test_skip();
+#endif
+}
+
+/* The buffers must be released, and the callback called, when the
+ * connection goes away with the data still unacknowledged.
+ */
+ZTEST(net_socket_tcp, test_v4_sendmsg_zc_close)
+{
+#if defined(CONFIG_NET_SOCKETS_ZEROCOPY_TX)
+	static char tx_buf[] = TEST_STR_LONG;
+	int c_sock;
+	int s_sock;
+	int new_sock;
+	struct sockaddr_in c_saddr;
+	struct sockaddr_in s_saddr;
+	struct sockaddr addr;
+	socklen_t addrlen = sizeof(addr);
+	struct iovec io_vector[3];
+	struct msghdr msg;
+	size_t len = strlen(TEST_STR_LONG);
+	ssize_t ret;
+
+	restore_packet_loss_ratio();
+
+	prepare_sock_tcp_v4(MY_IPV4_ADDR, ANY_PORT, &c_sock, &c_saddr);
+	prepare_sock_tcp_v4(MY_IPV4_ADDR, SERVER_PORT, &s_sock, &s_saddr);
+
+	test_bind(s_sock, (struct sockaddr *)&s_saddr, sizeof(s_saddr));
+	test_listen(s_sock);
+
+	test_connect(c_sock, (struct sockaddr *)&s_saddr, sizeof(s_saddr));
+
+	test_accept(s_sock, &new_sock, &addr, &addrlen);
+	zassert_equal(addrlen, sizeof(struct sockaddr_in), "wrong addrlen");
+
+	/* Nothing gets acknowledged from now on */
+	zassert_equal(loopback_set_packet_drop_ratio(1.0f), 0,
+		      "Error setting packet drop rate");
+
+	io_vector[0].iov_base = tx_buf;
+	io_vector[0].iov_len = len / 3;
+	io_vector[1].iov_base = &tx_buf[len / 3];
+	io_vector[1].iov_len = len / 3;
+	io_vector[2].iov_base = &tx_buf[2 * (len / 3)];
+	io_vector[2].iov_len = len - 2 * (len / 3);
+
+	memset(&msg, 0, sizeof(msg));
+	msg.msg_iov = io_vector;
+	msg.msg_iovlen = 3;
+
+	ret = zsock_sendmsg_zc(c_sock, &msg, 0, send_zc_cb, &send_zc_done);
+	zassert_equal(ret, len, "sendmsg_zc failed (%d)", errno);
+
+	test_close(c_sock);
+
+	zassert_ok(k_sem_take(&send_zc_done, TCP_TEARDOWN_TIMEOUT),
+		   "buffers not released on close");
+
+	restore_packet_loss_ratio();
+
+	test_close(new_sock);
+	test_close(s_sock);
+
+	k_sleep(TCP_TEARDOWN_TIMEOUT);
+#else
+	ztest_test_skip();
+#endif
+}
+
 void _test_recv_enotconn(int c_sock, int s_sock)
 {
 	char rx_buf[1] = {0};
@@ -13,6 +13,7 @@ LOG_MODULE_REGISTER(net_test, CONFIG_NET_SOCKETS_LOG_LEVEL);
 #include <zephyr/ztest_assert.h>
 
 #include <zephyr/net/socket.h>
+#include <zephyr/net_buf.h>
 #include <zephyr/net/ethernet.h>
 #include <zephyr/net/net_mgmt.h>
 #include <zephyr/net/net_event.h>
@@ -3108,6 +3109,85 @@ ZTEST(net_socket_udp, test_40_clamp_udp_tcp_port_range)
 #endif
 }
 
+ZTEST(net_socket_udp, test_41_v4_recv_zerocopy)
+{
+#if defined(CONFIG_NET_SOCKETS_ZEROCOPY_RX)
+	int rv;
+	int client_sock;
+	int server_sock;
+	struct sockaddr_in client_addr;
+	struct sockaddr_in server_addr;
+	struct sockaddr_in addr;
+	socklen_t addrlen = sizeof(addr);
+	struct net_buf *frags;
+	struct net_buf *frags2;
+
+	prepare_sock_udp_v4(MY_IPV4_ADDR, CLIENT_PORT, &client_sock, &client_addr);
+	prepare_sock_udp_v4(MY_IPV4_ADDR, SERVER_PORT, &server_sock, &server_addr);
+
+	rv = zsock_bind(server_sock, (struct sockaddr *)&server_addr, sizeof(server_addr));
+	zassert_equal(rv, 0, "bind failed");
+	rv = zsock_bind(client_sock, (struct sockaddr *)&client_addr, sizeof(client_addr));
+	zassert_equal(rv, 0, "bind failed");
+
+	rv = zsock_sendto(client_sock, BUF_AND_SIZE(TEST_STR2), 0,
+			  (struct sockaddr *)&server_addr, sizeof(server_addr));
+	zassert_equal(rv, STRLEN(TEST_STR2), "sendto failed");
+	rv = zsock_sendto(client_sock, BUF_AND_SIZE(TEST_STR_SMALL), 0,
+			  (struct sockaddr *)&server_addr, sizeof(server_addr));
+	zassert_equal(rv, STRLEN(TEST_STR_SMALL), "sendto failed");
+
+	/* The datagram spans several buffers, all of them are lent */
+	rv = zsock_recv_zc(server_sock, &frags, 0, (struct sockaddr *)&addr, &addrlen);
+	zassert_equal(rv, STRLEN(TEST_STR2), "recv_zc failed (%d)", errno);
+	zassert_not_null(frags->frags, "datagram not fragmented");
+	zassert_equal(net_buf_frags_len(frags), STRLEN(TEST_STR2), "wrong length");
+	zassert_equal(addrlen, sizeof(struct sockaddr_in), "wrong addrlen");
+	zassert_equal(addr.sin_port, client_addr.sin_port, "wrong source port");
+
+	memset(rx_buf, 0, sizeof(rx_buf));
+	(void)net_buf_linearize(rx_buf, sizeof(rx_buf), frags, 0, STRLEN(TEST_STR2));
+	zassert_mem_equal(rx_buf, TEST_STR2, STRLEN(TEST_STR2), "wrong data");
+
+	/* Over the limit of held buffers until they are released */
+	rv = zsock_recv_zc(server_sock, &frags2, ZSOCK_MSG_DONTWAIT, NULL, NULL);
+	zassert_equal(rv, -1, "recv_zc succeeded");
+	zassert_equal(errno, ENOBUFS, "incorrect errno value");
+
+	rv = zsock_recv_zc_release(frags);
+	zassert_equal(rv, 0, "release failed");
+
+	rv = zsock_recv_zc(server_sock, &frags2, 0, NULL, NULL);
+	zassert_equal(rv, STRLEN(TEST_STR_SMALL), "recv_zc failed (%d)", errno);
+	zassert_mem_equal(frags2->data, TEST_STR_SMALL, STRLEN(TEST_STR_SMALL),
+			  "wrong data");
+
+	rv = zsock_recv_zc_release(frags2);
+	zassert_equal(rv, 0, "release failed");
+
+	rv = zsock_recv_zc(server_sock, &frags, ZSOCK_MSG_DONTWAIT, NULL, NULL);
+	zassert_equal(rv, -1, "recv_zc succeeded");
+	zassert_equal(errno, EAGAIN, "incorrect errno value");
+
+	/* Fragments can still be released after the socket is closed */
+	rv = zsock_sendto(client_sock, BUF_AND_SIZE(TEST_STR_SMALL), 0,
+			  (struct sockaddr *)&server_addr, sizeof(server_addr));
+	zassert_equal(rv, STRLEN(TEST_STR_SMALL), "sendto failed");
+	rv = zsock_recv_zc(server_sock, &frags, 0, NULL, NULL);
+	zassert_equal(rv, STRLEN(TEST_STR_SMALL), "recv_zc failed (%d)", errno);
+
+	rv = zsock_close(client_sock);
+	zassert_equal(rv, 0, "close failed");
+	rv = zsock_close(server_sock);
+	zassert_equal(rv, 0, "close failed");
+
+	rv = zsock_recv_zc_release(frags);
+	zassert_equal(rv, 0, "release failed");
+#else
+	ztest_test_skip();
+#endif
+}
+
 static void after(void *arg)
 {
 	ARG_UNUSED(arg);
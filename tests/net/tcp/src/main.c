@@ -114,6 +114,7 @@ static enum test_case_no {
 	TEST_CLIENT_CLOSING_FAILURE_IPV6 = 16,
 	TEST_CLIENT_FIN_WAIT_2_IPV4_FAILURE = 17,
 	TEST_CLIENT_FIN_ACK_WITH_DATA = 18,
+	TEST_GSO_OWN_ADDRESS = 19,
 } test_case_no;
 
 static enum test_state t_state;
@@ -490,6 +491,9 @@ static int tester_send(const struct device *dev, struct net_pkt *pkt)
 	case TEST_CLIENT_FIN_ACK_WITH_DATA:
 		handle_client_fin_ack_with_data_test(net_pkt_family(pkt), &th);
 		break;
+	case TEST_GSO_OWN_ADDRESS:
+		zassert_true(false, "packet to own address sent out");
+		break;
 
 	default:
 		zassert_true(false, "Undefined test case");
@@ -2602,4 +2606,115 @@ ZTEST(net_tcp, test_client_fin_ack_with_data)
 	}
 }
 
+#if defined(CONFIG_NET_TCP_GSO)
+static struct net_context *gso_accepted_ctx;
+static uint8_t gso_rx_buf[sizeof(lorem_ipsum)];
+static size_t gso_rx_len;
+
+static void test_gso_recv_cb(struct net_context *context,
+			     struct net_pkt *pkt,
+			     union net_ip_header *ip_hdr,
+			     union net_proto_header *proto_hdr,
+			     int status,
+			     void *user_data)
+{
+	size_t len;
+
+	if (pkt == NULL) {
+		return;
+	}
+
+	len = net_pkt_remaining_data(pkt);
+	zassert_true(gso_rx_len + len <= sizeof(gso_rx_buf), "too much data");
+	zassert_ok(net_pkt_read(pkt, &gso_rx_buf[gso_rx_len], len));
+	gso_rx_len += len;
+	net_pkt_unref(pkt);
+
+	if (gso_rx_len == sizeof(lorem_ipsum) - 1) {
+		test_sem_give();
+	}
+}
+
+static void test_gso_accept_cb(struct net_context *ctx,
+			       struct sockaddr *addr,
+			       socklen_t addrlen,
+			       int status,
+			       void *user_data)
+{
+	zassert_ok(status, "failed to accept the conn");
+
+	/* The segments are looped back synchronously, set the callback before
+	 * anything is sent.
+	 */
+	ctx->recv_cb = test_gso_recv_cb;
+	gso_accepted_ctx = ctx;
+	net_context_ref(ctx);
+
+	test_sem_give();
+}
+#endif /* CONFIG_NET_TCP_GSO */
+
+/* Test case scenario IPv4
+ *   connect to our own address on the test interface,
+ *   send more than one segment worth of data,
+ *   expect all of it to be received.
+ *   GSO packets to our own address are looped back by net_send_data()
+ *   without going through net_if_tx(), where they are otherwise split, so
+ *   they must be split and checksummed on that path too.
+ */
+ZTEST(net_tcp, test_gso_own_address)
+{
+#if defined(CONFIG_NET_TCP_GSO)
+	struct sockaddr_in server_addr = {
+		.sin_family = AF_INET,
+		.sin_port = htons(MY_PORT + 1),
+		.sin_addr = { { { 192, 0, 2, 1 } } },
+	};
+	struct net_context *server_ctx;
+	struct net_context *ctx;
+
+	test_case_no = TEST_GSO_OWN_ADDRESS;
+	gso_rx_len = 0;
+
+	zassert_ok(net_context_get(AF_INET, SOCK_STREAM, IPPROTO_TCP, &server_ctx),
+		   "Failed to get net_context");
+	net_context_ref(server_ctx);
+	zassert_ok(net_context_bind(server_ctx, (struct sockaddr *)&server_addr,
+				    sizeof(server_addr)),
+		   "Failed to bind net_context");
+	zassert_ok(net_context_listen(server_ctx, 1), "Failed to listen on net_context");
+	zassert_ok(net_context_accept(server_ctx, test_gso_accept_cb, K_FOREVER, NULL),
+		   "Failed to set accept on net_context");
+
+	zassert_ok(net_context_get(AF_INET, SOCK_STREAM, IPPROTO_TCP, &ctx),
+		   "Failed to get net_context");
+	net_context_ref(ctx);
+	zassert_ok(net_context_connect(ctx, (struct sockaddr *)&server_addr,
+				       sizeof(server_addr), NULL, K_MSEC(1000), NULL),
+		   "Failed to connect");
+
+	test_sem_take(K_MSEC(100), __LINE__);
+
+	/* More than one MSS, so it is sent as one GSO packet. The scenario
+	 * disables congestion avoidance, which would start with a congestion
+	 * window of one MSS.
+	 */
+	zassert_equal(net_context_send(ctx, lorem_ipsum, sizeof(lorem_ipsum) - 1, NULL,
+				       K_NO_WAIT, NULL),
+		      sizeof(lorem_ipsum) - 1, "Failed to send data");
+
+	test_sem_take(K_MSEC(500), __LINE__);
+	zassert_mem_equal(gso_rx_buf, lorem_ipsum, sizeof(lorem_ipsum) - 1, "wrong data");
+
+	net_context_put(ctx);
+	net_context_put(gso_accepted_ctx);
+	net_context_put(server_ctx);
+
+	/* Let both sides close before the next test case */
+	k_sleep(K_MSEC(CONFIG_NET_TCP_TIME_WAIT_DELAY * 2));
+#else
+	ztest_test_skip();
+#endif
+}
+
 ZTEST_SUITE(net_tcp, NULL, presetup, NULL, NULL, NULL);
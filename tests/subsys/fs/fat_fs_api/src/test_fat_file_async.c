@@ -0,0 +1,83 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "test_fat.h"
+
+#ifdef CONFIG_FILE_SYSTEM_ASYNC
+#include <zephyr/rtio/rtio.h>
+
+#define NUM_ACCESSES 8
+
+RTIO_DEFINE(fat_rtio, NUM_ACCESSES + 1, NUM_ACCESSES + 1);
+
+static int test_async_access(void)
+{
+	struct rtio_cqe *cqe;
+	char read_buff[NUM_ACCESSES][16];
+	size_t len = strlen(test_str);
+	int res;
+
+	TC_PRINT("\nAsync access tests:\n");
+	zassert_true(len <= sizeof(read_buff[0]), NULL);
+
+	res = fs_open(&filep, TEST_FILE, FS_O_CREATE | FS_O_RDWR);
+	zassert_ok(res, "Err: File could not be opened [%d]\n", res);
+
+	/* Accesses complete in the order they were queued */
+	for (int i = 0; i < NUM_ACCESSES; i++) {
+		res = fs_write_async(&fat_rtio, &filep, test_str, len, INT_TO_POINTER(i));
+		zassert_ok(res, "Error queueing write [%d]\n", res);
+	}
+	res = fs_sync_async(&fat_rtio, &filep, INT_TO_POINTER(NUM_ACCESSES));
+	zassert_ok(res, "Error queueing sync [%d]\n", res);
+
+	for (int i = 0; i <= NUM_ACCESSES; i++) {
+		cqe = rtio_cqe_consume_block(&fat_rtio);
+		zassert_equal(POINTER_TO_INT(cqe->userdata), i, "Completed out of order");
+		zassert_equal(cqe->result, (i < NUM_ACCESSES) ? (int)len : 0,
+			      "Error accessing file [%d]\n", cqe->result);
+		rtio_cqe_release(&fat_rtio, cqe);
+	}
+
+	res = fs_seek(&filep, 0, FS_SEEK_SET);
+	zassert_ok(res, "Error seeking file [%d]\n", res);
+
+	/* One more read than was written gets to the end of the file */
+	for (int i = 0; i <= NUM_ACCESSES; i++) {
+		res = fs_read_async(&fat_rtio, &filep, read_buff[i % NUM_ACCESSES], len,
+				    INT_TO_POINTER(i));
+		zassert_ok(res, "Error queueing read [%d]\n", res);
+	}
+
+	for (int i = 0; i <= NUM_ACCESSES; i++) {
+		cqe = rtio_cqe_consume_block(&fat_rtio);
+		zassert_equal(POINTER_TO_INT(cqe->userdata), i, "Completed out of order");
+		zassert_equal(cqe->result, (i < NUM_ACCESSES) ? (int)len : 0,
+			      "Error reading file [%d]\n", cqe->result);
+		rtio_cqe_release(&fat_rtio, cqe);
+	}
+
+	for (int i = 0; i < NUM_ACCESSES; i++) {
+		zassert_mem_equal(read_buff[i], test_str, len, "Read data mismatch");
+	}
+
+	res = fs_close(&filep);
+	zassert_ok(res, "Error closing file [%d]\n", res);
+
+	res = fs_write_async(&fat_rtio, &filep, test_str, len, NULL);
+	zassert_equal(res, -EBADF, "Queued a write to a closed file");
+
+	res = fs_unlink(TEST_FILE);
+	zassert_ok(res, "Error deleting file [%d]\n", res);
+
+	return TC_PASS;
+}
+
+void test_fat_file_async(void)
+{
+	zassert_true(test_async_access() == TC_PASS, NULL);
+}
+#endif /* CONFIG_FILE_SYSTEM_ASYNC */
@@ -784,6 +784,70 @@ ZTEST_F(zms, test_zms_cache_collission)
 #endif
 }
 
+#ifdef CONFIG_ZMS_LOOKUP_CACHE
+static void check_evicted_ids(struct zms_fs *fs, uint32_t num_ids)
+{
+	int err;
+	uint32_t data;
+
+	for (uint32_t id = 0; id < num_ids; id++) {
+		err = zms_read(fs, id, &data, sizeof(data));
+		if (id % 3 == 0) {
+			zassert_equal(err, -ENOENT, "deleted ID %u found: %d", id, err);
+			continue;
+		}
+		zassert_equal(err, sizeof(data), "zms_read call failure: %d", err);
+		zassert_equal(data, id % 5 == 0 ? id + num_ids : id, "incorrect data read");
+	}
+
+	err = zms_read(fs, num_ids, &data, sizeof(data));
+	zassert_equal(err, -ENOENT, "unwritten ID found: %d", err);
+}
+#endif
+
+/*
+ * Test that IDs evicted from the ZMS lookup cache are read correctly, before and after
+ * the cache is rebuilt by zms_mount().
+ */
+ZTEST_F(zms, test_zms_cache_eviction)
+{
+#ifdef CONFIG_ZMS_LOOKUP_CACHE
+	const uint32_t num_ids = CONFIG_ZMS_LOOKUP_CACHE_SIZE * 2;
+	int err;
+	uint32_t data;
+
+	fixture->fs.sector_count = 8;
+	err = zms_mount(&fixture->fs);
+	zassert_true(err == 0, "zms_mount call failure: %d", err);
+
+	for (uint32_t id = 0; id < num_ids; id++) {
+		data = id;
+		err = zms_write(&fixture->fs, id, &data, sizeof(data));
+		zassert_equal(err, sizeof(data), "zms_write call failure: %d", err);
+	}
+
+	/* Delete every third ID and update every fifth one */
+
+	for (uint32_t id = 0; id < num_ids; id++) {
+		if (id % 3 == 0) {
+			err = zms_delete(&fixture->fs, id);
+			zassert_true(err == 0, "zms_delete call failure: %d", err);
+		} else if (id % 5 == 0) {
+			data = id + num_ids;
+			err = zms_write(&fixture->fs, id, &data, sizeof(data));
+			zassert_equal(err, sizeof(data), "zms_write call failure: %d", err);
+		}
+	}
+
+	check_evicted_ids(&fixture->fs, num_ids);
+
+	err = zms_mount(&fixture->fs);
+	zassert_true(err == 0, "zms_mount call failure: %d", err);
+
+	check_evicted_ids(&fixture->fs, num_ids);
+#endif
+}
+
 /*
  * Test that ZMS lookup cache does not contain any address from gc-ed sector
  */
@@ -18,6 +18,8 @@
 #include <zephyr/logging/log_backend.h>
 #include <zephyr/logging/log_ctrl.h>
 #include <zephyr/logging/log.h>
+#include <zephyr/logging/log_output.h>
+#include <zephyr/logging/log_output_dict.h>
 #include "test_helpers.h"
 
 #define LOG_MODULE_NAME test
@@ -42,11 +44,37 @@ struct backend_cb {
 	bool check_strdup;
 	bool exp_strdup[100];
 	uint32_t total_drops;
+	log_format_func_t format;
+	size_t format_bytes;
 };
 
+#if defined(CONFIG_LOG_OUTPUT) && defined(CONFIG_LOG_DICTIONARY_SUPPORT)
+static uint8_t output_buf[64];
+
+static int output_count(uint8_t *buf, size_t size, void *ctx)
+{
+	struct backend_cb *cb = ctx;
+
+	cb->format_bytes += size;
+
+	return size;
+}
+
+LOG_OUTPUT_DEFINE(bench_output, output_count, output_buf, sizeof(output_buf));
+#endif
+
 static void process(struct log_backend const *const backend,
 		    union log_msg_generic *msg)
 {
+#if defined(CONFIG_LOG_OUTPUT) && defined(CONFIG_LOG_DICTIONARY_SUPPORT)
+	struct backend_cb *cb = (struct backend_cb *)backend->cb->ctx;
+
+	if (cb->format) {
+		cb->format(&bench_output, &msg->log,
+			   LOG_OUTPUT_FLAG_LEVEL | LOG_OUTPUT_FLAG_TIMESTAMP);
+		cb->counter++;
+	}
+#endif
 }
 
 static void panic(struct log_backend const *const backend)
@@ -230,6 +258,133 @@ ZTEST(test_log_benchmark, test_log_message_with_string)
 		cyc / repeat, us / repeat);
 }
 
+/** Measure logging of a message with three word arguments. With
+ * CONFIG_LOG_SIMPLE_MSG_OPTIMIZE it is created by the simple, fixed layout path,
+ * otherwise the string package is built by cbprintf.
+ */
+ZTEST(test_log_benchmark, test_log_message_three_args)
+{
+	test_helpers_log_setup();
+	uint32_t cyc = test_helpers_cycle_get();
+	int repeat = 8;
+
+	for (int i = 0; i < repeat; i++) {
+		LOG_INF("test %d %u %x", i, 100U, 0x1234);
+	}
+
+	cyc = test_helpers_cycle_get() - cyc;
+	uint32_t us = k_cyc_to_us_ceil32(cyc);
+
+	PRINT("%slogging with three arguments %u cycles (%u us) (simple messages: %d).\n",
+		k_is_user_context() ? "USERSPACE: " : "",
+		cyc / repeat, us / repeat, IS_ENABLED(CONFIG_LOG_SIMPLE_MSG_OPTIMIZE));
+}
+
+#define RATE_MSG_CNT 1000
+#define RATE_STACK_SIZE 1024
+
+static K_THREAD_STACK_ARRAY_DEFINE(rate_stacks, CONFIG_MP_MAX_NUM_CPUS, RATE_STACK_SIZE);
+static struct k_thread rate_threads[CONFIG_MP_MAX_NUM_CPUS];
+static K_SEM_DEFINE(rate_start, 0, CONFIG_MP_MAX_NUM_CPUS);
+
+static void rate_thread(void *p1, void *p2, void *p3)
+{
+	k_sem_take(&rate_start, K_FOREVER);
+
+	for (int i = 0; i < RATE_MSG_CNT; i++) {
+		LOG_ERR("test %d %d", i, 1);
+	}
+}
+
+/** Measure how many messages per second are logged when threads on 1 up to
+ * all CPUs are logging at the same time. Messages are not processed, so once
+ * the buffer is full messages are dropped as configured.
+ */
+ZTEST(test_log_benchmark, test_log_message_rate_per_cpu_count)
+{
+	for (unsigned int cpus = 1; cpus <= arch_num_cpus(); cpus++) {
+		uint32_t cyc;
+		uint64_t rate;
+
+		test_helpers_log_setup();
+
+		/* Threads have lower priority than the test thread so that all
+		 * of them are released before any starts logging on this CPU.
+		 */
+		for (unsigned int i = 0; i < cpus; i++) {
+			k_thread_create(&rate_threads[i], rate_stacks[i], RATE_STACK_SIZE,
+					rate_thread, NULL, NULL, NULL,
+					CONFIG_MAIN_THREAD_PRIORITY + 1, 0, K_NO_WAIT);
+		}
+
+		cyc = test_helpers_cycle_get();
+
+		for (unsigned int i = 0; i < cpus; i++) {
+			k_sem_give(&rate_start);
+		}
+
+		for (unsigned int i = 0; i < cpus; i++) {
+			k_thread_join(&rate_threads[i], K_FOREVER);
+		}
+
+		cyc = test_helpers_cycle_get() - cyc;
+		rate = (uint64_t)cpus * RATE_MSG_CNT * sys_clock_hw_cycles_per_sec() / cyc;
+
+		PRINT("%u CPU(s): %u messages per second (per-CPU buffers: %d)\n",
+			cpus, (uint32_t)rate, IS_ENABLED(CONFIG_LOG_PERCPU_BUFFERS));
+	}
+}
+
+#if defined(CONFIG_LOG_OUTPUT) && defined(CONFIG_LOG_DICTIONARY_SUPPORT)
+#define OUTPUT_MSG_CNT 32
+
+static void run_log_output_format(const char *name, log_format_func_t format)
+{
+	uint32_t cyc;
+
+	test_helpers_log_setup();
+	log_output_ctx_set(&bench_output, &backend_ctrl_blk);
+
+	for (int i = 0; i < OUTPUT_MSG_CNT; i++) {
+		LOG_ERR("test %d %d %d", i, i * 100, -i);
+	}
+
+	backend_ctrl_blk.format = format;
+	backend_ctrl_blk.format_bytes = 0;
+	backend_ctrl_blk.counter = 0;
+
+	cyc = test_helpers_cycle_get();
+	while (log_process()) {
+	}
+	cyc = test_helpers_cycle_get() - cyc;
+
+	backend_ctrl_blk.format = NULL;
+	zassert_equal(backend_ctrl_blk.counter, OUTPUT_MSG_CNT);
+
+	PRINT("%s output: %u cycles, %u bytes per message\n", name,
+		cyc / OUTPUT_MSG_CNT, backend_ctrl_blk.format_bytes / OUTPUT_MSG_CNT);
+}
+#endif
+
+/** Compare the processing time and output size of text and dictionary-based
+ * output of the same messages.
+ */
+ZTEST(test_log_benchmark, test_log_output_format)
+{
+	Z_TEST_SKIP_IFNDEF(CONFIG_LOG_OUTPUT);
+	Z_TEST_SKIP_IFNDEF(CONFIG_LOG_DICTIONARY_SUPPORT);
+
+#if defined(CONFIG_LOG_OUTPUT) && defined(CONFIG_LOG_DICTIONARY_SUPPORT)
+	log_backend_enable(&backend, &backend_ctrl_blk, LOG_LEVEL_DBG);
+
+	run_log_output_format("Text", log_output_msg_process);
+	run_log_output_format("Dictionary", log_dict_output_msg_process);
+	run_log_output_format("Compact dictionary", log_dict_output_compact_msg_process);
+
+	log_backend_disable(&backend);
+#endif
+}
+
 /*test case main entry*/
 static void *log_benchmark_setup(void)
 {
@@ -0,0 +1,217 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/kernel.h>
+#include <zephyr/rtio/rtio.h>
+
+#define WORKER_STACK_SIZE 1024
+#define WORKER_PRIO       3
+#define NUM_SQES          32
+
+/* A device on an emulated bus, transfers are done in the submit call */
+struct bus_dev_data {
+	k_tid_t thread;
+	int submit_count;
+	int last_seq;
+};
+
+static atomic_t seq;
+
+static void bus_dev_submit(struct rtio_iodev_sqe *iodev_sqe)
+{
+	struct bus_dev_data *data = iodev_sqe->sqe.iodev->data;
+	struct rtio_iodev_sqe *curr;
+
+	data->thread = k_current_get();
+	data->submit_count++;
+	data->last_seq = atomic_inc(&seq);
+
+	for (curr = iodev_sqe; curr != NULL; curr = rtio_txn_next(curr)) {
+		if (curr->sqe.op == RTIO_OP_RX) {
+			memset(curr->sqe.rx.buf, 0xa5, curr->sqe.rx.buf_len);
+		}
+	}
+
+	rtio_iodev_sqe_ok(iodev_sqe, 0);
+}
+
+static const struct rtio_iodev_api bus_dev_api = {
+	.submit = bus_dev_submit,
+};
+
+static struct bus_dev_data dev_a1_data, dev_a2_data, dev_b_data;
+
+RTIO_IODEV_DEFINE(dev_a1, &bus_dev_api, &dev_a1_data);
+RTIO_IODEV_DEFINE(dev_a2, &bus_dev_api, &dev_a2_data);
+RTIO_IODEV_DEFINE(dev_b, &bus_dev_api, &dev_b_data);
+
+RTIO_IODEV_WORKER_DEFINE(bus_a, WORKER_STACK_SIZE, WORKER_PRIO);
+RTIO_IODEV_WORKER_DEFINE(bus_b, WORKER_STACK_SIZE, WORKER_PRIO);
+
+RTIO_DEFINE(r_test, NUM_SQES, NUM_SQES);
+
+static struct rtio_cqe *consume(void)
+{
+	struct rtio_cqe *cqe = rtio_cqe_consume(&r_test);
+
+	zassert_not_null(cqe, "Expected a completion");
+
+	return cqe;
+}
+
+static void *setup(void)
+{
+	rtio_iodev_set_worker(&dev_a1, &bus_a);
+	rtio_iodev_set_worker(&dev_a2, &bus_a);
+	rtio_iodev_set_worker(&dev_b, &bus_b);
+
+	return NULL;
+}
+
+static void before(void *unused)
+{
+	ARG_UNUSED(unused);
+
+	memset(&dev_a1_data, 0, sizeof(dev_a1_data));
+	memset(&dev_a2_data, 0, sizeof(dev_a2_data));
+	memset(&dev_b_data, 0, sizeof(dev_b_data));
+	atomic_set(&seq, 0);
+}
+
+ZTEST_SUITE(rtio_worker, NULL, setup, before, NULL, NULL);
+
+ZTEST(rtio_worker, test_submit_on_worker)
+{
+	struct rtio_sqe *sqe;
+	struct rtio_cqe *cqe;
+	uint8_t buf[8] = {0};
+
+	sqe = rtio_sqe_acquire(&r_test);
+	rtio_sqe_prep_read(sqe, &dev_a1, RTIO_PRIO_NORM, buf, sizeof(buf), buf);
+
+	zassert_ok(rtio_submit(&r_test, 1));
+
+	zassert_equal(dev_a1_data.submit_count, 1);
+	zassert_equal(dev_a1_data.thread, bus_a.thread, "Not submitted on the worker");
+	zassert_not_equal(dev_a1_data.thread, k_current_get());
+
+	cqe = consume();
+	zassert_ok(cqe->result);
+	zassert_equal(cqe->userdata, buf);
+	zassert_equal(buf[0], 0xa5);
+	rtio_cqe_release(&r_test, cqe);
+}
+
+ZTEST(rtio_worker, test_chain_across_buses)
+{
+	struct rtio_iodev *devs[] = {&dev_a1, &dev_b, &dev_a2};
+	struct rtio_sqe *sqe;
+	struct rtio_cqe *cqe;
+
+	for (uintptr_t i = 0; i < ARRAY_SIZE(devs); i++) {
+		sqe = rtio_sqe_acquire(&r_test);
+		rtio_sqe_prep_nop(sqe, devs[i], (void *)i);
+		if (i < ARRAY_SIZE(devs) - 1) {
+			sqe->flags |= RTIO_SQE_CHAINED;
+		}
+	}
+
+	zassert_ok(rtio_submit(&r_test, ARRAY_SIZE(devs)));
+
+	/* Each link is started after the previous one, on the worker of its bus */
+	zassert_equal(dev_a1_data.last_seq, 0);
+	zassert_equal(dev_b_data.last_seq, 1);
+	zassert_equal(dev_a2_data.last_seq, 2);
+	zassert_equal(dev_a1_data.thread, bus_a.thread);
+	zassert_equal(dev_b_data.thread, bus_b.thread);
+	zassert_equal(dev_a2_data.thread, bus_a.thread);
+
+	for (uintptr_t i = 0; i < ARRAY_SIZE(devs); i++) {
+		cqe = consume();
+		zassert_ok(cqe->result);
+		zassert_equal((uintptr_t)cqe->userdata, i);
+		rtio_cqe_release(&r_test, cqe);
+	}
+}
+
+ZTEST(rtio_worker, test_transaction)
+{
+	uint8_t reg = 0x10;
+	uint8_t buf[4] = {0};
+	struct rtio_sqe *sqe;
+	struct rtio_cqe *cqe;
+
+	sqe = rtio_sqe_acquire(&r_test);
+	rtio_sqe_prep_write(sqe, &dev_a2, RTIO_PRIO_NORM, &reg, sizeof(reg), NULL);
+	sqe->flags |= RTIO_SQE_TRANSACTION;
+	sqe = rtio_sqe_acquire(&r_test);
+	rtio_sqe_prep_read(sqe, &dev_a2, RTIO_PRIO_NORM, buf, sizeof(buf), buf);
+
+	zassert_ok(rtio_submit(&r_test, 1));
+
+	zassert_equal(dev_a2_data.submit_count, 1, "Transaction not submitted at once");
+	zassert_equal(buf[3], 0xa5);
+
+	cqe = consume();
+	zassert_ok(cqe->result);
+	zassert_equal(cqe->userdata, buf);
+	rtio_cqe_release(&r_test, cqe);
+
+	zassert_is_null(rtio_cqe_consume(&r_test));
+}
+
+ZTEST(rtio_worker, test_cancel_queued)
+{
+	struct rtio_sqe *sqe;
+	struct rtio_cqe *cqe;
+
+	/* Keep the worker from running until the submission is canceled */
+	k_sched_lock();
+
+	sqe = rtio_sqe_acquire(&r_test);
+	rtio_sqe_prep_nop(sqe, &dev_a1, NULL);
+	zassert_ok(rtio_submit(&r_test, 0));
+	zassert_ok(rtio_sqe_cancel(sqe));
+
+	k_sched_unlock();
+
+	cqe = rtio_cqe_consume_block(&r_test);
+	zassert_equal(cqe->result, -ECANCELED);
+	rtio_cqe_release(&r_test, cqe);
+
+	zassert_equal(dev_a1_data.submit_count, 0, "Canceled submission reached the iodev");
+	zassert_is_null(rtio_cqe_consume(&r_test));
+}
+
+ZTEST(rtio_worker, test_batches)
+{
+	struct rtio_iodev *devs[] = {&dev_a1, &dev_a2, &dev_b};
+	struct rtio_sqe *sqe;
+	struct rtio_cqe *cqe;
+	uint64_t mask = 0;
+
+	for (uintptr_t i = 0; i < NUM_SQES; i++) {
+		sqe = rtio_sqe_acquire(&r_test);
+		rtio_sqe_prep_nop(sqe, devs[i % ARRAY_SIZE(devs)], (void *)i);
+	}
+
+	zassert_ok(rtio_submit(&r_test, NUM_SQES));
+
+	zassert_equal(dev_a1_data.submit_count + dev_a2_data.submit_count +
+		      dev_b_data.submit_count, NUM_SQES);
+
+	/* Every completion is counted, whichever batch it was notified with */
+	for (int i = 0; i < NUM_SQES; i++) {
+		cqe = rtio_cqe_consume_block(&r_test);
+		zassert_ok(cqe->result);
+		mask |= BIT64((uintptr_t)cqe->userdata);
+		rtio_cqe_release(&r_test, cqe);
+	}
+
+	zassert_equal(mask, BIT64_MASK(NUM_SQES));
+	zassert_is_null(rtio_cqe_consume(&r_test));
+}
@@ -0,0 +1,156 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+#include <zephyr/sensing/sensing.h>
+
+#ifdef CONFIG_SENSING_SHARED_RING
+
+#define NUM_CLIENTS 3
+
+struct client {
+	sensing_sensor_handle_t handle;
+	struct sensing_callback_list cb_list;
+	uint32_t interval;
+	atomic_t count;
+	const void *last;
+};
+
+static struct client clients[NUM_CLIENTS];
+
+static void on_data_event(sensing_sensor_handle_t handle, const void *buf, void *context)
+{
+	struct client *client = context;
+
+	ARG_UNUSED(handle);
+
+	client->last = buf;
+	atomic_inc(&client->count);
+}
+
+static const struct sensing_sensor_info *get_accel_info(void)
+{
+	const struct sensing_sensor_info *info;
+	int num;
+
+	zassert_ok(sensing_get_sensors(&num, &info));
+	for (int i = 0; i < num; i++) {
+		if (info[i].type == SENSING_SENSOR_TYPE_MOTION_ACCELEROMETER_3D) {
+			return &info[i];
+		}
+	}
+
+	zassert_unreachable("no accelerometer");
+	return NULL;
+}
+
+static void set_interval(sensing_sensor_handle_t handle, uint32_t interval)
+{
+	struct sensing_sensor_config config = {
+		.attri = SENSING_SENSOR_ATTRIBUTE_INTERVAL,
+		.interval = interval,
+	};
+
+	zassert_ok(sensing_set_config(handle, &config, 1));
+}
+
+static void shared_ring_after(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	for (int i = 0; i < NUM_CLIENTS; i++) {
+		if (clients[i].handle != NULL) {
+			zassert_ok(sensing_close_sensor(&clients[i].handle));
+		}
+	}
+	/* let the runtime thread stop the sensor */
+	k_msleep(50);
+}
+
+/**
+ * @brief Test decimation
+ *
+ * Clients of the same sensor with intervals of 1, 2 and 4 times the fastest
+ * one get every, every 2nd and every 4th sample.
+ */
+ZTEST(sensing_shared_ring, test_decimation)
+{
+	const struct sensing_sensor_info *info = get_accel_info();
+	uint32_t base = 10 * USEC_PER_MSEC;
+	atomic_val_t count[NUM_CLIENTS];
+
+	for (int i = 0; i < NUM_CLIENTS; i++) {
+		clients[i].cb_list.on_data_event = on_data_event;
+		clients[i].cb_list.context = &clients[i];
+		clients[i].interval = base << i;
+		zassert_ok(sensing_open_sensor(info, &clients[i].cb_list, &clients[i].handle));
+		set_interval(clients[i].handle, clients[i].interval);
+	}
+
+	/* wait for the configuration to settle before counting */
+	k_msleep(100);
+	for (int i = 0; i < NUM_CLIENTS; i++) {
+		atomic_clear(&clients[i].count);
+	}
+	k_msleep(400);
+	for (int i = 0; i < NUM_CLIENTS; i++) {
+		count[i] = atomic_get(&clients[i].count);
+	}
+
+	zassert_true(count[0] > 8, "too few samples: %ld", count[0]);
+	zassert_within(count[1], count[0] / 2, 1, "%ld vs %ld", count[1], count[0]);
+	zassert_within(count[2], count[0] / 4, 1, "%ld vs %ld", count[2], count[0]);
+}
+
+/**
+ * @brief Test the shared ring
+ *
+ * Clients with data events get the same buffer, and a client without data
+ * events copies the samples out of the ring through its own cursor.
+ */
+ZTEST(sensing_shared_ring, test_read_sample)
+{
+	const struct sensing_sensor_info *info = get_accel_info();
+	struct sensing_callback_list no_events = {0};
+	uint8_t sample[CONFIG_SENSING_SHARED_RING_SAMPLE_SIZE];
+	int read = 0;
+	int ret;
+
+	for (int i = 0; i < 2; i++) {
+		clients[i].cb_list.on_data_event = on_data_event;
+		clients[i].cb_list.context = &clients[i];
+		zassert_ok(sensing_open_sensor(info, &clients[i].cb_list, &clients[i].handle));
+		set_interval(clients[i].handle, 10 * USEC_PER_MSEC);
+	}
+	zassert_ok(sensing_open_sensor(info, &no_events, &clients[2].handle));
+	zassert_equal(-ENODATA, sensing_read_sample(clients[2].handle, sample, sizeof(sample)));
+	zassert_equal(-ENOTSUP, sensing_read_sample(clients[0].handle, sample, sizeof(sample)));
+	set_interval(clients[2].handle, 10 * USEC_PER_MSEC);
+
+	k_msleep(200);
+
+	/* the samples are dispatched once, all clients see the same one */
+	zassert_not_null(clients[0].last);
+	zassert_equal(clients[0].last, clients[1].last);
+
+	/* only the latest samples are kept */
+	while ((ret = sensing_read_sample(clients[2].handle, sample, sizeof(sample))) > 0) {
+		read++;
+	}
+	zassert_equal(-ENODATA, ret);
+	zassert_true(read > 0 && read <= CONFIG_SENSING_SHARED_RING_SIZE, "read %d samples",
+		     read);
+
+	/* a sample that doesn't fit is left for a larger buffer */
+	k_msleep(30);
+	zassert_equal(-ENOSPC, sensing_read_sample(clients[2].handle, sample, 1));
+	zassert_true(sensing_read_sample(clients[2].handle, sample, sizeof(sample)) > 1);
+}
+
+ZTEST_SUITE(sensing_shared_ring, NULL, NULL, NULL, shared_ring_after, NULL);
+
+#endif /* CONFIG_SENSING_SHARED_RING */
@@ -83,6 +83,14 @@ static void store_pending(struct k_work *work)
 	printk("entry max: %u, entry min: %u\n", stats.single_entry_max,
 	       stats.single_entry_min);
 
+	/* benchmark loading of the stored entries, e.g. at boot */
+	ts1 = k_uptime_get();
+	err = settings_load();
+	zassert_equal(err, 0, "settings_load failed %d", err);
+
+	printk("loading of %u entries completed in %u ms\n",
+	       ARRAY_SIZE(test_settings), (uint32_t)k_uptime_delta(&ts1));
+
 	k_sem_give(&waitfor_work);
 }
 
@@ -96,6 +104,9 @@ ZTEST(settings_perf, test_performance)
 		printk("Testing with NVS\n");
 	} else if (IS_ENABLED(CONFIG_ZMS)) {
 		printk("Testing with ZMS\n");
+	} else if (IS_ENABLED(CONFIG_SETTINGS_FCB)) {
+		printk("Testing with FCB%s\n",
+		       IS_ENABLED(CONFIG_SETTINGS_LINE_INDEX) ? " and line index" : "");
 	}
 
 	k_work_queue_start(&settings_work_q, settings_work_stack,
@@ -0,0 +1,207 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/zbus/zbus.h>
+#include <zephyr/ztest.h>
+#include <zephyr/ztest_assert.h>
+
+struct msg {
+	uint32_t a;
+	uint32_t b;
+};
+
+static bool msg_validator(const void *msg, size_t msg_size)
+{
+	const struct msg *m = msg;
+
+	ARG_UNUSED(msg_size);
+
+	return m->a != UINT32_MAX;
+}
+
+static struct msg lis_msg;
+static int lis_count;
+
+static void lis_cb(const struct zbus_channel *chan)
+{
+	memcpy(&lis_msg, zbus_chan_const_msg(chan), sizeof(lis_msg));
+	++lis_count;
+}
+
+ZBUS_LISTENER_DEFINE(lis, lis_cb);
+
+ZBUS_MSG_SUBSCRIBER_DEFINE(msub);
+
+ZBUS_CHAN_DEFINE_LOAN(init_chan, struct msg, 2, NULL, NULL, ZBUS_OBSERVERS_EMPTY,
+		      ZBUS_MSG_INIT(.a = 10, .b = 20));
+
+ZBUS_CHAN_DEFINE_LOAN(pub_chan, struct msg, 3, msg_validator, NULL, ZBUS_OBSERVERS(lis),
+		      ZBUS_MSG_INIT(0));
+
+ZBUS_CHAN_DEFINE_LOAN(slots_chan, struct msg, 3, NULL, NULL, ZBUS_OBSERVERS_EMPTY,
+		      ZBUS_MSG_INIT(0));
+
+ZBUS_CHAN_DEFINE_LOAN(sub_chan, struct msg, 3, NULL, NULL, ZBUS_OBSERVERS(msub),
+		      ZBUS_MSG_INIT(0));
+
+ZBUS_CHAN_DEFINE(regular_chan, struct msg, NULL, NULL, ZBUS_OBSERVERS_EMPTY, ZBUS_MSG_INIT(0));
+
+static int pub_loaned(const struct zbus_channel *chan, uint32_t a, uint32_t b)
+{
+	struct msg *slot;
+	int err;
+
+	err = zbus_chan_loan(chan, (void **)&slot, K_NO_WAIT);
+	if (err) {
+		return err;
+	}
+
+	slot->a = a;
+	slot->b = b;
+
+	return zbus_chan_pub_loan(chan, slot, K_NO_WAIT);
+}
+
+ZTEST(loan_channel, test_initial_value)
+{
+	struct msg val;
+
+	zassert_equal(0, zbus_chan_read(&init_chan, &val, K_NO_WAIT));
+	zassert_equal(10, val.a);
+	zassert_equal(20, val.b);
+}
+
+ZTEST(loan_channel, test_pub_and_read)
+{
+	struct msg val = {.a = 7, .b = 8};
+	struct msg *slot;
+
+	lis_count = 0;
+
+	zassert_equal(0, pub_loaned(&pub_chan, 5, 6));
+	zassert_equal(1, lis_count);
+	zassert_equal(5, lis_msg.a);
+	zassert_equal(6, lis_msg.b);
+
+	zassert_equal(0, zbus_chan_read(&pub_chan, &val, K_NO_WAIT));
+	zassert_equal(5, val.a);
+	zassert_equal(6, val.b);
+
+	/* The copying publish goes through a loaned slot as well */
+	val.a = 7;
+	val.b = 8;
+	zassert_equal(0, zbus_chan_pub(&pub_chan, &val, K_NO_WAIT));
+	zassert_equal(2, lis_count);
+
+	memset(&val, 0, sizeof(val));
+	zassert_equal(0, zbus_chan_read(&pub_chan, &val, K_NO_WAIT));
+	zassert_equal(7, val.a);
+	zassert_equal(8, val.b);
+
+	/* An invalid message is not published and its slot is given back */
+	zassert_equal(-ENOMSG, pub_loaned(&pub_chan, UINT32_MAX, 0));
+	zassert_equal(2, lis_count);
+	zassert_equal(0, zbus_chan_read(&pub_chan, &val, K_NO_WAIT));
+	zassert_equal(7, val.a);
+
+	zassert_equal(0, zbus_chan_loan(&pub_chan, (void **)&slot, K_NO_WAIT));
+	zassert_equal(0, zbus_chan_loan_discard(&pub_chan, slot));
+}
+
+ZTEST(loan_channel, test_read_claimed_channel)
+{
+	struct msg val;
+
+	zassert_equal(0, pub_loaned(&pub_chan, 11, 12));
+
+	/* Reading a loan channel does not take the channel's semaphore */
+	zassert_equal(0, zbus_chan_claim(&pub_chan, K_NO_WAIT));
+	zassert_equal(0, zbus_chan_read(&pub_chan, &val, K_NO_WAIT));
+	zassert_equal(11, val.a);
+	zassert_equal(12, val.b);
+	zassert_equal(-EBUSY, pub_loaned(&pub_chan, 13, 14));
+	zassert_equal(0, zbus_chan_finish(&pub_chan));
+
+	zassert_equal(0, zbus_chan_claim(&regular_chan, K_NO_WAIT));
+	zassert_equal(-EBUSY, zbus_chan_read(&regular_chan, &val, K_NO_WAIT));
+	zassert_equal(0, zbus_chan_finish(&regular_chan));
+}
+
+ZTEST(loan_channel, test_slots)
+{
+	struct msg *first, *second, *third;
+
+	/* One of the three slots holds the published message */
+	zassert_equal(0, zbus_chan_loan(&slots_chan, (void **)&first, K_NO_WAIT));
+	zassert_equal(0, zbus_chan_loan(&slots_chan, (void **)&second, K_NO_WAIT));
+	zassert_not_equal(first, second);
+	zassert_equal(-EBUSY, zbus_chan_loan(&slots_chan, (void **)&third, K_NO_WAIT));
+	zassert_equal(-EAGAIN, zbus_chan_loan(&slots_chan, (void **)&third, K_MSEC(10)));
+
+	zassert_equal(0, zbus_chan_loan_discard(&slots_chan, first));
+	zassert_equal(0, zbus_chan_loan(&slots_chan, (void **)&third, K_NO_WAIT));
+	zassert_equal(first, third);
+
+	/* Publishing gives back the slot of the replaced message */
+	second->a = 1;
+	zassert_equal(0, zbus_chan_pub_loan(&slots_chan, second, K_NO_WAIT));
+	zassert_equal(0, zbus_chan_loan(&slots_chan, (void **)&first, K_NO_WAIT));
+	zassert_not_equal(first, second);
+	zassert_not_equal(first, third);
+	zassert_equal(-EBUSY, zbus_chan_loan(&slots_chan, (void **)&second, K_NO_WAIT));
+
+	zassert_equal(0, zbus_chan_loan_discard(&slots_chan, first));
+	zassert_equal(0, zbus_chan_loan_discard(&slots_chan, third));
+}
+
+ZTEST(loan_channel, test_invalid_params)
+{
+	struct msg val = {0};
+	struct msg *slot;
+
+	zassert_equal(-EFAULT, zbus_chan_loan(&regular_chan, (void **)&slot, K_NO_WAIT));
+	zassert_equal(-EFAULT, zbus_chan_loan(&slots_chan, NULL, K_NO_WAIT));
+	zassert_equal(-EFAULT, zbus_chan_pub_loan(&slots_chan, &val, K_NO_WAIT));
+	zassert_equal(-EFAULT, zbus_chan_loan_discard(&slots_chan, &val));
+
+	zassert_equal(0, zbus_chan_loan(&slots_chan, (void **)&slot, K_NO_WAIT));
+	zassert_equal(-EFAULT, zbus_chan_pub_loan(&slots_chan, (uint8_t *)slot + 1, K_NO_WAIT));
+	zassert_equal(-EFAULT, zbus_chan_pub_loan(&regular_chan, slot, K_NO_WAIT));
+	zassert_equal(0, zbus_chan_loan_discard(&slots_chan, slot));
+}
+
+ZTEST(loan_channel, test_msg_subscriber_reference)
+{
+	const struct zbus_channel *chan;
+	struct msg val;
+	struct msg *slot;
+
+	zassert_equal(0, pub_loaned(&sub_chan, 1, 1));
+	zassert_equal(0, pub_loaned(&sub_chan, 2, 2));
+	zassert_equal(0, pub_loaned(&sub_chan, 3, 3));
+
+	/* The pending notifications keep their slots, so all of them are in use */
+	zassert_equal(-EBUSY, zbus_chan_loan(&sub_chan, (void **)&slot, K_NO_WAIT));
+
+	zassert_equal(0, zbus_sub_wait_msg(&msub, &chan, &val, K_NO_WAIT));
+	zassert_equal(&sub_chan, chan);
+	zassert_equal(1, val.a);
+	zassert_equal(1, val.b);
+
+	/* Reading the message released its slot */
+	zassert_equal(0, zbus_chan_loan(&sub_chan, (void **)&slot, K_NO_WAIT));
+	zassert_equal(0, zbus_chan_loan_discard(&sub_chan, slot));
+
+	zassert_equal(0, zbus_sub_wait_msg(&msub, &chan, &val, K_NO_WAIT));
+	zassert_equal(2, val.a);
+	zassert_equal(0, zbus_sub_wait_msg(&msub, &chan, &val, K_NO_WAIT));
+	zassert_equal(3, val.a);
+	zassert_equal(-ENOMSG, zbus_sub_wait_msg(&msub, &chan, &val, K_NO_WAIT));
+
+	zassert_equal(0, zbus_chan_read(&sub_chan, &val, K_NO_WAIT));
+	zassert_equal(3, val.a);
+}
+
+ZTEST_SUITE(loan_channel, NULL, NULL, NULL, NULL, NULL);
@@ -51,6 +51,24 @@ ZTEST(crc, test_crc32_ieee)
 	zassert_equal(crc32_ieee(test3, sizeof(test3)), 0x20089AA4);
 }
 
+/* Long enough to go through the word-at-a-time paths of the slicing and
+ * instruction based engines, from an unaligned start and with a tail.
+ */
+ZTEST(crc, test_crc32_long)
+{
+	uint8_t buf[65];
+	uint8_t *data = &buf[1];
+
+	for (size_t i = 0; i < 64; i++) {
+		data[i] = i;
+	}
+
+	zassert_equal(crc32_ieee(data, 64), 0x100ECE8C);
+	zassert_equal(crc32_ieee(data, 37), 0x8222EFE9);
+	zassert_equal(crc32_c(0, data, 64, true, true), 0xFB6D36EB);
+	zassert_equal(crc32_c(0, data, 37, true, true), 0x239BA04D);
+}
+
 ZTEST(crc, test_crc24_pgp)
 {
 	uint8_t test1[] = { 'A' };